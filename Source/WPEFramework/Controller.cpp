@@ -14,6 +14,7 @@ namespace Plugin {
     static Core::ProxyPoolType<Web::JSONBodyType<PluginHost::MetaData>> jsonBodyMetaDataFactory(1);
     static Core::ProxyPoolType<Web::JSONBodyType<PluginHost::MetaData::Service>> jsonBodyServiceFactory(1);
     static Core::ProxyPoolType<Web::TextBody> jsonBodyTextFactory(2);
+    static Core::ProxyPoolType<Web::JSONBodyType<PluginHost::Timeline::ChromeTrace>> jsonBodyTimelineFactory(1);
 
     void Controller::SubSystems(Core::JSON::ArrayType<Core::JSON::EnumType<PluginHost::ISubSystem::subsystem>>::ConstIterator& index)
     {
@@ -236,6 +237,12 @@ namespace Plugin {
 
             WorkerPoolMetaData(response->Process);
 
+            result->Body(Core::proxy_cast<Web::IBody>(response));
+        } else if (index.Current() == _T("Timeline")) {
+            Core::ProxyType<Web::JSONBodyType<PluginHost::Timeline::ChromeTrace>> response(jsonBodyTimelineFactory.Element());
+
+            _pluginServer->Services().Timing().Get(*response);
+
             result->Body(Core::proxy_cast<Web::IBody>(response));
         } else if (index.Current() == _T("Discovery")) {
             Core::ProxyType<Web::JSONBodyType<PluginHost::MetaData>> response(jsonBodyMetaDataFactory.Element());
@@ -266,6 +266,7 @@ namespace Plugin {
         uint32_t get_discoveryresults(Core::JSON::ArrayType<PluginHost::MetaData::Bridge>& response) const;
         uint32_t get_environment(const string& index, Core::JSON::String& response) const;
         uint32_t get_configuration(const string& index, Core::JSON::String& response) const;
+        uint32_t get_timeline(Core::JSON::ArrayType<PluginHost::MetaData::Phase>& response) const;
         uint32_t set_configuration(const string& index, const Core::JSON::String& params);
         void event_all(const string& callsign, const Core::JSON::String& data);
         void event_statechange(const string& callsign, const PluginHost::IShell::state& state, const PluginHost::IShell::reason& reason);
@@ -28,10 +28,12 @@ namespace Plugin {
         Property<Core::JSON::ArrayType<PluginHost::MetaData::Bridge>>(_T("discoveryresults"), &Controller::get_discoveryresults, nullptr, this);
         Property<Core::JSON::String>(_T("environment"), &Controller::get_environment, nullptr, this);
         Property<Core::JSON::String>(_T("configuration"), &Controller::get_configuration, &Controller::set_configuration, this);
+        Property<Core::JSON::ArrayType<PluginHost::MetaData::Phase>>(_T("timeline"), &Controller::get_timeline, nullptr, this);
     }
 
     void Controller::UnregisterAll()
     {
+        Unregister(_T("timeline"));
         Unregister(_T("harakiri"));
         Unregister(_T("delete"));
         Unregister(_T("storeconfig"));
@@ -356,6 +358,18 @@ namespace Plugin {
         return result;
     }
 
+    // Property: timeline - Phases the plugins went through while being activated
+    // Return codes:
+    //  - ERROR_NONE: Success
+    uint32_t Controller::get_timeline(Core::JSON::ArrayType<PluginHost::MetaData::Phase>& response) const
+    {
+        ASSERT(_pluginServer != nullptr);
+
+        _pluginServer->Services().Timing().Get(response);
+
+        return Core::ERROR_NONE;
+    }
+
     // Event: statechange - Signals a plugin state change
     void Controller::event_statechange(const string& callsign, const PluginHost::IShell::state& state, const PluginHost::IShell::reason& reason)
     {
@@ -16,6 +16,10 @@ set(PRIORITY 0 CACHE STRING "Change the nice level [-20 - 20]")
 set(POLICY "OTHER" CACHE STRING "NA")
 set(OOMADJUST 0 CACHE STRING "Adapt the OOM score [-15 - 15]")
 set(STACKSIZE 0 CACHE STRING "Default stack size per thread")
+set(REACTORS 1 CACHE STRING "Number of resource monitor threads")
+set(REACTOR_AFFINITY false CACHE STRING "Pin each resource monitor thread to its own core")
+set(TRACE_BUFFER 0 CACHE STRING "Bytes per thread to record deferred traces in, 0 formats them right away")
+set(CONCURRENT_STARTUP false CACHE STRING "Activate independent autostart plugins concurrently, only if all dependencies are preconditions")
 
 map()
   key(plugins)
@@ -35,12 +39,16 @@ map_set(${CONFIG} datapath ${DATA_PATH})
 map_set(${CONFIG} systempath ${SYSTEM_PATH})
 map_set(${CONFIG} proxystubpath ${PROXYSTUB_PATH})
 map_set(${CONFIG} redirect "/Service/Controller/UI")
+map_set(${CONFIG} tracebuffer ${TRACE_BUFFER})
+map_set(${CONFIG} concurrentstartup ${CONCURRENT_STARTUP})
 
 map()
     kv(priority ${PRIORITY})
     kv(policy ${POLICY})
     kv(oomadjust ${OOMADJUST})
     kv(stacksize ${STACKSIZE})
+    kv(reactors ${REACTORS})
+    kv(affinity ${REACTOR_AFFINITY})
 end()
 ans(PROCESS_CONFIG)
 map_append(${CONFIG} process ${PROCESS_CONFIG})
@@ -385,6 +385,12 @@ namespace PluginHost {
             if (serviceConfig.Process.StackSize.IsSet() == true) {
                 Core::Thread::DefaultStackSize(serviceConfig.Process.StackSize.Value());
             }
+
+            if (serviceConfig.Process.Reactors.IsSet() == true) {
+                if (Core::ResourceMonitor::Instance().Configure(serviceConfig.Process.Reactors.Value(), serviceConfig.Process.Affinity.Value()) != Core::ERROR_NONE) {
+                    SYSLOG(Logging::Startup, (_T("Could not configure %d resource monitor reactors."), serviceConfig.Process.Reactors.Value()));
+                }
+            }
         }
 
 #ifndef __WINDOWS__
@@ -430,6 +436,11 @@ namespace PluginHost {
             Trace::TraceUnit::Instance().Defaults(serviceConfig.DefaultTraceCategories.Value());
         }
 
+        if (serviceConfig.TraceBuffer.Value() != 0) {
+            // Record the deferred traces per thread, the server flushes them periodically.
+            Trace::TraceRecorder::Instance().Open(serviceConfig.TraceBuffer.Value());
+        }
+
         SYSLOG(Logging::Startup, (_T(EXPAND_AND_QUOTE(APPLICATION_NAME))));
         SYSLOG(Logging::Startup, (_T("Starting time: %s"), Core::Time::Now().ToRFC1123(false).c_str()));
         SYSLOG(Logging::Startup, (_T("Process Id:    %d"), Core::ProcessInfo().Id()));
@@ -673,14 +684,22 @@ namespace PluginHost {
                     }
                     break;
                 }
+                case 'F': {
+                    uint32_t flushed = Trace::TraceUnit::Instance().Flush();
+                    printf("Flushed %d deferred trace(s), %d dropped.\n", flushed, Trace::TraceRecorder::Instance().Dropped());
+                    break;
+                }
                 case 'Q':
                     break;
 
 #if !defined(__WINDOWS__) && !defined(__APPLE__)
                 case 'R': {
-                    printf("\nMonitor callstack:\n");
-                    printf("============================================================\n");
-                    PublishCallstack(Core::ResourceMonitor::Instance().Id());
+                    Core::ResourceMonitor& monitor = Core::ResourceMonitor::Instance();
+                    for (uint8_t index = 0; index < monitor.Reactors(); index++) {
+                        printf("\nMonitor[%d] callstack:\n", index);
+                        printf("============================================================\n");
+                        PublishCallstack(monitor.Id(index));
+                    }
                     break;
                 }
                 case '0':
@@ -712,6 +731,7 @@ namespace PluginHost {
                     printf("  [S]erver stats\n");
                     printf("  [T]rigger resource monitor\n");
                     printf("  [M]etadata resource monitor\n");
+                    printf("  [F]lush deferred traces\n");
                     printf("  [R]esource monitor stack\n");
                     printf("  [0..%d] Workerpool stacks\n", THREADPOOL_COUNT);
                     printf("  [Q]uit\n\n");
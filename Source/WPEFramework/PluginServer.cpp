@@ -321,14 +321,16 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
             result = Core::ERROR_ILLEGAL_STATE;
         } else if ((currentState == IShell::DEACTIVATED) || (currentState == IShell::PRECONDITION)) {
 
+            const uint64_t start(Core::Time::Now().Ticks());
+            const string callSign(PluginHost::Service::Configuration().Callsign.Value());
+            const string className(PluginHost::Service::Configuration().ClassName.Value());
+
             // Load the interfaces, If we did not load them yet...
             if (_handler == nullptr) {
                 AquireInterfaces();
+                _administrator.Timing().Record(callSign, MetaData::Phase::LOAD, start);
             }
 
-            const string callSign(PluginHost::Service::Configuration().Callsign.Value());
-            const string className(PluginHost::Service::Configuration().ClassName.Value());
-
             if (_handler == nullptr) {
                 SYSLOG(Logging::Startup, (_T("Activation of plugin [%s]:[%s], failed. Error [%s]"), className.c_str(), callSign.c_str(), ErrorMessage().c_str()));
                 result = Core::ERROR_UNAVAILABLE;
@@ -338,6 +340,7 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
                 SYSLOG(Logging::Startup, (_T("Activation of plugin [%s]:[%s], postponed, preconditions have not been met, yet."), className.c_str(), callSign.c_str()));
                 result = Core::ERROR_PENDING_CONDITIONS;
                 _reason = why;
+                _parked = Core::Time::Now().Ticks();
                 State(PRECONDITION);
 
                 if (Trace::TraceType<Activity, &Core::System::MODULE_NAME>::IsEnabled() == true) {
@@ -365,6 +368,10 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
                 }
             } else {
 
+                if (currentState == IShell::PRECONDITION) {
+                    _administrator.Timing().Record(callSign, MetaData::Phase::PRECONDITION, _parked);
+                }
+
                 State(ACTIVATION);
                 _administrator.StateChange(this);
 
@@ -372,9 +379,13 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
 
                 TRACE(Activity, (_T("Activation plugin [%s]:[%s]"), className.c_str(), callSign.c_str()));
 
+                const uint64_t initialize(Core::Time::Now().Ticks());
+
                 // Fire up the interface. Let it handle the messages.
                 ErrorMessage(_handler->Initialize(this));
 
+                _administrator.Timing().Record(callSign, MetaData::Phase::INITIALIZE, initialize);
+
                 if (HasError() == true) {
                     result = Core::ERROR_GENERAL;
 
@@ -400,6 +411,8 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
 
                     SYSLOG(Logging::Startup, (_T("Activated plugin [%s]:[%s]"), className.c_str(), callSign.c_str()));
                     Lock();
+                    _activationTime = static_cast<uint32_t>(Core::Time::Now().Ticks() - start);
+                    _administrator.Timing().Record(callSign, MetaData::Phase::ACTIVATION, start);
                     State(ACTIVATED);
                     _administrator.StateChange(this);
 
@@ -566,12 +579,12 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
         , _security(_parent.Officer())
         , _service()
     {
-        TRACE(Activity, (_T("Construct a link with ID: [%d] to [%s]"), Id(), remoteId.QualifiedName().c_str()));
+        TRACE_DEFERRED(Activity, (_T("Construct a link with ID: [%d] to [%s]"), Id(), remoteId.QualifiedName().c_str()));
     }
 
     /* virtual */ Server::Channel::~Channel()
     {
-        TRACE(Activity, (_T("Destruct a link with ID [%d] to [%s]"), Id(), RemoteId().c_str()));
+        TRACE_DEFERRED(Activity, (_T("Destruct a link with ID [%d] to [%s]"), Id(), RemoteId().c_str()));
 
         // If we are still atatched to a service, detach, we are out of scope...
         if (_service.IsValid() == true) {
@@ -623,6 +636,8 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
               configuration.Redirect.Value())
         , _services(*this, _config, configuration.Process.IsSet() ? configuration.Process.StackSize.Value() : 0)
         , _controller()
+        , _startup(*this, configuration.ConcurrentStartup.Value())
+        , _traceFlush(Core::ProxyType<TraceFlush>::Create(this))
     {
 
         // See if the persitent path for our-selves exist, if not we will create it :-)
@@ -752,19 +767,34 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
         _dispatcher.Run();
         Dispatcher().Open(MAX_EXTERNAL_WAITS);
 
+        if (Trace::TraceRecorder::Instance().IsOpen() == true) {
+            Core::Time NextTick(Core::Time::Now());
+
+            NextTick.Add(TraceFlushInterval);
+
+            Schedule(NextTick.Ticks(), _traceFlush);
+        }
+
         // Right we have the shells for all possible services registered, time to activate what is needed :-)
         ServiceMap::Iterator iterator(_services.Services());
+        std::list<Core::ProxyType<Service>> autoStart;
 
         while (iterator.Next() == true) {
 
             Core::ProxyType<Service> service(*iterator);
 
             if (service->AutoStart() == true) {
-                service->Activate(PluginHost::IShell::STARTUP);
+                autoStart.push_back(service);
             } else {
                 SYSLOG(Logging::Startup, (_T("Activation of plugin [%s]:[%s] blocked"), service->ClassName().c_str(), service->Callsign().c_str()));
             }
         }
+
+        const uint64_t start(Core::Time::Now().Ticks());
+
+        _startup.Run(autoStart);
+
+        SYSLOG(Logging::Startup, (_T("Startup of %d plugin(s) took %d ms"), static_cast<uint32_t>(autoStart.size()), static_cast<uint32_t>((Core::Time::Now().Ticks() - start) / Core::Time::TicksPerMillisecond)));
     }
 
     void Server::Close()
@@ -773,9 +803,13 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
         _connections.Close(Core::infinite);
         destructor->Stopped();
         _services.Destroy();
+        Revoke(_traceFlush);
         _dispatcher.Stop();
         destructor->Release();
         _inputHandler.Deinitialize();
+
+        // Whatever got recorded while shutting down.
+        Trace::TraceUnit::Instance().Flush();
     }
 }
 }
@@ -5,6 +5,7 @@
 #include "IRemoteInstantiation.h"
 #include "Module.h"
 #include "SystemInfo.h"
+#include "Timeline.h"
 
 #ifdef PROCESSCONTAINERS_ENABLED
 #include "../processcontainers/ProcessContainer.h"
@@ -97,6 +98,8 @@ namespace PluginHost {
                     , Policy()
                     , StackSize(0)
                     , Umask(1)
+                    , Reactors(1)
+                    , Affinity(false)
                 {
                     Add(_T("user"), &User);
                     Add(_T("group"), &Group);
@@ -105,6 +108,8 @@ namespace PluginHost {
                     Add(_T("oomadjust"), &OOMAdjust);
                     Add(_T("stacksize"), &StackSize);
                     Add(_T("umask"), &Umask);
+                    Add(_T("reactors"), &Reactors);
+                    Add(_T("affinity"), &Affinity);
                 }
                 ProcessSet(const ProcessSet& copy)
                     : Core::JSON::Container()
@@ -115,6 +120,8 @@ namespace PluginHost {
                     , Policy(copy.Policy)
                     , StackSize(copy.StackSize)
                     , Umask(copy.Umask)
+                    , Reactors(copy.Reactors)
+                    , Affinity(copy.Affinity)
                 {
                     Add(_T("user"), &User);
                     Add(_T("group"), &Group);
@@ -123,6 +130,8 @@ namespace PluginHost {
                     Add(_T("oomadjust"), &OOMAdjust);
                     Add(_T("stacksize"), &StackSize);
                     Add(_T("umask"), &Umask);
+                    Add(_T("reactors"), &Reactors);
+                    Add(_T("affinity"), &Affinity);
                 }
                 ~ProcessSet()
                 {
@@ -137,6 +146,8 @@ namespace PluginHost {
                     OOMAdjust = RHS.OOMAdjust;
                     StackSize = RHS.StackSize;
                     Umask = RHS.Umask;
+                    Reactors = RHS.Reactors;
+                    Affinity = RHS.Affinity;
 
                     return (*this);
                 }
@@ -148,6 +159,8 @@ namespace PluginHost {
                 Core::JSON::EnumType<Core::ProcessInfo::scheduler> Policy;
                 Core::JSON::DecUInt32 StackSize;
                 Core::JSON::DecUInt16 Umask;
+                Core::JSON::DecUInt8 Reactors;
+                Core::JSON::Boolean Affinity;
             };
 
             class InputConfig : public Core::JSON::Container {
@@ -243,6 +256,8 @@ namespace PluginHost {
                 , IdleTime(0)
                 , IPV6(false)
                 , DefaultTraceCategories(false)
+                , TraceBuffer(0)
+                , ConcurrentStartup(false)
                 , Process()
                 , Input()
                 , Configs()
@@ -268,6 +283,8 @@ namespace PluginHost {
                 Add(_T("idletime"), &IdleTime);
                 Add(_T("ipv6"), &IPV6);
                 Add(_T("tracing"), &DefaultTraceCategories);
+                Add(_T("tracebuffer"), &TraceBuffer);
+                Add(_T("concurrentstartup"), &ConcurrentStartup);
                 Add(_T("redirect"), &Redirect);
                 Add(_T("process"), &Process);
                 Add(_T("input"), &Input);
@@ -301,6 +318,8 @@ namespace PluginHost {
             Core::JSON::DecUInt16 IdleTime;
             Core::JSON::Boolean IPV6;
             Core::JSON::String DefaultTraceCategories;
+            Core::JSON::DecUInt32 TraceBuffer;
+            Core::JSON::Boolean ConcurrentStartup;
             ProcessSet Process;
             InputConfig Input;
             Core::JSON::String Configs;
@@ -587,6 +606,8 @@ namespace PluginHost {
                 , _precondition(plugin->Precondition, true)
                 , _termination(plugin->Termination, false)
                 , _activity(0)
+                , _activationTime(0)
+                , _parked(0)
                 , _administrator(*administrator)
             {
                 ASSERT(server != nullptr);
@@ -892,6 +913,8 @@ namespace PluginHost {
                     metaData.Module = _moduleName;
                 if (_versionHash.empty() == false)
                     metaData.Hash = _versionHash;
+                if (_activationTime != 0)
+                    metaData.ActivationTime = _activationTime;
 
                 PluginHost::Service::GetMetaData(metaData);
             }
@@ -1096,6 +1119,8 @@ namespace PluginHost {
             Condition _precondition;
             Condition _termination;
             uint32_t _activity;
+            uint32_t _activationTime;
+            uint64_t _parked;
 
             ServiceMap& _administrator;
             static Core::ProxyType<Web::Response> _unavailableHandler;
@@ -1637,6 +1662,7 @@ namespace PluginHost {
                     , _server(server)
                     , _subSystems(this)
                     , _authenticationHandler(nullptr)
+                    , _timeline()
                 {
                 }
 #ifdef __WINDOWS__
@@ -1684,6 +1710,10 @@ namespace PluginHost {
                 {
                     return (_server.Dispatcher().Submit(id, response));
                 }
+                inline PluginHost::Timeline& Timing()
+                {
+                    return (_timeline);
+                }
                 inline uint32_t SubSystemInfo() const
                 {
                     return (_subSystems.Value());
@@ -1764,7 +1794,13 @@ namespace PluginHost {
 
                 virtual void* Instantiate(const RPC::Object& object, const uint32_t waitTime, uint32_t& sessionId, const string& className, const string& callsign) override
                 {
-                    return (_processAdministrator.Create(sessionId, object, className, callsign, waitTime));
+                    const uint64_t start(Core::Time::Now().Ticks());
+
+                    void* result = _processAdministrator.Create(sessionId, object, className, callsign, waitTime);
+
+                    _timeline.Record(callsign, MetaData::Phase::LAUNCH, start);
+
+                    return (result);
                 }
                 virtual void Register(RPC::IRemoteConnection::INotification* sink) override
                 {
@@ -1978,6 +2014,7 @@ namespace PluginHost {
                 Server& _server;
                 Core::Sink<SubSystems> _subSystems;
                 IAuthenticate* _authenticationHandler;
+                PluginHost::Timeline _timeline;
             };
 
             // Connection handler is the listening socket and keeps track of all open
@@ -2080,7 +2117,7 @@ namespace PluginHost {
                             }
 
                             if (_request->Connection.Value() == Web::Request::CONNECTION_CLOSE) {
-                                TRACE(Activity, (_T("HTTP Request with direct close on [%d]"), _ID));
+                                TRACE_DEFERRED(Activity, (_T("HTTP Request with direct close on [%d]"), _ID));
                                 _server->Dispatcher().Suspend(_ID);
                             }
 
@@ -2529,9 +2566,9 @@ namespace PluginHost {
 
                 // We are in an upgraded mode, we are a websocket. Time to "deserialize and serialize
                 // INBOUND and OUTBOUND information.
-                virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+                virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
                 {
-                    uint16_t result = 0;
+                    uint32_t result = 0;
 
                     if (State() == RAW) {
                         result = _service->Outbound(Id(), dataFrame, maxSendSize);
@@ -2541,9 +2578,9 @@ namespace PluginHost {
 
                     return (result);
                 }
-                virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+                virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
                 {
-                    uint16_t result = receivedSize;
+                    uint32_t result = receivedSize;
 
                     if (State() == RAW) {
                         result = _service->Inbound(Id(), dataFrame, receivedSize);
@@ -2557,7 +2594,7 @@ namespace PluginHost {
                 // Whenever there is a state change on the link, it is reported here.
                 virtual void StateChange()
                 {
-                    TRACE(Activity, (_T("State change on [%d] to [%s]"), Id(), (IsSuspended() ? _T("SUSPENDED") : (IsUpgrading() ? _T("UPGRADING") : (IsWebSocket() ? _T("WEBSOCKET") : _T("WEBSERVER"))))));
+                    TRACE_DEFERRED(Activity, (_T("State change on [%d] to [%s]"), Id(), (IsSuspended() ? _T("SUSPENDED") : (IsUpgrading() ? _T("UPGRADING") : (IsWebSocket() ? _T("WEBSOCKET") : _T("WEBSERVER"))))));
 
                     // If we are closing (or closed) do the clean up
                     if (IsOpen() == false) {
@@ -2767,7 +2804,7 @@ namespace PluginHost {
 
                     while (index.Next() == true) {
                         if (index.Client()->HasActivity() == false) {
-                            TRACE(Activity, (_T("Client close without activity on ID [%d]"), index.Client()->Id()));
+                            TRACE_DEFERRED(Activity, (_T("Client close without activity on ID [%d]"), index.Client()->Id()));
 
                             // Oops nothing hapened for a long time, kill the connection
                             // Give it all the time (0) if it i not yet suspended to close. If it is
@@ -2787,6 +2824,156 @@ namespace PluginHost {
                 Core::ProxyType<Core::IDispatchType<void>> _job;
             };
 
+        // Activates the services that start automatically, in configuration order, on the thread that opens
+        // the server. Only if the configuration opts in ("concurrentstartup"), pool jobs pick up services as
+        // well, so services are activated (library loading and process spawning included) concurrently.
+        // That is only safe if all dependencies between services are expressed as preconditions: a service
+        // whose subsystems are not there yet parks in PRECONDITION and gets activated as soon as the service
+        // it depends on signals them. Nothing declares which subsystems a service provides, so there is no
+        // graph to order the rest by, a service that relies on the configuration order must not opt in.
+        // One pool thread is always left free to serve the COM-RPC calls an activation might wait for.
+        class StartupScheduler {
+        private:
+            StartupScheduler() = delete;
+            StartupScheduler(const StartupScheduler&) = delete;
+            StartupScheduler& operator=(const StartupScheduler&) = delete;
+
+            class Job : public Core::IDispatchType<void> {
+            private:
+                Job() = delete;
+                Job(const Job&) = delete;
+                Job& operator=(const Job&) = delete;
+
+            public:
+                Job(StartupScheduler* parent)
+                    : _parent(*parent)
+                {
+                    ASSERT(parent != nullptr);
+                }
+                virtual ~Job()
+                {
+                }
+
+            public:
+                virtual void Dispatch() override
+                {
+                    _parent.Process();
+                }
+
+            private:
+                StartupScheduler& _parent;
+            };
+
+        public:
+            StartupScheduler(Server& parent, const bool concurrent)
+                : _parent(parent)
+                , _concurrent(concurrent)
+                , _adminLock()
+                , _pending()
+                , _running(0)
+                , _completed(false, true)
+            {
+            }
+            ~StartupScheduler()
+            {
+                ASSERT(_running == 0);
+            }
+
+        public:
+            // Returns once all services have been processed.
+            void Run(const std::list<Core::ProxyType<Service>>& services)
+            {
+                const uint8_t jobs = (_concurrent == false ? 0 : static_cast<uint8_t>(std::min(services.size() - (services.empty() ? 0 : 1), static_cast<size_t>(THREADPOOL_COUNT > 2 ? THREADPOOL_COUNT - 2 : 0))));
+
+                _adminLock.Lock();
+
+                ASSERT(_running == 0);
+
+                _pending = services;
+                _running = jobs + 1;
+                _completed.ResetEvent();
+
+                _adminLock.Unlock();
+
+                for (uint8_t index = 0; index < jobs; index++) {
+                    _parent.Submit(Core::ProxyType<Core::IDispatchType<void>>(Core::ProxyType<Job>::Create(this)));
+                }
+
+                Process();
+
+                _completed.Lock(Core::infinite);
+            }
+
+        private:
+            void Process()
+            {
+                _adminLock.Lock();
+
+                while (_pending.empty() == false) {
+                    Core::ProxyType<Service> service(_pending.front());
+                    _pending.pop_front();
+
+                    _adminLock.Unlock();
+
+                    service->Activate(PluginHost::IShell::STARTUP);
+
+                    _adminLock.Lock();
+                }
+
+                if (--_running == 0) {
+                    _completed.SetEvent();
+                }
+
+                _adminLock.Unlock();
+            }
+
+        private:
+            Server& _parent;
+            const bool _concurrent;
+            Core::CriticalSection _adminLock;
+            std::list<Core::ProxyType<Service>> _pending;
+            uint8_t _running;
+            Core::Event _completed;
+        };
+
+        // If the deferred trace path is used (a "tracebuffer" is configured), the traces recorded by every
+        // thread are formatted and written out periodically, so the per thread rings do not fill up.
+        class TraceFlush : public Core::IDispatchType<void> {
+        private:
+            TraceFlush() = delete;
+            TraceFlush(const TraceFlush&) = delete;
+            TraceFlush& operator=(const TraceFlush&) = delete;
+
+        public:
+            TraceFlush(Server* parent)
+                : _parent(*parent)
+            {
+                ASSERT(parent != nullptr);
+            }
+            ~TraceFlush() override
+            {
+            }
+
+        public:
+            void Dispatch() override
+            {
+                Trace::TraceUnit::Instance().Flush();
+
+                Core::Time NextTick(Core::Time::Now());
+
+                NextTick.Add(TraceFlushInterval);
+
+                _parent.Schedule(NextTick.Ticks(), _parent._traceFlush);
+            }
+
+        private:
+            Server& _parent;
+        };
+
+        public:
+            // In ms, the configured "tracebuffer" should hold the traces a thread records in this time.
+            static constexpr uint32_t TraceFlushInterval = 1000;
+
         public:
             Server(Config& configuration, const bool background);
             virtual ~Server();
@@ -2872,6 +3059,10 @@ namespace PluginHost {
             Core::ProxyType<Service> _controller;
 
             Environment _environment;
+
+            StartupScheduler _startup;
+
+            Core::ProxyType<Core::IDispatchType<void>> _traceFlush;
         };
     }
 }
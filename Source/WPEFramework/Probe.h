@@ -133,12 +133,12 @@ namespace Plugin {
                 }
             }
             // Methods to extract and insert data into the socket buffers
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
             {
 
                 // We assume that this all fit a datagram. The datagram will *NOT* cross the datagram boundries.
                 // Hence why this method will only be called once !!
-                uint16_t size(0);
+                uint32_t size(0);
 
                 _adminLock.Lock();
 
@@ -172,7 +172,7 @@ namespace Plugin {
             {
             }
 
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize);
+            virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize);
 
         private:
             std::string CreateRequest()
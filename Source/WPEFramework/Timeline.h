@@ -0,0 +1,193 @@
+#pragma once
+
+#include "Module.h"
+
+namespace WPEFramework {
+namespace PluginHost {
+
+    // Fixed size, in memory log of the phases plugins go through (loading, waiting for preconditions,
+    // initializing, launching a remote process). Once full, the oldest phases are overwritten.
+    class Timeline {
+    public:
+        typedef MetaData::Phase::phase phase;
+
+        static constexpr uint16_t Slots = 512;
+
+        // The Chrome trace event format, load it in chrome://tracing or https://ui.perfetto.dev
+        class ChromeTrace : public Core::JSON::Container {
+        public:
+            class Event : public Core::JSON::Container {
+            private:
+                Event& operator=(const Event&) = delete;
+
+            public:
+                Event()
+                    : Core::JSON::Container()
+                {
+                    Init();
+                }
+                Event(const Event& copy)
+                    : Core::JSON::Container()
+                    , Name(copy.Name)
+                    , Category(copy.Category)
+                    , Type(copy.Type)
+                    , Timestamp(copy.Timestamp)
+                    , Duration(copy.Duration)
+                    , Process(copy.Process)
+                    , Thread(copy.Thread)
+                {
+                    Init();
+                }
+                ~Event() override
+                {
+                }
+
+            private:
+                void Init()
+                {
+                    Add(_T("name"), &Name);
+                    Add(_T("cat"), &Category);
+                    Add(_T("ph"), &Type);
+                    Add(_T("ts"), &Timestamp);
+                    Add(_T("dur"), &Duration);
+                    Add(_T("pid"), &Process);
+                    Add(_T("tid"), &Thread);
+                }
+
+            public:
+                Core::JSON::String Name;
+                Core::JSON::String Category;
+                Core::JSON::String Type;
+                Core::JSON::DecUInt64 Timestamp;
+                Core::JSON::DecUInt32 Duration;
+                Core::JSON::DecUInt32 Process;
+                Core::JSON::DecUInt32 Thread;
+            };
+
+        public:
+            ChromeTrace(const ChromeTrace&) = delete;
+            ChromeTrace& operator=(const ChromeTrace&) = delete;
+
+            ChromeTrace()
+                : Core::JSON::Container()
+                , TraceEvents()
+            {
+                Add(_T("traceEvents"), &TraceEvents);
+            }
+            ~ChromeTrace() override
+            {
+            }
+
+        public:
+            Core::JSON::ArrayType<Event> TraceEvents;
+        };
+
+    private:
+        struct Entry {
+            string Callsign;
+            phase Name;
+            uint64_t Start;
+            uint32_t Duration;
+            uint32_t Thread;
+        };
+
+    public:
+        Timeline(const Timeline&) = delete;
+        Timeline& operator=(const Timeline&) = delete;
+
+        Timeline()
+            : _adminLock()
+            , _entries(Slots)
+            , _threads()
+            , _next(0)
+            , _origin(Core::Time::Now().Ticks())
+        {
+        }
+        ~Timeline()
+        {
+        }
+
+    public:
+        // The phase ends now, on the calling thread.
+        void Record(const string& callsign, const phase name, const uint64_t start)
+        {
+            const uint64_t now(Core::Time::Now().Ticks());
+            const ::ThreadId id(Core::Thread::ThreadId());
+
+            _adminLock.Lock();
+
+            std::map<::ThreadId, uint32_t>::iterator thread(_threads.find(id));
+
+            if (thread == _threads.end()) {
+                thread = _threads.emplace(id, static_cast<uint32_t>(_threads.size() + 1)).first;
+            }
+
+            Entry& entry(_entries[_next % Slots]);
+
+            entry.Callsign = callsign;
+            entry.Name = name;
+            entry.Start = (start > _origin ? start - _origin : 0);
+            entry.Duration = static_cast<uint32_t>(now > start ? now - start : 0);
+            entry.Thread = thread->second;
+
+            _next++;
+
+            _adminLock.Unlock();
+        }
+        void Get(Core::JSON::ArrayType<MetaData::Phase>& response) const
+        {
+            _adminLock.Lock();
+
+            for (uint32_t index = First(); index < _next; index++) {
+                const Entry& entry(_entries[index % Slots]);
+                MetaData::Phase& element(response.Add());
+
+                element.Callsign = entry.Callsign;
+                element.Name = entry.Name;
+                element.Start = entry.Start;
+                element.Duration = entry.Duration;
+                element.Thread = entry.Thread;
+            }
+
+            _adminLock.Unlock();
+        }
+        void Get(ChromeTrace& response) const
+        {
+            const uint32_t process(Core::ProcessInfo().Id());
+
+            _adminLock.Lock();
+
+            for (uint32_t index = First(); index < _next; index++) {
+                const Entry& entry(_entries[index % Slots]);
+                ChromeTrace::Event& element(response.TraceEvents.Add());
+
+                const string name(Core::EnumerateType<phase>(entry.Name).Data());
+
+                element.Name = name + ' ' + entry.Callsign;
+                element.Category = name;
+                element.Type = _T("X");
+                element.Timestamp = entry.Start;
+                element.Duration = entry.Duration;
+                element.Process = process;
+                // Waits for preconditions overlap with whatever the thread did meanwhile, give each its own row.
+                element.Thread = (entry.Name == MetaData::Phase::PRECONDITION ? (0x10000 | (index % Slots)) : entry.Thread);
+            }
+
+            _adminLock.Unlock();
+        }
+
+    private:
+        uint32_t First() const
+        {
+            return (_next > Slots ? _next - Slots : 0);
+        }
+
+    private:
+        mutable Core::CriticalSection _adminLock;
+        std::vector<Entry> _entries;
+        std::map<::ThreadId, uint32_t> _threads;
+        uint32_t _next;
+        const uint64_t _origin;
+    };
+}
+}
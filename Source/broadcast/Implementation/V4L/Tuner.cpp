@@ -1,5 +1,6 @@
 #include "Definitions.h"
 #include "ProgramTable.h"
+#include "TransportDemux.h"
 #include "TunerAdministrator.h"
 
 #include <linux/dvb/frontend.h>
@@ -202,6 +203,7 @@ static constexpr conversion_entry _tableRollOff[] = {
             Core::CriticalSection _adminLock;
             std::list<Tuner*> _entries;
         };
+        // One descriptor per table: the demux filters the sections and hands them out one per read.
         class MuxFilter : public Core::IResource {
         public:
             MuxFilter() = delete;
@@ -210,10 +212,7 @@ static constexpr conversion_entry _tableRollOff[] = {
 
             MuxFilter(const string& path, const uint8_t index, const uint16_t pid, const uint8_t tableId, ISection* callback) 
                 : _mux(-1)
-                , _offset(0)
-                , _length(0)
-                , _size(1024)
-                , _buffer(reinterpret_cast<uint8_t*>(::malloc(_size)))
+                , _buffer(reinterpret_cast<uint8_t*>(::malloc(MaxSectionSize)))
                 , _callback(callback) {
 
                 char deviceName[32];
@@ -267,68 +266,156 @@ static constexpr conversion_entry _tableRollOff[] = {
                 return (POLLPRI);
             }
             void Handle(const uint16_t events) override {
-               if (LoadHeader() == true) {
-                    int loaded = ::read(_mux, &(_buffer[_offset]), (_length - (_offset - 3)));
-                    if (loaded < 0) {
-                        int result = errno;
-                        if ((result != EAGAIN) || (result != EWOULDBLOCK)) {
-                            _offset = 0;
-                        }
-                    }
-                    else {
-                        _offset += loaded;
-                        if ((_offset - 3) == _length) {
-                            MPEG::Section newSection(Core::DataElement(_offset, _buffer));
-                            _callback->Handle(newSection);
-                            _offset = 0;
-                        }
-                    }
+                int loaded;
+
+                // With room for the largest section, a read returns exactly one section. Take all
+                // sections that are queued, not just the one that triggered this call.
+                while ((loaded = ::read(_mux, _buffer, MaxSectionSize)) > 0) {
+                    MPEG::Section newSection(Core::DataElement(loaded, _buffer));
+                    _callback->Handle(newSection);
                 }
             }
 
         private:
-            bool LoadHeader() 
-            {
-                bool moreToLoad = true;
-                if (_offset < 3) {
-                    int loaded = ::read(_mux, &(_buffer[_offset]), (3 - _offset));
-                    if (loaded < 0) {
-                        int result = errno;
-                        if ((result != EAGAIN) || (result != EWOULDBLOCK)) {
-                            _offset = 0;
-                        }
-                        moreToLoad = false;
+            static constexpr uint16_t MaxSectionSize = 3 + 0x0FFF;
+
+            int _mux;
+            uint8_t* _buffer;
+            ISection* _callback;
+        };
+
+        // One descriptor for all tables: the demux passes the transport stream packets of the PIDs
+        // of interest, they are read in large chunks and the sections are put together here.
+        class StreamFilter : public Core::IResource {
+        public:
+            StreamFilter() = delete;
+            StreamFilter(const StreamFilter&) = delete;
+            StreamFilter& operator= (const StreamFilter&) = delete;
+
+            StreamFilter(const string& path, const uint8_t index)
+                : _mux(-1)
+                , _buffer(reinterpret_cast<uint8_t*>(::malloc(ReadSize)))
+                , _pids()
+                , _demux() {
+
+                char deviceName[32];
+
+                strncpy (deviceName, path.c_str(), sizeof(deviceName));
+
+                ::snprintf(&(deviceName[path.length()]), (sizeof(deviceName) - path.length()), "demux%d", index);
+
+                _mux = open(deviceName, O_RDWR|O_NONBLOCK);
+
+                if (_mux == -1) {
+                    TRACE_L1("Could not open the stream filter[%s]: %d\n", deviceName, errno);
+                }
+                else {
+                    if (ioctl(_mux, DMX_SET_BUFFER_SIZE, BufferSize) < 0) {
+                        TRACE_L1("Could not set the stream buffer size to %d: %d\n", BufferSize, errno);
                     }
-                    else {
-                        _offset += loaded;
-                        if (_offset != 3) {
-                            moreToLoad = false;
-                        }
-                        else {
-                            _length = (_buffer[1] << 8) | (_buffer[2] & 0xFF);
-                            if ((_length + 3) > _size) {
-                                uint8_t copy = _buffer[0];
-                                ::free (_buffer);
-                                _size = _length + 3;
-                                _buffer = reinterpret_cast<uint8_t*>(::malloc(_size));
-                                _buffer[0] = copy;
-                                _buffer[1] = (_length >> 8) & 0xFF;
-                                _buffer[2] = _length & 0xFF;
-                            }
-                        }
+                    Core::ResourceMonitor::Instance().Register(*this);
+                }
+            }
+            ~StreamFilter() {
+                if (_mux != -1) {
+                    Core::ResourceMonitor::Instance().Unregister(*this);
+                    ::close(_mux);
+                }
+                ::free(_buffer);
+            }
+
+        public:
+            bool IsValid() const {
+                return (_mux != -1);
+            }
+            handle Descriptor() const override {
+                return (_mux);
+            }
+            uint16_t Events() override {
+                return (POLLIN);
+            }
+            void Handle(const uint16_t events) override {
+                int loaded;
+
+                // Stop at the first read that did not fill the buffer, the rest will be there on the next call.
+                do {
+                    loaded = ::read(_mux, _buffer, ReadSize);
+
+                    if (loaded > 0) {
+                        _demux.Process(_buffer, loaded);
+                    }
+                    else if ((loaded < 0) && (errno == EOVERFLOW)) {
+                        TRACE_L1("Stream filter overflow, sections in progress are lost.\n");
+                        _demux.Reset();
                     }
+                } while (loaded == static_cast<int>(ReadSize));
+            }
+            uint32_t Filter(const uint16_t pid, const uint8_t tableId, ISection* callback) {
+                uint32_t result = Core::ERROR_NONE;
+                std::map<uint16_t, uint16_t>::iterator index(_pids.find(pid));
+
+                if (callback == nullptr) {
+                    result = _demux.Filter(pid, tableId, nullptr);
+
+                    if ((result == Core::ERROR_NONE) && (--(index->second) == 0)) {
+                        ioctl(_mux, DMX_REMOVE_PID, &pid);
+                        _pids.erase(index);
+                    }
+                }
+                else if (index != _pids.end()) {
+                    _demux.Filter(pid, tableId, callback);
+
+                    // Only a table that was not filtered yet counts, a new callback for the same table does not.
+                    index->second = _demux.Tables(pid);
                 }
-                return (moreToLoad);
+                else if (Add(pid) == true) {
+                    _pids.emplace(pid, 1);
+                    _demux.Filter(pid, tableId, callback);
+                }
+                else {
+                    result = Core::ERROR_UNAVAILABLE;
+                }
+
+                return (result);
+            }
+            void Reset() {
+                _demux.Reset();
             }
- 
 
         private:
+            bool Add(uint16_t pid) {
+                bool added;
+
+                if (_pids.empty() == true) {
+                    struct dmx_pes_filter_params pesFilterParams;
+
+                    pesFilterParams.pid = pid;
+                    pesFilterParams.input = DMX_IN_FRONTEND;
+                    pesFilterParams.output = DMX_OUT_TSDEMUX_TAP;
+                    pesFilterParams.pes_type = DMX_PES_OTHER;
+                    pesFilterParams.flags = DMX_IMMEDIATE_START;
+
+                    added = (ioctl(_mux, DMX_SET_PES_FILTER, &pesFilterParams) >= 0);
+                }
+                else {
+                    added = (ioctl(_mux, DMX_ADD_PID, &pid) >= 0);
+                }
+
+                if (added == false) {
+                    TRACE_L1("Could not add PID %d to the stream filter: %d\n", pid, errno);
+                }
+
+                return (added);
+            }
+
+        private:
+            static constexpr uint32_t BufferSize = 256 * 1024;
+            static constexpr uint32_t ReadSize = 348 * TransportDemux::PacketSize;
+
             int _mux;
-            uint16_t _offset;
-            uint16_t _length;
-            uint16_t _size;
             uint8_t* _buffer;
-            ISection* _callback;
+            std::map<uint16_t, uint16_t> _pids;
+            TransportDemux _demux;
         };
 
     public:
@@ -353,6 +440,7 @@ static constexpr conversion_entry _tableRollOff[] = {
                     , Modus(ITuner::Terrestrial)
                     , Scan(false)
                     , Callsign("Streamer")
+                    , Stream(true)
                 {
                     Add(_T("frontends"), &Frontends);
                     Add(_T("decoders"), &Decoders);
@@ -361,6 +449,7 @@ static constexpr conversion_entry _tableRollOff[] = {
                     Add(_T("modus"), &Modus); 
                     Add(_T("scan"), &Scan);
                     Add(_T("callsign"), &Callsign);
+                    Add(_T("stream"), &Stream);
                 }
                 ~Config()
                 {
@@ -374,6 +463,7 @@ static constexpr conversion_entry _tableRollOff[] = {
                 Core::JSON::EnumType<ITuner::modus> Modus; 
                 Core::JSON::Boolean Scan;
                 Core::JSON::String Callsign;
+                Core::JSON::Boolean Stream;
             };
 
             Information()
@@ -383,6 +473,7 @@ static constexpr conversion_entry _tableRollOff[] = {
                 , _modus()
                 , _type(SYS_UNDEFINED)
                 , _scan(false)
+                , _stream(false)
             {
             }
 
@@ -404,6 +495,7 @@ static constexpr conversion_entry _tableRollOff[] = {
                 _standard = config.Standard.Value();
                 _annex = config.Annex.Value();
                 _scan = config.Scan.Value();
+                _stream = config.Stream.Value();
                 _modus = config.Modus.Value();
 
                 _type = Convert(_tableSystemType, _standard | _modus | _annex, SYS_UNDEFINED);
@@ -440,6 +532,11 @@ static constexpr conversion_entry _tableRollOff[] = {
             {
                 return (_scan);
             }
+            // Collect the sections from the transport stream, instead of a demux filter per table.
+            inline bool Stream() const
+            {
+                return (_stream);
+            }
 
         private:
             uint8_t _frontends;
@@ -448,6 +545,7 @@ static constexpr conversion_entry _tableRollOff[] = {
             ITuner::modus _modus;
             int _type;
             bool _scan;
+            bool _stream;
 
             static Information _instance;
         };
@@ -462,6 +560,7 @@ static constexpr conversion_entry _tableRollOff[] = {
             , _info({ 0 })
             , _devicePath()
             , _frontindex(0)
+            , _stream(nullptr)
             , _callback(nullptr)
         {
             _callback = TunerAdministrator::Instance().Announce(this);
@@ -494,6 +593,15 @@ static constexpr conversion_entry _tableRollOff[] = {
                 _transmission = Convert(_tableTransmission, transmission, TRANSMISSION_MODE_AUTO);
                 _guard = Convert(_tableGuard, guard, GUARD_INTERVAL_AUTO);
                 _hierarchy = Convert(_tableHierarchy, hierarchy, HIERARCHY_AUTO);                
+
+                if ((_frontend != -1) && (Tuner::Information::Instance().Stream() == true)) {
+                    _stream = new StreamFilter(_devicePath, _frontindex);
+
+                    if (_stream->IsValid() == false) {
+                        delete _stream;
+                        _stream = nullptr;
+                    }
+                }
             }
         }
 
@@ -506,6 +614,13 @@ static constexpr conversion_entry _tableRollOff[] = {
 
             Detach(0);
 
+            _filters.clear();
+
+            if (_stream != nullptr) {
+                delete _stream;
+                _stream = nullptr;
+            }
+
             if (_frontend != -1) {
                 close(_frontend);
             }
@@ -613,6 +728,11 @@ static constexpr conversion_entry _tableRollOff[] = {
 
             _state = IDLE;
 
+            if (_stream != nullptr) {
+                // Whatever was collected belongs to the previous transport stream.
+                _stream->Reset();
+            }
+
             if (ioctl(_frontend, FE_SET_PROPERTY, &dtv_prop) == -1) {
                 perror("ioctl");
             } else {
@@ -658,7 +778,10 @@ static constexpr conversion_entry _tableRollOff[] = {
  
             _state.Lock();
 
-            if (callback != nullptr) { 
+            if ((_stream != nullptr) && (_stream->Filter(pid, tableId, callback) == Core::ERROR_NONE)) {
+                result = Core::ERROR_NONE;
+            } else if (callback != nullptr) { 
+                // The stream could not take this PID, fall back to a filter on the demux.
                 auto entry = _filters.emplace(
                                  std::piecewise_construct, 
                                  std::forward_as_tuple(id), 
@@ -778,6 +901,7 @@ static constexpr conversion_entry _tableRollOff[] = {
         std::map<uint32_t,MuxFilter> _filters;
         string _devicePath;
         uint8_t _frontindex;
+        StreamFilter* _stream;
         TunerAdministrator::ICallback* _callback;
         #ifdef __DEBUG__
         unsigned int _lastState;
@@ -138,6 +138,7 @@ namespace Broadcast {
             }
             inline uint16_t TableId() const { return (_tableId); }
             inline uint16_t Extension() const { return (_extension); }
+            inline uint8_t Version() const { return (_version); }
             template <typename TYPE>
             TYPE GetNumber(const uint16_t offset) const
             {
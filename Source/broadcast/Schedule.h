@@ -4,6 +4,7 @@
 #include "Definitions.h"
 #include "Descriptors.h"
 #include "EIT.h"
+#include "TableStore.h"
 
 namespace WPEFramework {
 
@@ -95,15 +96,17 @@ namespace Broadcast {
 
                 ASSERT(section.IsValid());
 
-                if (section.TableId() == DVB::EIT::ACTUAL) {
+                if (_parent.IsStored(section) == true) {
+                    // Nothing changed since it was stored, no need to collect it again.
+                } else if (section.TableId() == DVB::EIT::ACTUAL) {
                     _actual.AddSection(section);
                     if (_actual.IsValid() == true) {
-                        _parent.Load(DVB::EIT(_actual));
+                        _parent.Load(_actual);
                     }
                 } else if (section.TableId() == DVB::EIT::OTHER) {
                     _others.AddSection(section);
                     if (_others.IsValid() == true) {
-                        _parent.Load(DVB::EIT(_others));
+                        _parent.Load(_others);
                     }
                 }
             }
@@ -123,6 +126,18 @@ namespace Broadcast {
             , _scanners()
             , _sink(*this)
             , _scan(true)
+            , _store(nullptr)
+        {
+            ITuner::Register(&_sink);
+        }
+        // Only the tables of which the version changed since they were stored are collected again.
+        // Without a store, as above, nothing is persisted; the owner of the tuner decides where the store lives.
+        Schedules(TableStore& store)
+            : _adminLock()
+            , _scanners()
+            , _sink(*this)
+            , _scan(true)
+            , _store(&store)
         {
             ITuner::Register(&_sink);
         }
@@ -179,6 +194,24 @@ namespace Broadcast {
 
             _adminLock.Unlock();
         }
+        // The EIT extension is the service id, its data starts with the transport stream and
+        // original network id.
+        static TableStore::Key Key(const uint8_t tableId, const uint16_t extension, const Core::DataElement& data)
+        {
+            return (TableStore::Key(tableId, extension, (data.Size() >= 4 ? data.GetNumber<uint16_t, Core::ENDIAN_BIG>(2) : static_cast<uint16_t>(~0)), (data.Size() >= 2 ? data.GetNumber<uint16_t, Core::ENDIAN_BIG>(0) : static_cast<uint16_t>(~0))));
+        }
+        bool IsStored(const MPEG::Section& section) const
+        {
+            return ((_store != nullptr) && (_store->IsCurrent(Key(section.TableId(), section.Extension(), section.Data()), section.Version()) == true));
+        }
+        void Load(const MPEG::Table& table)
+        {
+            if (_store != nullptr) {
+                _store->Update(Key(static_cast<uint8_t>(table.TableId()), table.Extension(), table.Data()), table.Version(), table.Data());
+            }
+
+            Load(DVB::EIT(table));
+        }
         void Load(const DVB::EIT& table)
         {
             _adminLock.Lock();
@@ -191,6 +224,7 @@ namespace Broadcast {
         Scanners _scanners;
         Sink _sink;
         bool _scan;
+        TableStore* _store;
     };
 
 } // namespace Broadcast
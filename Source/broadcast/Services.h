@@ -4,6 +4,7 @@
 #include "Definitions.h"
 #include "Descriptors.h"
 #include "SDT.h"
+#include "TableStore.h"
 
 namespace WPEFramework {
 
@@ -95,15 +96,17 @@ namespace Broadcast {
 
                 ASSERT(section.IsValid());
 
-                if (section.TableId() == DVB::SDT::ACTUAL) {
+                if (_parent.IsStored(section) == true) {
+                    // Nothing changed since it was stored, no need to collect it again.
+                } else if (section.TableId() == DVB::SDT::ACTUAL) {
                     _actual.AddSection(section);
                     if (_actual.IsValid() == true) {
-                        _parent.Load(DVB::SDT(_actual));
+                        _parent.Load(_actual);
                     }
                 } else if (section.TableId() == DVB::SDT::OTHER) {
                     _others.AddSection(section);
                     if (_others.IsValid() == true) {
-                        _parent.Load(DVB::SDT(_others));
+                        _parent.Load(_others);
                     }
                 }
             }
@@ -205,9 +208,26 @@ namespace Broadcast {
             , _sink(*this)
             , _scan(true)
             , _services()
+            , _store(nullptr)
         {
             ITuner::Register(&_sink);
         }
+        // The services found earlier are loaded from the store right away, only the tables
+        // of which the version changed are collected and stored again. Without a store, as
+        // above, nothing is persisted; the owner of the tuner decides where the store lives.
+        Services(TableStore& store)
+            : _adminLock()
+            , _scanners()
+            , _sink(*this)
+            , _scan(true)
+            , _services()
+            , _store(&store)
+        {
+            _store->Load(DVB::SDT::ACTUAL, [this](const TableStore::Key& key, const uint8_t, const Core::DataElement& table) { Load(DVB::SDT(key.Transport(), table)); });
+            _store->Load(DVB::SDT::OTHER, [this](const TableStore::Key& key, const uint8_t, const Core::DataElement& table) { Load(DVB::SDT(key.Transport(), table)); });
+
+            ITuner::Register(&_sink);
+        }
         virtual ~Services()
         {
             ITuner::Unregister(&_sink);
@@ -283,6 +303,23 @@ namespace Broadcast {
 
             _adminLock.Unlock();
         }
+        // The SDT starts with the original network id, its extension is the transport stream id.
+        static TableStore::Key Key(const uint8_t tableId, const uint16_t extension, const Core::DataElement& data)
+        {
+            return (TableStore::Key(tableId, extension, (data.Size() >= 2 ? data.GetNumber<uint16_t, Core::ENDIAN_BIG>(0) : static_cast<uint16_t>(~0)), extension));
+        }
+        bool IsStored(const MPEG::Section& section) const
+        {
+            return ((_store != nullptr) && (_store->IsCurrent(Key(section.TableId(), section.Extension(), section.Data()), section.Version()) == true));
+        }
+        void Load(const MPEG::Table& table)
+        {
+            if (_store != nullptr) {
+                _store->Update(Key(static_cast<uint8_t>(table.TableId()), table.Extension(), table.Data()), table.Version(), table.Data());
+            }
+
+            Load(DVB::SDT(table));
+        }
         void Load(const DVB::SDT& table)
         {
             _adminLock.Lock();
@@ -302,6 +339,7 @@ namespace Broadcast {
         Sink _sink;
         bool _scan;
         ServiceMap _services;
+        TableStore* _store;
     };
 
 } // namespace Broadcast
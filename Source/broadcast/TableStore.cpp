@@ -0,0 +1,227 @@
+#include "TableStore.h"
+
+namespace WPEFramework {
+
+namespace Broadcast {
+
+    static constexpr uint32_t InitialStoreSize = (64 * 1024);
+
+    static uint32_t StorageMode(const string& fileName)
+    {
+        // Creating the file truncates it, only do that if there is nothing to load.
+        return (Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE | (Core::File(fileName).Exists() == true ? 0 : static_cast<uint32_t>(Core::File::CREATE)));
+    }
+
+    static string CompactionName(const string& fileName)
+    {
+        return (fileName + _T(".compact"));
+    }
+
+    TableStore::TableStore(const string& fileName)
+        : _adminLock()
+        , _fileName(fileName)
+        , _storage(nullptr)
+        , _index()
+    {
+        // Left behind by a compaction that did not complete, the store itself is still as it was.
+        Core::File(CompactionName(_fileName)).Destroy();
+
+        Open();
+    }
+
+    TableStore::~TableStore()
+    {
+        delete _storage;
+    }
+
+    bool TableStore::IsCurrent(const Key& key, const uint8_t version) const
+    {
+        _adminLock.Lock();
+
+        Index::const_iterator index(_index.find(key));
+        bool result = ((index != _index.end()) && (Entry(index->second)->Version == version));
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    bool TableStore::Update(const Key& key, const uint8_t version, const Core::DataElement& table)
+    {
+        bool result = false;
+
+        ASSERT(version != Superseded);
+
+        _adminLock.Lock();
+
+        if (IsValid() == true) {
+            Index::iterator index(_index.find(key));
+
+            if ((index == _index.end()) || (Entry(index->second)->Version != version)) {
+                const uint32_t length = static_cast<uint32_t>(table.Size());
+                const uint32_t size = (sizeof(Record) + length + 3) & (~3);
+
+                if ((Administration()->Used + size) > _storage->Size()) {
+                    if (Administration()->Superseded > (Administration()->Used / 2)) {
+                        Compact();
+                    }
+                    if ((IsValid() == true) && ((Administration()->Used + size) > _storage->Size())) {
+                        // Grows the file, the mapping might move. Doubling it keeps a stream of updates from
+                        // remapping the file for every table.
+                        _storage->Size(std::max(static_cast<uint64_t>(Administration()->Used) + size, 2 * _storage->Size()));
+                    }
+                }
+
+                if ((IsValid() == true) && ((Administration()->Used + size) <= _storage->Size())) {
+                    const uint32_t offset = Administration()->Used;
+                    Record* record = Entry(offset);
+
+                    record->Size = size;
+                    record->Network = key.Network();
+                    record->Transport = key.Transport();
+                    record->Extension = key.Extension();
+                    record->TableId = key.TableId();
+                    record->Version = version;
+                    record->Length = length;
+                    ::memcpy(&(reinterpret_cast<uint8_t*>(record)[sizeof(Record)]), table.Buffer(), length);
+
+                    // Only now it is complete, account for it.
+                    Administration()->Used += size;
+
+                    // The new version is there, the previous one can go. Compacting rebuilt the index, look it up again.
+                    index = _index.find(key);
+
+                    if (index != _index.end()) {
+                        Entry(index->second)->Version = Superseded;
+                        Administration()->Superseded += Entry(index->second)->Size;
+                        index->second = offset;
+                    } else {
+                        _index.emplace(key, offset);
+                    }
+
+                    result = true;
+                }
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    void TableStore::Open()
+    {
+        _index.clear();
+
+        _storage = new Core::DataElementFile(_fileName, StorageMode(_fileName), InitialStoreSize);
+
+        if (_storage->IsValid() == true) {
+            if ((_storage->Size() < sizeof(Header)) || (Administration()->Magic != Magic) || (Administration()->Format != Format) || (Administration()->Used < sizeof(Header)) || (Administration()->Used > _storage->Size())) {
+                TRACE_L1("Table store %s is not usable, starting with an empty one.", _fileName.c_str());
+                Initialize();
+            } else {
+                Header* header = Administration();
+                uint32_t offset = sizeof(Header);
+
+                while ((offset + sizeof(Record)) <= header->Used) {
+                    Record* record = Entry(offset);
+
+                    if ((record->Size < sizeof(Record)) || ((offset + record->Size) > header->Used) || ((sizeof(Record) + record->Length) > record->Size)) {
+                        // Written partially, the rest can not be trusted.
+                        TRACE_L1("Table store %s is cut off at %d bytes.", _fileName.c_str(), offset);
+                        header->Used = offset;
+                    } else {
+                        if (record->Version != Superseded) {
+                            const Key key(record->TableId, record->Extension, record->Network, record->Transport);
+                            Index::iterator index(_index.find(key));
+
+                            if (index != _index.end()) {
+                                // Stopped before the previous version was marked, the last one written wins.
+                                Entry(index->second)->Version = Superseded;
+                                header->Superseded += Entry(index->second)->Size;
+                                index->second = offset;
+                            } else {
+                                _index.emplace(key, offset);
+                            }
+                        }
+                        offset += record->Size;
+                    }
+                }
+            }
+        }
+    }
+
+    void TableStore::Initialize()
+    {
+        if (_storage->Size() < InitialStoreSize) {
+            _storage->Size(InitialStoreSize);
+        }
+
+        Header* header = Administration();
+
+        header->Magic = Magic;
+        header->Format = Format;
+        header->Reserved = 0;
+        header->Used = sizeof(Header);
+        header->Superseded = 0;
+
+        _index.clear();
+    }
+
+    // The current records are written to a new file, which replaces the store only once it is complete.
+    bool TableStore::Compact()
+    {
+        const string compacted(CompactionName(_fileName));
+        const Header* header = Administration();
+        bool result = false;
+
+        {
+            Core::DataElementFile target(compacted, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE | Core::File::CREATE,
+                std::max(InitialStoreSize, header->Used - header->Superseded));
+
+            if ((target.IsValid() == true) && (target.Size() >= (header->Used - header->Superseded))) {
+                uint32_t offset = sizeof(Header);
+                uint32_t destination = sizeof(Header);
+
+                while (offset < header->Used) {
+                    const Record* record = Entry(offset);
+
+                    if (record->Version != Superseded) {
+                        ::memcpy(&(target.Buffer()[destination]), record, record->Size);
+                        destination += record->Size;
+                    }
+
+                    offset += record->Size;
+                }
+
+                Header* replacement = reinterpret_cast<Header*>(target.Buffer());
+
+                replacement->Magic = Magic;
+                replacement->Format = Format;
+                replacement->Reserved = 0;
+                replacement->Used = destination;
+                replacement->Superseded = 0;
+
+                target.Sync();
+
+                result = true;
+            }
+        }
+
+        delete _storage;
+        _storage = nullptr;
+
+        if ((result == false) || (Core::File(compacted).Move(_fileName) == false)) {
+            TRACE_L1("Could not compact table store %s.", _fileName.c_str());
+            Core::File(compacted).Destroy();
+            result = false;
+        }
+
+        // Either the compacted or the untouched store.
+        Open();
+
+        return (result);
+    }
+
+} // namespace Broadcast
+} // namespace WPEFramework
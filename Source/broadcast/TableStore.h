@@ -0,0 +1,189 @@
+#ifndef BROADCAST_TABLE_STORE_H
+#define BROADCAST_TABLE_STORE_H
+
+#include "MPEGSection.h"
+#include "Module.h"
+
+namespace WPEFramework {
+
+namespace Broadcast {
+
+    // Keeps the tables collected from the sections (SDT, EIT, ...) in a memory mapped file, so they
+    // are available right after a restart and only the tables of which the version changed have to
+    // be collected again. Every table is kept as the payload MPEG::Table collected, the classes that
+    // interpret a table (DVB::SDT, DVB::EIT) can be created on top of it.
+    // Records are appended, a record is only marked superseded once its newer version is written. Once
+    // the file has more superseded than current records, the current ones are written to a new file that
+    // replaces this one, so a crash while compacting leaves the previous file as it was.
+    // The store is opt-in: only Services and Schedules constructed with a TableStore use it.
+    class EXTERNAL TableStore {
+    private:
+        TableStore() = delete;
+        TableStore(const TableStore&) = delete;
+        TableStore& operator=(const TableStore&) = delete;
+
+        static constexpr uint32_t Magic = 0x54425354; // "TBST"
+        static constexpr uint16_t Format = 1;
+        static constexpr uint8_t Superseded = 0xFF;
+
+        struct Header {
+            uint32_t Magic;
+            uint16_t Format;
+            uint16_t Reserved;
+            uint32_t Used;
+            uint32_t Superseded;
+        };
+        struct Record {
+            uint32_t Size;
+            uint16_t Network;
+            uint16_t Transport;
+            uint16_t Extension;
+            uint8_t TableId;
+            uint8_t Version;
+            uint32_t Length;
+        };
+
+    public:
+        class Key {
+        public:
+            Key()
+                : _network(~0)
+                , _transport(~0)
+                , _extension(~0)
+                , _tableId(~0)
+            {
+            }
+            Key(const uint8_t tableId, const uint16_t extension, const uint16_t network, const uint16_t transport)
+                : _network(network)
+                , _transport(transport)
+                , _extension(extension)
+                , _tableId(tableId)
+            {
+            }
+            Key(const Key& copy)
+                : _network(copy._network)
+                , _transport(copy._transport)
+                , _extension(copy._extension)
+                , _tableId(copy._tableId)
+            {
+            }
+            ~Key()
+            {
+            }
+
+            Key& operator=(const Key& rhs)
+            {
+                _network = rhs._network;
+                _transport = rhs._transport;
+                _extension = rhs._extension;
+                _tableId = rhs._tableId;
+
+                return (*this);
+            }
+            bool operator<(const Key& rhs) const
+            {
+                return ((_tableId < rhs._tableId) || ((_tableId == rhs._tableId) && ((_extension < rhs._extension) || ((_extension == rhs._extension) && ((_network < rhs._network) || ((_network == rhs._network) && (_transport < rhs._transport)))))));
+            }
+
+        public:
+            inline uint8_t TableId() const
+            {
+                return (_tableId);
+            }
+            inline uint16_t Extension() const
+            {
+                return (_extension);
+            }
+            inline uint16_t Network() const
+            {
+                return (_network);
+            }
+            inline uint16_t Transport() const
+            {
+                return (_transport);
+            }
+
+        private:
+            uint16_t _network;
+            uint16_t _transport;
+            uint16_t _extension;
+            uint8_t _tableId;
+        };
+
+    private:
+        typedef std::map<Key, uint32_t> Index;
+
+    public:
+        TableStore(const string& fileName);
+        ~TableStore();
+
+    public:
+        inline bool IsValid() const
+        {
+            return ((_storage != nullptr) && (_storage->IsValid()));
+        }
+        inline uint32_t Tables() const
+        {
+            return (static_cast<uint32_t>(_index.size()));
+        }
+
+        // Is this version of the table stored already?
+        bool IsCurrent(const Key& key, const uint8_t version) const;
+
+        // Returns true if the table was not stored in this version.
+        bool Update(const Key& key, const uint8_t version, const Core::DataElement& table);
+
+        // The handler is called, with the lock taken, for every table with the given id:
+        // handler(const Key& key, const uint8_t version, const Core::DataElement& table).
+        // The DataElement is only valid during the call.
+        template <typename HANDLER>
+        void Load(const uint8_t tableId, HANDLER handler) const
+        {
+            _adminLock.Lock();
+
+            Index::const_iterator index(_index.lower_bound(Key(tableId, 0, 0, 0)));
+
+            while ((index != _index.end()) && (index->first.TableId() == tableId)) {
+                const Record* record = Entry(index->second);
+
+                handler(index->first, record->Version, Core::DataElement(record->Length, const_cast<uint8_t*>(&(reinterpret_cast<const uint8_t*>(record)[sizeof(Record)]))));
+
+                index++;
+            }
+
+            _adminLock.Unlock();
+        }
+
+    private:
+        inline Header* Administration()
+        {
+            return (reinterpret_cast<Header*>(_storage->Buffer()));
+        }
+        inline const Header* Administration() const
+        {
+            return (reinterpret_cast<const Header*>(_storage->Buffer()));
+        }
+        inline Record* Entry(const uint32_t offset)
+        {
+            return (reinterpret_cast<Record*>(&(_storage->Buffer()[offset])));
+        }
+        inline const Record* Entry(const uint32_t offset) const
+        {
+            return (reinterpret_cast<const Record*>(&(_storage->Buffer()[offset])));
+        }
+
+        void Open();
+        void Initialize();
+        bool Compact();
+
+    private:
+        mutable Core::CriticalSection _adminLock;
+        const string _fileName;
+        Core::DataElementFile* _storage;
+        Index _index;
+    };
+
+} // namespace Broadcast
+} // namespace WPEFramework
+
+#endif // BROADCAST_TABLE_STORE_H
@@ -0,0 +1,239 @@
+#include "TransportDemux.h"
+
+namespace WPEFramework {
+
+namespace Broadcast {
+
+    TransportDemux::TransportDemux()
+        : _adminLock()
+        , _streams()
+        , _filters()
+        , _section()
+        , _pending(0)
+        , _packets(0)
+        , _sections(0)
+        , _dropped(0)
+    {
+    }
+
+    TransportDemux::~TransportDemux()
+    {
+    }
+
+    uint32_t TransportDemux::Filter(const uint16_t pid, const uint8_t tableId, ISection* callback)
+    {
+        uint32_t result = Core::ERROR_NONE;
+        const uint32_t id = (pid << 16) | tableId;
+
+        _adminLock.Lock();
+
+        Filters::iterator index(_filters.find(id));
+
+        if (callback != nullptr) {
+            if (index != _filters.end()) {
+                index->second = callback;
+            } else {
+                Stream& stream(_streams[pid]);
+
+                _filters.emplace(id, callback);
+
+                if (stream.Tables++ == 0) {
+                    stream.Section.reserve(1024);
+                }
+            }
+        } else if (index == _filters.end()) {
+            result = Core::ERROR_UNAVAILABLE;
+        } else {
+            Stream& stream(_streams[pid]);
+
+            _filters.erase(index);
+
+            // If this was the last table on this PID, stop collecting its sections.
+            if (--stream.Tables == 0) {
+                stream.Section.clear();
+                stream.Continuity = ~0;
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    uint16_t TransportDemux::Tables(const uint16_t pid) const
+    {
+        _adminLock.Lock();
+
+        Streams::const_iterator index(_streams.find(pid));
+        const uint16_t result = (index != _streams.end() ? index->second.Tables : 0);
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    uint32_t TransportDemux::Process(const uint8_t data[], const uint32_t length)
+    {
+        uint32_t offset = 0;
+        uint32_t count = 0;
+
+        _adminLock.Lock();
+
+        if (_pending > 0) {
+            const uint8_t size = static_cast<uint8_t>(std::min(static_cast<uint32_t>(PacketSize - _pending), length));
+
+            ::memcpy(&(_partial[_pending]), data, size);
+            _pending += size;
+            offset = size;
+
+            if (_pending == PacketSize) {
+                Packet(_partial);
+                _pending = 0;
+                count++;
+            }
+        }
+
+        while (offset < length) {
+            if (data[offset] != SyncByte) {
+                // Lost track of the packets, continue at the next sync byte.
+                const uint8_t* sync = reinterpret_cast<const uint8_t*>(::memchr(&(data[offset]), SyncByte, length - offset));
+
+                offset = (sync == nullptr ? length : static_cast<uint32_t>(sync - data));
+            } else if ((length - offset) < PacketSize) {
+                _pending = static_cast<uint8_t>(length - offset);
+                ::memcpy(_partial, &(data[offset]), _pending);
+                offset = length;
+            } else {
+                Packet(&(data[offset]));
+                offset += PacketSize;
+                count++;
+            }
+        }
+
+        _packets += count;
+
+        _adminLock.Unlock();
+
+        return (count);
+    }
+
+    void TransportDemux::Reset()
+    {
+        _adminLock.Lock();
+
+        for (std::pair<const uint16_t, Stream>& entry : _streams) {
+            entry.second.Section.clear();
+            entry.second.Continuity = ~0;
+        }
+
+        _pending = 0;
+
+        _adminLock.Unlock();
+    }
+
+    void TransportDemux::Packet(const uint8_t packet[])
+    {
+        const uint16_t pid = ((packet[1] & 0x1F) << 8) | packet[2];
+        Streams::iterator index(_streams.find(pid));
+
+        // Skip PIDs nobody is interested in, packets with an uncorrectable error and packets without payload.
+        if ((index != _streams.end()) && (index->second.Tables > 0) && ((packet[1] & 0x80) == 0) && ((packet[3] & 0x10) != 0)) {
+            Stream& stream(index->second);
+            const uint8_t continuity = (packet[3] & 0x0F);
+
+            // A repeated packet carries nothing new.
+            if (continuity != stream.Continuity) {
+                uint16_t offset = ((packet[3] & 0x20) != 0 ? 5 + packet[4] : 4);
+
+                if ((continuity != ((stream.Continuity + 1) & 0x0F)) && (stream.Section.empty() == false)) {
+                    // A packet went missing, the section it was part of is lost.
+                    stream.Section.clear();
+                    _dropped++;
+                }
+
+                stream.Continuity = continuity;
+
+                if (offset >= PacketSize) {
+                    // Only an adaptation field (or a broken one), nothing to collect.
+                } else if ((packet[1] & 0x40) == 0) {
+                    if (stream.Section.empty() == false) {
+                        Assemble(pid, stream, &(packet[offset]), PacketSize - offset);
+                    }
+                } else {
+                    // The pointer field tells where the first new section starts, before it is the
+                    // tail of the section in progress.
+                    const uint8_t pointer = packet[offset++];
+
+                    if ((offset + pointer) > PacketSize) {
+                        stream.Section.clear();
+                    } else {
+                        if (stream.Section.empty() == false) {
+                            Assemble(pid, stream, &(packet[offset]), pointer);
+
+                            if (stream.Section.empty() == false) {
+                                stream.Section.clear();
+                                _dropped++;
+                            }
+                        }
+
+                        offset += pointer;
+
+                        // A table id of 0xFF is stuffing, there are no more sections in this packet.
+                        while ((offset < PacketSize) && (packet[offset] != 0xFF)) {
+                            offset += Assemble(pid, stream, &(packet[offset]), PacketSize - offset);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Returns the number of bytes that were part of the section in progress.
+    uint16_t TransportDemux::Assemble(const uint16_t pid, Stream& stream, const uint8_t data[], const uint16_t length)
+    {
+        std::vector<uint8_t>& section(stream.Section);
+        uint16_t used = 0;
+
+        if (section.size() < 3) {
+            used = std::min(static_cast<uint16_t>(3 - section.size()), length);
+            section.insert(section.end(), data, &(data[used]));
+        }
+
+        if (section.size() >= 3) {
+            const uint16_t total = 3 + (((section[1] & 0x0F) << 8) | section[2]);
+            const uint16_t size = std::min(static_cast<uint16_t>(total - section.size()), static_cast<uint16_t>(length - used));
+
+            section.insert(section.end(), &(data[used]), &(data[used + size]));
+            used += size;
+
+            if (section.size() == total) {
+                Deliver(pid, stream);
+            }
+        }
+
+        return (used);
+    }
+
+    void TransportDemux::Deliver(const uint16_t pid, Stream& stream)
+    {
+        // Hand out a section the stream no longer owns, the next one is collected in the buffer of
+        // the previous one.
+        _section.swap(stream.Section);
+        stream.Section.clear();
+
+        Filters::iterator index(_filters.find((pid << 16) | _section[0]));
+
+        if (index != _filters.end()) {
+            MPEG::Section newSection(Core::DataElement(_section.size(), _section.data()));
+
+            if (newSection.IsValid() == true) {
+                _sections++;
+                index->second->Handle(newSection);
+            } else {
+                _dropped++;
+            }
+        }
+    }
+
+} // namespace Broadcast
+} // namespace WPEFramework
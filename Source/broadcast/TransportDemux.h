@@ -0,0 +1,99 @@
+#ifndef BROADCAST_TRANSPORT_DEMUX_H
+#define BROADCAST_TRANSPORT_DEMUX_H
+
+#include "Definitions.h"
+#include "MPEGSection.h"
+#include "Module.h"
+
+namespace WPEFramework {
+
+namespace Broadcast {
+
+    // Collects the sections from a transport stream. The stream is offered in chunks of any size,
+    // a packet that is cut off at the end of a chunk is completed by the next one. Only the packets
+    // of the PIDs a filter is installed for are looked at, the sections carried by them are put
+    // together and every complete section with a valid CRC is offered on the ISection interface of
+    // the filter installed for its PID and table id.
+    // There is no dependency on a device, the stream can come from a demux tap, a recorded file, ...
+    class EXTERNAL TransportDemux {
+    private:
+        TransportDemux(const TransportDemux&) = delete;
+        TransportDemux& operator=(const TransportDemux&) = delete;
+
+        static constexpr uint8_t SyncByte = 0x47;
+
+        // Once seen, a PID keeps its entry, so a callback can change the filters while it is called.
+        struct Stream {
+            Stream()
+                : Section()
+                , Tables(0)
+                , Continuity(~0)
+            {
+            }
+
+            std::vector<uint8_t> Section;
+            uint16_t Tables;
+            uint8_t Continuity;
+        };
+
+        typedef std::map<uint16_t, Stream> Streams;
+        typedef std::map<uint32_t, ISection*> Filters;
+
+    public:
+        static constexpr uint8_t PacketSize = 188;
+
+        TransportDemux();
+        ~TransportDemux();
+
+    public:
+        inline bool HasFilters() const
+        {
+            return (_filters.empty() == false);
+        }
+        inline uint32_t Packets() const
+        {
+            return (_packets);
+        }
+        inline uint32_t Sections() const
+        {
+            return (_sections);
+        }
+        // Sections dropped because packets were missing or the CRC did not match.
+        inline uint32_t Dropped() const
+        {
+            return (_dropped);
+        }
+
+        // Same as ITuner::Filter, a nullptr callback removes the filter.
+        uint32_t Filter(const uint16_t pid, const uint8_t tableId, ISection* callback);
+
+        // The number of tables filtered on the PID, a new callback for a table does not add one.
+        uint16_t Tables(const uint16_t pid) const;
+
+        // Returns the number of packets handled. The callbacks are called on this thread.
+        uint32_t Process(const uint8_t data[], const uint32_t length);
+
+        // Forget what was collected, e.g. after tuning to another transport stream.
+        void Reset();
+
+    private:
+        void Packet(const uint8_t packet[]);
+        uint16_t Assemble(const uint16_t pid, Stream& stream, const uint8_t data[], const uint16_t length);
+        void Deliver(const uint16_t pid, Stream& stream);
+
+    private:
+        mutable Core::CriticalSection _adminLock;
+        Streams _streams;
+        Filters _filters;
+        std::vector<uint8_t> _section;
+        uint8_t _partial[PacketSize];
+        uint8_t _pending;
+        uint32_t _packets;
+        uint32_t _sections;
+        uint32_t _dropped;
+    };
+
+} // namespace Broadcast
+} // namespace WPEFramework
+
+#endif // BROADCAST_TRANSPORT_DEMUX_H
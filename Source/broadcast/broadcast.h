@@ -13,8 +13,10 @@
 #include "ProgramTable.h"
 #include "SDT.h"
 #include "Services.h"
+#include "TableStore.h"
 #include "TDT.h"
 #include "TimeDate.h"
+#include "TransportDemux.h"
 
 #ifdef __WINDOWS__
 #pragma comment(lib, "broadcast.lib")
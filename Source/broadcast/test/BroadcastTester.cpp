@@ -14,8 +14,62 @@ void printHelp(){
     printf("q -> Quit\n");
 }
 
+// Offers a recorded transport stream to the demux, as the tuner would, and reports the SI sections found in it.
+int replay(const char fileName[])
+{
+    class Report : public Broadcast::ISection {
+    public:
+        Report() : Sections(0) {}
+        void Handle(const Broadcast::MPEG::Section& section) override {
+            printf("Table 0x%02X, extension %d, version %d, section %d/%d, %d bytes\n", section.TableId(), section.Extension(), section.Version(), section.SectionNumber(), section.LastSectionNumber(), section.Length());
+            Sections++;
+        }
+
+        uint32_t Sections;
+    };
+
+    FILE* file = fopen(fileName, "rb");
+
+    if (file == nullptr) {
+        printf("Could not open %s\n", fileName);
+        return 1;
+    }
+
+    static const struct { uint16_t pid; uint8_t tableId; } tables[] = {
+        { 0x00, 0x00 }, { 0x10, 0x40 }, { 0x10, 0x41 }, { 0x11, 0x42 }, { 0x11, 0x46 },
+        { 0x12, 0x4E }, { 0x12, 0x4F }, { 0x14, 0x70 }, { 0x14, 0x73 }
+    };
+
+    Broadcast::TransportDemux demux;
+    Report report;
+    uint8_t buffer[348 * Broadcast::TransportDemux::PacketSize];
+    size_t loaded;
+
+    for (const auto& table : tables) {
+        demux.Filter(table.pid, table.tableId, &report);
+    }
+
+    uint64_t start = Core::Time::Now().Ticks();
+
+    while ((loaded = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        demux.Process(buffer, static_cast<uint32_t>(loaded));
+    }
+
+    uint64_t duration = Core::Time::Now().Ticks() - start;
+
+    fclose(file);
+
+    printf("Packets: %d, sections: %d, dropped: %d in %d us\n", demux.Packets(), report.Sections, demux.Dropped(), static_cast<uint32_t>(duration));
+
+    return 0;
+}
+
 int main(int argc, const char* argv[])
 {
+    if (argc > 1) {
+        return (replay(argv[1]));
+    }
+
     const string configuration = "{ \
         frontends:1, \
         decoders:1, \
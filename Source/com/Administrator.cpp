@@ -9,7 +9,10 @@ namespace RPC {
         , _stubs()
         , _proxy()
         , _factory(8)
-        , _channelProxyMap()
+        , _proxies()
+        , _channelReferenceMap()
+        , _channelFrameMap()
+        , _channelOneWayMap()
     {
     }
 
@@ -17,6 +20,96 @@ namespace RPC {
     {
     }
 
+    void Administrator::ProxyTable::Shard::Place(const Entry& entry)
+    {
+        const uint32_t mask = static_cast<uint32_t>(_slots.size() - 1);
+        uint32_t index = (entry.Hash & mask);
+
+        while (_slots[index].Proxy != nullptr) {
+            index = ((index + 1) & mask);
+        }
+
+        _slots[index] = entry;
+    }
+
+    void Administrator::ProxyTable::Shard::Insert(const Core::IPCChannel* channel, void* impl, const uint32_t id, const uint32_t hash, ProxyStub::UnknownProxy* proxy)
+    {
+        // Keep it at most half full, so the probe sequences stay short.
+        if (((_count + 1) * 2) > _slots.size()) {
+            std::vector<Entry> slots(_slots.size() * 2);
+
+            slots.swap(_slots);
+
+            for (const Entry& entry : slots) {
+                if (entry.Proxy != nullptr) {
+                    Place(entry);
+                }
+            }
+        }
+
+        const Entry entry = { channel, impl, id, hash, proxy };
+
+        Place(entry);
+        _count++;
+    }
+
+    bool Administrator::ProxyTable::Shard::Remove(const uint32_t hash, const ProxyStub::UnknownProxy* proxy)
+    {
+        const uint32_t mask = static_cast<uint32_t>(_slots.size() - 1);
+        uint32_t index = (hash & mask);
+
+        while ((_slots[index].Proxy != nullptr) && (_slots[index].Proxy != proxy)) {
+            index = ((index + 1) & mask);
+        }
+
+        bool found = (_slots[index].Proxy != nullptr);
+
+        if (found == true) {
+            uint32_t gap = index;
+            uint32_t next = ((index + 1) & mask);
+
+            // Move back what follows, if the gap is between its home slot and where it is now,
+            // otherwise it could no longer be found.
+            while (_slots[next].Proxy != nullptr) {
+                const uint32_t home = (_slots[next].Hash & mask);
+
+                if (((next - home) & mask) >= ((next - gap) & mask)) {
+                    _slots[gap] = _slots[next];
+                    gap = next;
+                }
+                next = ((next + 1) & mask);
+            }
+
+            _slots[gap].Proxy = nullptr;
+            _count--;
+        }
+
+        return (found);
+    }
+
+    void Administrator::ProxyTable::Shard::Remove(const Core::IPCChannel* channel, std::list<ProxyStub::UnknownProxy*>& pendingProxies)
+    {
+        std::vector<Entry> slots(_slots.size());
+
+        slots.swap(_slots);
+        _count = 0;
+
+        for (const Entry& entry : slots) {
+            if (entry.Proxy == nullptr) {
+                // Empty slot
+            } else if (entry.Channel != channel) {
+                Place(entry);
+                _count++;
+            } else if (entry.Proxy->DropRegistration() == true) {
+                // There is a small possibility that the last reference to this proxy
+                // interface is released in the same time before we report this interface
+                // to be dead. So lets keep a refernce so we can work on a real object
+                // still. This race condition, was observed by customer testing.
+                pendingProxies.push_back(entry.Proxy);
+            }
+        }
+    }
+
     /* static */ Administrator& Administrator::Instance()
     {
         static Administrator systemAdministrator;
@@ -27,7 +120,7 @@ namespace RPC {
     void Administrator::AddRef(void* impl, const uint32_t interfaceId)
     {
         // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        std::map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
+        std::unordered_map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
 
         if (index != _stubs.end()) {
             Core::IUnknown* implementation(index->second->Convert(impl));
@@ -46,7 +139,7 @@ namespace RPC {
     void Administrator::Release(void* impl, const uint32_t interfaceId)
     {
         // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        std::map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
+        std::unordered_map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
 
         if (index != _stubs.end()) {
             Core::IUnknown* implementation(index->second->Convert(impl));
@@ -79,7 +172,7 @@ namespace RPC {
         uint32_t interfaceId(message->Parameters().InterfaceId());
 
         // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        std::map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
+        std::unordered_map<uint32_t, ProxyStub::UnknownStub*>::iterator index(_stubs.find(interfaceId));
 
         if (index != _stubs.end()) {
             uint32_t methodId(message->Parameters().MethodId());
@@ -93,72 +186,49 @@ namespace RPC {
     void Administrator::RegisterProxy(ProxyStub::UnknownProxy& proxy)
     {
         const Core::IPCChannel* channel = proxy.Channel().operator->();
+        const uint32_t hash = ProxyTable::Hash(channel, proxy.Implementation(), proxy.InterfaceId());
+        ProxyTable::Shard& shard(_proxies.Select(hash));
 
-        _adminLock.Lock();
-
-        ChannelMap::iterator index(_channelProxyMap.find(channel));
-
-        if (index == _channelProxyMap.end()) {
-            auto slot = _channelProxyMap.emplace(std::piecewise_construct,
-                std::forward_as_tuple(channel),
-                std::forward_as_tuple());
-            slot.first->second.push_back(&proxy);
+        shard.Lock();
 
-        } else {
-            ASSERT(std::find(index->second.begin(), index->second.end(), &proxy) == index->second.end());
+        ASSERT(shard.Find(channel, proxy.Implementation(), proxy.InterfaceId(), hash, [&proxy](const ProxyStub::UnknownProxy* entry) { return (entry == &proxy); }) == nullptr);
 
-            index->second.push_back(&proxy);
-        }
+        shard.Insert(channel, proxy.Implementation(), proxy.InterfaceId(), hash, &proxy);
 
         Core::InterlockedIncrement(proxy._refCount);
 
-        _adminLock.Unlock();
+        shard.Unlock();
     }
     void Administrator::UnregisterProxy(ProxyStub::UnknownProxy& proxy)
     {
-        _adminLock.Lock();
+        const uint32_t hash = ProxyTable::Hash(proxy.Channel().operator->(), proxy.Implementation(), proxy.InterfaceId());
+        ProxyTable::Shard& shard(_proxies.Select(hash));
 
-        ChannelMap::iterator index(_channelProxyMap.find(proxy.Channel().operator->()));
+        shard.Lock();
 
-        if (index != _channelProxyMap.end()) {
-            ProxyList::iterator entry(index->second.begin());
-            while ((entry != index->second.end()) && ((*entry) != &proxy)) {
-                entry++;
-            }
-            if (entry != index->second.end()) {
-                index->second.erase(entry);
-                Core::InterlockedDecrement(proxy._refCount);
-                if (index->second.size() == 0) {
-                    _channelProxyMap.erase(index);
-                }
-            } else {
-                TRACE_L1("Could not find the Proxy entry to be unregistered in the channel list.");
-            }
+        if (shard.Remove(hash, &proxy) == true) {
+            Core::InterlockedDecrement(proxy._refCount);
         } else {
-            TRACE_L1("Could not find the Proxy entry to be unregistered from a channel perspective.");
+            TRACE_L1("Could not find the Proxy entry to be unregistered.");
         }
 
-        _adminLock.Unlock();
+        shard.Unlock();
     }
     void* Administrator::ProxyFind(const Core::ProxyType<Core::IPCChannel>& channel, void* impl, const uint32_t id, const uint32_t interfaceId)
     {
         void* result = nullptr;
+        const uint32_t hash = ProxyTable::Hash(channel.operator->(), impl, id);
+        ProxyTable::Shard& shard(_proxies.Select(hash));
 
-        _adminLock.Lock();
+        shard.Lock();
 
-        ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
+        ProxyStub::UnknownProxy* entry = shard.Find(channel.operator->(), impl, id, hash, [](const ProxyStub::UnknownProxy*) { return (true); });
 
-        if (index != _channelProxyMap.end()) {
-            ProxyList::iterator entry(index->second.begin());
-            while ((entry != index->second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
-                entry++;
-            }
-            if (entry != index->second.end()) {
-                result = (*entry)->QueryInterface(interfaceId);
-            }
+        if (entry != nullptr) {
+            result = entry->QueryInterface(interfaceId);
         }
 
-        _adminLock.Unlock();
+        shard.Unlock();
 
         return (result);
     }
@@ -168,43 +238,47 @@ namespace RPC {
         ProxyStub::UnknownProxy* result = nullptr;
 
         if (impl != nullptr) {
+            const uint32_t hash = ProxyTable::Hash(channel.operator->(), impl, id);
+            ProxyTable::Shard& shard(_proxies.Select(hash));
 
-            _adminLock.Lock();
+            shard.Lock();
 
-            ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
-
-            if (index != _channelProxyMap.end()) {
-                ProxyList::iterator entry(index->second.begin());
-                while ((entry != index->second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
-                    entry++;
-                }
-                if (entry != index->second.end()) {
-                    result = (*entry);
+            if (refCounted == true) {
+                // A proxy that is being destructed can not be used, look for another one or create a new one.
+                result = shard.Find(channel.operator->(), impl, id, hash, [](ProxyStub::UnknownProxy* entry) { return (entry->AddRefCachedCount()); });
+            } else {
+                result = shard.Find(channel.operator->(), impl, id, hash, [](const ProxyStub::UnknownProxy*) { return (true); });
 
-                    if (refCounted == true) {
-                       if( (*entry)->AddRefCachedCount() == false ) {
-                           result = nullptr; // we cannot use this proxy it is being destructed, we need to create a new one
-                       }
-                    } else if (piggyBack == true) {
-                        // Reference counting can be cached on this on object for now. This is a request
-                        // from an incoming interface of which the lifetime is guaranteed by the callee.
-                        result->EnableCaching();
-                    }
+                if ((result != nullptr) && (piggyBack == true)) {
+                    // Reference counting can be cached on this on object for now. This is a request
+                    // from an incoming interface of which the lifetime is guaranteed by the callee.
+                    result->EnableCaching();
                 }
             }
 
             if (result == nullptr) {
-                std::map<uint32_t, IMetadata*>::iterator index(_proxy.find(id));
+                IMetadata* metadata = nullptr;
+
+                // Only the creation of a proxy needs the factories, they might be announced while running.
+                _adminLock.Lock();
+
+                std::unordered_map<uint32_t, IMetadata*>::iterator index(_proxy.find(id));
 
                 if (index != _proxy.end()) {
+                    metadata = index->second;
+                }
+
+                _adminLock.Unlock();
+
+                if (metadata != nullptr) {
 
-                    result = index->second->CreateProxy(channel, impl, refCounted);
+                    result = metadata->CreateProxy(channel, impl, refCounted);
 
                     ASSERT(result != nullptr);
 
                     if (refCounted == true) {
                         // Register it as it is remotely registered :-)
-                        _channelProxyMap[channel.operator->()].push_back(result);
+                        shard.Insert(channel.operator->(), impl, id, hash, result);
                     } else if (piggyBack == true) {
                         // Reference counting can be cached on this on object for now. This is a request
                         // from an incoming interface of which the lifetime is guaranteed by the callee.
@@ -215,7 +289,7 @@ namespace RPC {
                 }
             }
 
-            _adminLock.Unlock();
+            shard.Unlock();
         }
 
         return (result);
@@ -261,30 +335,23 @@ namespace RPC {
 
     Core::IUnknown* Administrator::Convert(void* rawImplementation, const uint32_t id) 
     {
-        std::map<uint32_t, ProxyStub::UnknownStub*>::const_iterator index (_stubs.find(id));
+        std::unordered_map<uint32_t, ProxyStub::UnknownStub*>::const_iterator index (_stubs.find(id));
         return(index != _stubs.end() ? index->second->Convert(rawImplementation) : nullptr);
     }
 
     void Administrator::DeleteChannel(const Core::ProxyType<Core::IPCChannel>& channel, std::list<ProxyStub::UnknownProxy*>& pendingProxies, std::list<ExposedInterface>& usedInterfaces)
     {
-        _adminLock.Lock();
-
-        ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
+        // A shard is locked before the administration lock (see ProxyInstance), so never while holding it.
+        for (uint8_t index = 0; index < _proxies.Shards(); index++) {
+            ProxyTable::Shard& shard(_proxies[index]);
 
-        if (index != _channelProxyMap.end()) {
-            ProxyList::iterator loop(index->second.begin());
-            while (loop != index->second.end()) {
-                // There is a small possibility that the last reference to this proxy
-                // interface is released in the same time before we report this interface
-                // to be dead. So lets keep a refernce so we can work on a real object
-                // still. This race condition, was observed by customer testing.
-                if( (*loop)->DropRegistration() == true ) {
-                    pendingProxies.push_back(*loop);
-                }
-                loop++;
-            }
-            _channelProxyMap.erase(index);
+            shard.Lock();
+            shard.Remove(channel.operator->(), pendingProxies);
+            shard.Unlock();
         }
+
+        _adminLock.Lock();
+
         ReferenceMap::iterator remotes(_channelReferenceMap.find(channel.operator->()));
 
         if (remotes != _channelReferenceMap.end()) {
@@ -296,7 +363,114 @@ namespace RPC {
             _channelReferenceMap.erase(remotes);
         }
 
+        FrameMap::iterator frames(_channelFrameMap.find(channel.operator->()));
+
+        if (frames != _channelFrameMap.end()) {
+            // Invokes still in progress keep their own reference to the pool, but nothing they stored will be loaded.
+            frames->second->Revoke();
+            _channelFrameMap.erase(frames);
+        }
+
+        _adminLock.Unlock();
+    }
+
+    bool Administrator::Attach(const Core::IPCChannel& channel, const string& name, const bool owner)
+    {
+        bool result = true;
+
+        _adminLock.Lock();
+
+        if (_channelFrameMap.find(&channel) == _channelFrameMap.end()) {
+            Core::ProxyType<Data::FramePool> frames(Core::ProxyType<Data::FramePool>::Create(name, owner));
+
+            if (frames->IsValid() == true) {
+                _channelFrameMap.emplace(&channel, frames);
+            } else {
+                result = false;
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    void Administrator::Detach(const Core::IPCChannel& channel)
+    {
+        _adminLock.Lock();
+
+        FrameMap::iterator frames(_channelFrameMap.find(&channel));
+
+        if (frames != _channelFrameMap.end()) {
+            // Invokes still in progress keep their own reference to the pool, but nothing they stored will be loaded.
+            frames->second->Revoke();
+            _channelFrameMap.erase(frames);
+        }
+
+        _adminLock.Unlock();
+    }
+
+    Core::ProxyType<Data::FramePool> Administrator::Frames(const Core::IPCChannel& channel)
+    {
+        Core::ProxyType<Data::FramePool> result;
+
+        _adminLock.Lock();
+
+        FrameMap::iterator index(_channelFrameMap.find(&channel));
+
+        if (index != _channelFrameMap.end()) {
+            result = index->second;
+        }
+
         _adminLock.Unlock();
+
+        return (result);
+    }
+
+    bool Administrator::Enqueue(const Core::IPCChannel& channel, const Core::ProxyType<Core::IIPC>& message)
+    {
+        bool result = false;
+
+        _adminLock.Lock();
+
+        OneWayMap::iterator index(_channelOneWayMap.find(&channel));
+
+        if (index != _channelOneWayMap.end()) {
+            index->second.push_back(message);
+            result = true;
+        } else {
+            // Nothing is queued, but from now on the channel has a one-way invoke in progress.
+            _channelOneWayMap.emplace(std::piecewise_construct,
+                std::forward_as_tuple(&channel),
+                std::forward_as_tuple());
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    bool Administrator::Dequeue(const Core::IPCChannel& channel, Core::ProxyType<Core::IIPC>& message)
+    {
+        bool result = false;
+
+        _adminLock.Lock();
+
+        OneWayMap::iterator index(_channelOneWayMap.find(&channel));
+
+        if (index != _channelOneWayMap.end()) {
+            if (index->second.empty() == true) {
+                _channelOneWayMap.erase(index);
+            } else {
+                message = index->second.front();
+                index->second.pop_front();
+                result = true;
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
     }
 
     /* static */ Administrator& Job::_administrator= Administrator::Instance();
@@ -83,9 +83,122 @@ namespace RPC {
             std::atomic<uint32_t> _refCount;
         };
 
-        typedef std::list<ProxyStub::UnknownProxy*> ProxyList;
-        typedef std::map<const Core::IPCChannel*, ProxyList> ChannelMap;
+        // Every interface pointer that crosses a channel is looked up by channel, implementation and
+        // interface. The proxies are spread over a number of shards, each with its own lock and an
+        // open addressed table (linear probing, entries are moved back on removal, no tombstones).
+        class ProxyTable {
+        private:
+            ProxyTable(const ProxyTable&) = delete;
+            ProxyTable& operator=(const ProxyTable&) = delete;
+
+            static constexpr uint8_t ShardBits = 4;
+            static constexpr uint32_t InitialSlots = 16;
+
+            struct Entry {
+                const Core::IPCChannel* Channel;
+                void* Implementation;
+                uint32_t InterfaceId;
+                uint32_t Hash;
+                ProxyStub::UnknownProxy* Proxy;
+            };
+
+        public:
+            class Shard {
+            private:
+                Shard(const Shard&) = delete;
+                Shard& operator=(const Shard&) = delete;
+
+            public:
+                Shard()
+                    : _lock()
+                    , _slots(InitialSlots)
+                    , _count(0)
+                {
+                }
+                ~Shard()
+                {
+                }
+
+            public:
+                inline void Lock() const
+                {
+                    _lock.Lock();
+                }
+                inline void Unlock() const
+                {
+                    _lock.Unlock();
+                }
+                // The first proxy on this key the accept call agrees with, the shard must be locked.
+                template <typename ACCEPT>
+                ProxyStub::UnknownProxy* Find(const Core::IPCChannel* channel, void* impl, const uint32_t id, const uint32_t hash, ACCEPT accept) const
+                {
+                    ProxyStub::UnknownProxy* result = nullptr;
+                    const uint32_t mask = static_cast<uint32_t>(_slots.size() - 1);
+                    uint32_t index = (hash & mask);
+
+                    while ((result == nullptr) && (_slots[index].Proxy != nullptr)) {
+                        const Entry& entry(_slots[index]);
+
+                        if ((entry.Hash == hash) && (entry.Implementation == impl) && (entry.InterfaceId == id) && (entry.Channel == channel) && (accept(entry.Proxy) == true)) {
+                            result = entry.Proxy;
+                        }
+                        index = ((index + 1) & mask);
+                    }
+
+                    return (result);
+                }
+                void Insert(const Core::IPCChannel* channel, void* impl, const uint32_t id, const uint32_t hash, ProxyStub::UnknownProxy* proxy);
+                bool Remove(const uint32_t hash, const ProxyStub::UnknownProxy* proxy);
+                // Removes all proxies of the channel, the ones that were still registered are returned.
+                void Remove(const Core::IPCChannel* channel, std::list<ProxyStub::UnknownProxy*>& pendingProxies);
+
+            private:
+                void Place(const Entry& entry);
+
+            private:
+                mutable Core::CriticalSection _lock;
+                std::vector<Entry> _slots;
+                uint32_t _count;
+            };
+
+        public:
+            ProxyTable()
+            {
+            }
+            ~ProxyTable()
+            {
+            }
+
+        public:
+            static inline uint32_t Hash(const Core::IPCChannel* channel, const void* impl, const uint32_t id)
+            {
+                uint64_t value = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(impl)) * 0x9E3779B97F4A7C15ULL);
+
+                value ^= ((static_cast<uint64_t>(reinterpret_cast<uintptr_t>(channel)) + id) * 0xC2B2AE3D27D4EB4FULL);
+
+                return (static_cast<uint32_t>(value >> 32) ^ static_cast<uint32_t>(value));
+            }
+            // The slot within a shard is taken from the low bits of the hash, the shard from the high bits.
+            inline Shard& Select(const uint32_t hash)
+            {
+                return (_shards[hash >> (32 - ShardBits)]);
+            }
+            inline uint8_t Shards() const
+            {
+                return (1 << ShardBits);
+            }
+            inline Shard& operator[](const uint8_t index)
+            {
+                return (_shards[index]);
+            }
+
+        private:
+            Shard _shards[1 << ShardBits];
+        };
+
         typedef std::map<const Core::IPCChannel*, std::list<ExternalReference>> ReferenceMap;
+        typedef std::map<const Core::IPCChannel*, Core::ProxyType<Data::FramePool>> FrameMap;
+        typedef std::map<const Core::IPCChannel*, std::list<Core::ProxyType<Core::IIPC>>> OneWayMap;
 
         struct EXTERNAL IMetadata {
             virtual ~IMetadata(){};
@@ -138,6 +251,17 @@ namespace RPC {
 
         void DeleteChannel(const Core::ProxyType<Core::IPCChannel>& channel, std::list<ProxyStub::UnknownProxy*>& pendingProxies, std::list<ExposedInterface>& usedInterfaces);
 
+        // Large invoke frames on a channel can be exchanged through shared memory, negotiated during the announce.
+        bool Attach(const Core::IPCChannel& channel, const string& name, const bool owner);
+        void Detach(const Core::IPCChannel& channel);
+        Core::ProxyType<Data::FramePool> Frames(const Core::IPCChannel& channel);
+
+        // One-way invokes on a channel are handled in the order they were sent. Returns true if the
+        // invoke is queued behind one that is still being handled, otherwise the caller handles it and
+        // picks up what was queued meanwhile with Dequeue, until that returns false.
+        bool Enqueue(const Core::IPCChannel& channel, const Core::ProxyType<Core::IIPC>& message);
+        bool Dequeue(const Core::IPCChannel& channel, Core::ProxyType<Core::IIPC>& message);
+
         template <typename ACTUALINTERFACE>
         ACTUALINTERFACE* ProxyFind(const Core::ProxyType<Core::IPCChannel>& channel, void* impl)
         {
@@ -204,11 +328,13 @@ namespace RPC {
     private:
         // Seems like we have enough information, open up the Process communcication Channel.
         Core::CriticalSection _adminLock;
-        std::map<uint32_t, ProxyStub::UnknownStub*> _stubs;
-        std::map<uint32_t, IMetadata*> _proxy;
+        std::unordered_map<uint32_t, ProxyStub::UnknownStub*> _stubs;
+        std::unordered_map<uint32_t, IMetadata*> _proxy;
         Core::ProxyPoolType<InvokeMessage> _factory;
-        ChannelMap _channelProxyMap;
+        ProxyTable _proxies;
         ReferenceMap _channelReferenceMap;
+        FrameMap _channelFrameMap;
+        OneWayMap _channelOneWayMap;
     };
 
     class EXTERNAL Job : public Core::IDispatch {
@@ -263,7 +389,16 @@ namespace RPC {
         virtual void Dispatch() override
         {
             if (_message->Label() == InvokeMessage::Id()) {
+                const bool oneWay = IsOneWay(_message);
+
                 Invoke(_channel, _message);
+
+                if (oneWay == true) {
+                    // Handle the one-way invokes that came in on this channel in the mean time.
+                    while (_administrator.Dequeue(*_channel, _message) == true) {
+                        Invoke(_channel, _message);
+                    }
+                }
             } else {
                 ASSERT(_message->Label() == AnnounceMessage::Id());
                 ASSERT(_handler != nullptr);
@@ -272,13 +407,42 @@ namespace RPC {
             }
         }
 
+        static bool IsOneWay(const Core::ProxyType<Core::IIPC>& data)
+        {
+            bool result = false;
+
+            if (data->Label() == InvokeMessage::Id()) {
+                Core::ProxyType<InvokeMessage> message(data);
+
+                result = message->Parameters().IsOneWay();
+            }
+
+            return (result);
+        }
+
 		static void Invoke(Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<Core::IIPC>& data)
 		{
             Core::ProxyType<InvokeMessage> message(data);
             ASSERT(message.IsValid() == true);
-            _administrator.Invoke(channel, message);
-            channel->ReportResponse(data);
 
+            const bool oneWay = message->Parameters().IsOneWay();
+            Core::ProxyType<Data::FramePool> frames(_administrator.Frames(*channel));
+
+            if ((message->Parameters().IsShared() == false) || ((frames.IsValid() == true) && (message->Parameters().Reload(*frames) == true))) {
+                _administrator.Invoke(channel, message);
+
+                if ((oneWay == false) && (frames.IsValid() == true)) {
+                    message->Response().Offload(*frames);
+                }
+            } else {
+                TRACE_L1("Could not load the shared parameters of an invoke.");
+                message->Response().Clear();
+            }
+
+            // Nobody is waiting for the response of a one-way invoke.
+            if ((oneWay == false) && (channel->ReportResponse(data) != Core::ERROR_NONE) && (frames.IsValid() == true)) {
+                message->Response().Revoke(*frames);
+            }
 		}
 
     private:
@@ -314,10 +478,12 @@ namespace RPC {
     private:
         virtual void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& message)
         {
-            Core::ProxyType<Job> job(Job::Instance());
+            if ((Job::IsOneWay(message) == false) || (Administrator::Instance().Enqueue(source, message) == false)) {
+                Core::ProxyType<Job> job(Job::Instance());
 
-            job->Set(source, message, _handler);
-            _threadPoolEngine.Submit(Core::ProxyType<Core::IDispatch>(job));
+                job->Set(source, message, _handler);
+                _threadPoolEngine.Submit(Core::ProxyType<Core::IDispatch>(job));
+            }
         }
 
     private:
@@ -356,7 +522,7 @@ namespace RPC {
 
             if (message->Label() == AnnounceMessage::Id()) {
 	            _handler->Procedure(source, message);
-	        } else {
+	        } else if ((Job::IsOneWay(message) == false) || (Administrator::Instance().Enqueue(source, message) == false)) {
                 _threadPoolEngine.Submit(Job(source, message, _handler), Core::infinite);
             }        
         }
@@ -367,6 +367,8 @@ namespace RPC {
     {
         BaseClass::Close(Core::infinite);
 
+        RPC::Administrator::Instance().Detach(*this);
+
         BaseClass::Unregister(RPC::InvokeMessage::Id());
         BaseClass::Unregister(RPC::AnnounceMessage::Id());
 
@@ -452,6 +454,8 @@ namespace RPC {
             }
         } else {
             TRACE_L1("Connection to the server is down");
+
+            RPC::Administrator::Instance().Detach(*this);
         }
     }
 
@@ -477,6 +481,11 @@ namespace RPC {
                 // Also load the ProxyStubs before we do anything else
                 RPC::LoadProxyStubs(proxyStubPath);
             }
+
+            string frames(announceMessage->Response().Frames());
+            if ((frames.empty() == false) && (RPC::Administrator::Instance().Attach(*this, frames, false) == false)) {
+                TRACE_L1("Could not attach to the shared frames %s, using the socket only.", frames.c_str());
+            }
         }
 
         // Set event so WaitForCompletion() can continue.
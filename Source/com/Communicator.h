@@ -1054,8 +1054,9 @@ namespace RPC {
                     // Anounce the interface as completed
                     string jsonDefaultCategories(Trace::TraceUnit::Instance().Defaults());
                     void* result = _parent.Announce(proxyChannel, message->Parameters());
+                    string frames(_parent.Frames(*proxyChannel));
 
-                    message->Response().Set(result, proxyChannel->Extension().Id(), _parent.ProxyStubPath(), jsonDefaultCategories);
+                    message->Response().Set(result, proxyChannel->Extension().Id(), _parent.ProxyStubPath(), jsonDefaultCategories, frames);
 
                     // We are done, report completion
                     channel.ReportResponse(data);
@@ -1095,6 +1096,7 @@ namespace RPC {
                 const string& proxyStubPath)
                 : BaseClass(remoteNode, CommunicationBufferSize)
                 , _proxyStubPath(proxyStubPath)
+                , _frames(remoteNode.Type() == Core::NodeId::TYPE_DOMAIN ? remoteNode.HostName() : string())
                 , _connections(processes)
                 , _announceHandler(this)
             {
@@ -1108,6 +1110,7 @@ namespace RPC {
                 const Core::ProxyType<Core::IIPCServer>& handler)
                 : BaseClass(remoteNode, CommunicationBufferSize)
                 , _proxyStubPath(proxyStubPath)
+                , _frames(remoteNode.Type() == Core::NodeId::TYPE_DOMAIN ? remoteNode.HostName() : string())
                 , _connections(processes)
                 , _announceHandler(this)
             {
@@ -1140,9 +1143,26 @@ namespace RPC {
                 // We are in business, register the process with this channel.
                 return (_connections.Announce(channel, info));
             }
+            // Only local (domain socket) connections can share memory. The pool lives as long as the
+            // connection is registered, it is released in Communicator::Closed.
+            string Frames(Client& channel)
+            {
+                string result;
+
+                if ((_frames.empty() == false) && (channel.Extension().IsRegistered() == true)) {
+                    string name(_frames + '.' + Core::NumberType<uint32_t>(channel.Extension().Id()).Text() + _T(".frames"));
+
+                    if (RPC::Administrator::Instance().Attach(channel, name, true) == true) {
+                        result = name;
+                    }
+                }
+
+                return (result);
+            }
 
         private:
             const string _proxyStubPath;
+            const string _frames;
             RemoteConnectionMap& _connections;
             AnnounceHandlerImplementation _announceHandler;
         };
@@ -153,16 +153,76 @@ namespace ProxyStub {
         {
             ASSERT(_channel.IsValid() == true);
 
+            Core::ProxyType<RPC::Data::FramePool> frames(RPC::Administrator::Instance().Frames(*_channel));
+
+            if (frames.IsValid() == true) {
+                message->Parameters().Offload(*frames);
+            }
+
             uint32_t result = _channel->Invoke(message, waitTime);
 
+            if ((result == Core::ERROR_NONE) && (message->Response().IsShared() == true)) {
+                if ((frames.IsValid() == false) || (message->Response().Reload(*frames) == false)) {
+                    result = Core::ERROR_INVALID_INPUT_LENGTH;
+                }
+            } else if ((result != Core::ERROR_NONE) && (frames.IsValid() == true)) {
+                // Not sent, or not waited for: unless the other side loaded the parameters already, their
+                // slot is ours to return.
+                message->Parameters().Revoke(*frames);
+            }
+
             if (result != Core::ERROR_NONE) {
                 // Oops something failed on the communication. Report it.
-                TRACE_L1("IPC method invokation failed for 0x%X", message->Parameters().InterfaceId());
+                TRACE_L1("IPC method invokation failed for 0x%X", _interfaceId);
                 TRACE_L1("IPC method invoke failed with error %d", result);
             }
 
             return (result);
         }
+        // One-way: the message is handed to the channel and the call returns, the other side does not respond.
+        inline uint32_t Post(Core::ProxyType<RPC::InvokeMessage>& message) const
+        {
+            ASSERT(_channel.IsValid() == true);
+
+            Core::ProxyType<RPC::Data::FramePool> frames(RPC::Administrator::Instance().Frames(*_channel));
+
+            message->Parameters().OneWay(true);
+
+            if (frames.IsValid() == true) {
+                message->Parameters().Offload(*frames);
+            }
+
+            uint32_t result = _channel->Post(message);
+
+            if (result != Core::ERROR_NONE) {
+                if (frames.IsValid() == true) {
+                    message->Parameters().Revoke(*frames);
+                }
+                TRACE_L1("IPC method post failed for 0x%X with error %d", _interfaceId, result);
+            }
+
+            return (result);
+        }
+#ifdef __LINUX__
+        // Passes a copy of the descriptor along with the next invoke, the returned index goes in the message.
+        inline uint32_t Descriptor(const int descriptor) const
+        {
+            ASSERT(_channel.IsValid() == true);
+
+            const int copy = (descriptor != -1 ? ::fcntl(descriptor, F_DUPFD_CLOEXEC, 0) : -1);
+
+            return (copy != -1 ? _channel->Offer(copy) : ~0);
+        }
+        // Passes the buffer as a sealed memory file along with the next invoke, the returned index goes in the message.
+        inline uint32_t Blob(const uint32_t length, const uint8_t buffer[]) const
+        {
+            ASSERT(_channel.IsValid() == true);
+
+            const int blob = (length != 0 ? RPC::Data::Blob::Create(buffer, length) : -1);
+
+            return (blob != -1 ? _channel->Offer(blob) : ~0);
+        }
+#endif
         void EnableCaching()
         {
             uint8_t value(UNREGISTERED);
@@ -366,6 +426,20 @@ namespace ProxyStub {
         {
             return (_unknown.Invoke(message, waitTime));
         }
+        inline uint32_t Post(Core::ProxyType<RPC::InvokeMessage>& message) const
+        {
+            return (_unknown.Post(message));
+        }
+#ifdef __LINUX__
+        inline uint32_t Descriptor(const int descriptor) const
+        {
+            return (_unknown.Descriptor(descriptor));
+        }
+        inline uint32_t Blob(const uint32_t length, const uint8_t buffer[]) const
+        {
+            return (_unknown.Blob(length, buffer));
+        }
+#endif
         virtual void AddRef() const override
         {
             _unknown.AddReference();
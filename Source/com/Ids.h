@@ -17,6 +17,7 @@ namespace RPC {
         ID_SESSION = 0x00000013,
         ID_SESSION_CALLBACK = 0x00000014,
         ID_SESSION_EXTENSION = 0x00000015,
+        ID_SESSION_RING = 0x00000016,
 
         ID_PLUGIN = 0x00000020,
         ID_PLUGIN_NOTIFICATION = 0x00000021,
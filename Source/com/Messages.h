@@ -3,6 +3,11 @@
 
 #include "Module.h"
 
+#ifdef __LINUX__
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 namespace WPEFramework {
 namespace RPC {
 
@@ -27,15 +32,15 @@ namespace RPC {
             friend class Output;
             friend class ObjectInterface;
 
-            uint16_t Serialize(const uint16_t offset, uint8_t stream[], const uint16_t maxLength) const
+            uint32_t Serialize(const uint32_t offset, uint8_t stream[], const uint32_t maxLength) const
             {
-                uint16_t copiedBytes((Size() - offset) > maxLength ? maxLength : (Size() - offset));
+                uint32_t copiedBytes((Size() - offset) > maxLength ? maxLength : (Size() - offset));
 
                 ::memcpy(stream, &(operator[](offset)), copiedBytes);
 
                 return (copiedBytes);
             }
-            uint16_t Deserialize(const uint16_t offset, const uint8_t stream[], const uint16_t maxLength)
+            uint32_t Deserialize(const uint32_t offset, const uint8_t stream[], const uint32_t maxLength)
             {
                 Size(offset + maxLength);
 
@@ -45,6 +50,388 @@ namespace RPC {
             }
         };
 
+        // Large invoke frames do not have to travel through the socket. Once a connection has announced
+        // itself, both sides map the same file with a fixed set of slots. A frame that is big enough
+        // is copied into a free slot and only a descriptor (slot, ticket, length) is sent over the socket,
+        // the socket remains the signal for the other side. Slots are claimed/returned with atomic bit
+        // operations, so responses may come back in any order (pipelined invokes).
+        // A slot is returned by whoever takes its ticket first: the receiver that loads it, or the sender
+        // that gives up on it (failed send, timeout). A slot nobody takes, like a response that arrives
+        // after its caller timed out, is reclaimed once the pool runs out of slots and it expired.
+        // The owner decides on the size of the slots, the other side takes it from the administration. A
+        // frame that does not fit in a slot keeps on travelling through the socket.
+        class FramePool {
+        private:
+            FramePool() = delete;
+            FramePool(const FramePool&) = delete;
+            FramePool& operator=(const FramePool&) = delete;
+
+        public:
+            enum : uint32_t {
+                Slots = 16,
+                SlotSize = 0x10000, // The default, frames can not grow beyond 64K.
+                Header = 256,
+                Threshold = 1024, // Below this the copy through the socket is cheaper.
+                Expiry = 60 // Seconds, well beyond the communication timeout.
+            };
+
+        private:
+            enum : uint8_t {
+                Descriptor = sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint32_t)
+            };
+            enum : uint32_t {
+                Busy = 0xFFFFFFFF // The ticket of a slot that is still being filled.
+            };
+
+            struct Administration {
+                std::atomic<uint32_t> _free;
+                std::atomic<uint32_t> _ticket;
+                uint32_t _slots;
+                uint32_t _slotSize;
+                // Per slot, the ticket of the frame it holds (0 if none) and when it was stored.
+                std::atomic<uint32_t> _tickets[Slots];
+                std::atomic<uint32_t> _stored[Slots];
+            };
+
+        public:
+            FramePool(const string& name, const bool owner, const uint32_t slotSize = SlotSize)
+                : _storage(name,
+                      Core::File::USER_READ | Core::File::USER_WRITE | Core::File::GROUP_READ | Core::File::GROUP_WRITE | Core::File::SHAREABLE | (owner ? static_cast<uint32_t>(Core::File::CREATE) : 0),
+                      (owner ? (Header + (Slots * slotSize)) : 0))
+                , _owner(owner)
+                , _slotSize(owner ? slotSize : 0)
+                , _administration(nullptr)
+            {
+                static_assert(sizeof(Administration) <= Header, "The administration does not fit in the header");
+
+                ASSERT((owner == false) || ((slotSize >= Threshold) && (slotSize <= SlotSize)));
+
+                if ((_storage.IsValid() == true) && (_storage.Size() >= Header)) {
+                    _administration = reinterpret_cast<Administration*>(_storage.Buffer());
+
+                    if (_owner == false) {
+                        // Whatever the other side wrote here, it should describe the slots that were mapped.
+                        _slotSize = _administration->_slotSize;
+                    }
+
+                    if ((_slotSize < Threshold) || (_slotSize > SlotSize) || (_storage.Size() < (Header + (Slots * _slotSize)))) {
+                        TRACE_L1("The frame pool %s does not hold its slots.", name.c_str());
+                        _administration = nullptr;
+                    } else if (_owner == true) {
+                        _administration->_slots = Slots;
+                        _administration->_slotSize = _slotSize;
+                        _administration->_ticket.store(0);
+
+                        for (uint8_t slot = 0; slot < Slots; slot++) {
+                            _administration->_tickets[slot].store(0);
+                            _administration->_stored[slot].store(0);
+                        }
+
+                        _administration->_free.store((1 << Slots) - 1);
+                    } else if (_administration->_slots != Slots) {
+                        TRACE_L1("The frame pool %s has an unexpected layout.", name.c_str());
+                        _administration = nullptr;
+                    }
+                } else {
+                    TRACE_L1("Could not open the frame pool %s.", name.c_str());
+                }
+            }
+            ~FramePool()
+            {
+                if (_owner == true) {
+                    // Once both sides have unmapped it, the memory is returned.
+                    Core::File(_storage.Name()).Destroy();
+                }
+            }
+
+        public:
+            inline bool IsValid() const
+            {
+                return (_administration != nullptr);
+            }
+            inline const string& Name() const
+            {
+                return (_storage.Name());
+            }
+            // Replaces the content of the frame by a slot descriptor, if it is worth it and a slot is available.
+            bool Store(Frame& frame)
+            {
+                bool result = false;
+                uint32_t length = frame.Size();
+
+                if ((IsValid() == true) && (length > _slotSize)) {
+                    TRACE_L1("A frame of %d bytes does not fit in a slot of %s, it is sent through the socket.", length, Name().c_str());
+                } else if ((IsValid() == true) && (length >= Threshold)) {
+                    uint8_t slot = Claim();
+
+                    if ((slot == Slots) && (Reclaim() == true)) {
+                        slot = Claim();
+                    }
+
+                    if (slot < Slots) {
+                        uint32_t ticket;
+
+                        // Until it holds a ticket, nobody takes the slot, Revoke waits for it.
+                        _administration->_tickets[slot].store(Busy);
+
+                        do {
+                            ticket = _administration->_ticket.fetch_add(1) + 1;
+                        } while ((ticket == 0) || (ticket == Busy));
+
+                        frame.Serialize(0, Slot(slot), length);
+                        _administration->_stored[slot].store(Now(), std::memory_order_relaxed);
+                        _administration->_tickets[slot].store(ticket, std::memory_order_release);
+
+                        frame.Clear();
+                        frame.SetNumber<uint8_t>(0, slot);
+                        frame.SetNumber<uint32_t>(sizeof(uint8_t), ticket);
+                        frame.SetNumber<uint32_t>(sizeof(uint8_t) + sizeof(uint32_t), length);
+                        result = true;
+                    }
+                }
+
+                return (result);
+            }
+            // Replaces the slot descriptor in the frame by the content of that slot and returns the slot.
+            bool Load(Frame& frame)
+            {
+                bool result = false;
+                uint8_t slot = Slots;
+                uint32_t ticket = 0;
+                uint32_t length = 0;
+
+                if ((IsValid() == true) && (Parse(frame, slot, ticket, length) == true) && (Take(slot, ticket) == true)) {
+                    frame.Clear();
+                    frame.Deserialize(0, Slot(slot), length);
+                    Free(slot);
+                    result = true;
+                }
+
+                return (result);
+            }
+            // The frame was stored but will not be loaded by the other side, return its slot (if the other
+            // side did not load it already).
+            void Revoke(Frame& frame)
+            {
+                uint8_t slot = Slots;
+                uint32_t ticket = 0;
+                uint32_t length = 0;
+
+                if ((IsValid() == true) && (Parse(frame, slot, ticket, length) == true) && (Take(slot, ticket) == true)) {
+                    Free(slot);
+                }
+
+                frame.Clear();
+            }
+            // The connection is gone, nothing stored will be loaded anymore.
+            void Revoke()
+            {
+                if (IsValid() == true) {
+                    for (uint8_t slot = 0; slot < Slots; slot++) {
+                        uint32_t ticket = _administration->_tickets[slot].load(std::memory_order_acquire);
+
+                        // A Store in progress is a copy of at most one slot, wait for it to hand out its ticket.
+                        while (ticket == Busy) {
+                            ::SleepMs(0);
+                            ticket = _administration->_tickets[slot].load(std::memory_order_acquire);
+                        }
+
+                        if (Take(slot, ticket) == true) {
+                            Free(slot);
+                        }
+                    }
+                }
+            }
+
+        private:
+            inline uint8_t* Slot(const uint8_t slot)
+            {
+                return (&(_storage.Buffer()[Header + (slot * _slotSize)]));
+            }
+            inline static uint32_t Now()
+            {
+                return (static_cast<uint32_t>(Core::Time::Now().Ticks() / (Core::Time::TicksPerMillisecond * 1000)));
+            }
+            uint8_t Claim()
+            {
+                uint32_t free = _administration->_free.load();
+                uint8_t slot = 0;
+
+                do {
+                    slot = 0;
+                    while ((slot < Slots) && ((free & (1 << slot)) == 0)) {
+                        slot++;
+                    }
+                } while ((slot < Slots) && (_administration->_free.compare_exchange_weak(free, free & ~(1 << slot)) == false));
+
+                return (slot);
+            }
+            inline void Free(const uint8_t slot)
+            {
+                ASSERT((_administration->_free.load() & (1 << slot)) == 0);
+
+                _administration->_free.fetch_or(1 << slot);
+            }
+            // Only one party can take a ticket, the slot is theirs to return.
+            inline bool Take(const uint8_t slot, uint32_t ticket)
+            {
+                return ((ticket != 0) && (ticket != Busy) && (_administration->_tickets[slot].compare_exchange_strong(ticket, 0) == true));
+            }
+            bool Reclaim()
+            {
+                bool result = false;
+                const uint32_t now = Now();
+
+                for (uint8_t slot = 0; slot < Slots; slot++) {
+                    uint32_t ticket = _administration->_tickets[slot].load(std::memory_order_acquire);
+
+                    if ((ticket != 0) && ((now - _administration->_stored[slot].load(std::memory_order_relaxed)) > Expiry) && (Take(slot, ticket) == true)) {
+                        TRACE_L1("Reclaimed the expired frame in slot %d of %s.", slot, Name().c_str());
+                        Free(slot);
+                        result = true;
+                    }
+                }
+
+                return (result);
+            }
+            bool Parse(const Frame& frame, uint8_t& slot, uint32_t& ticket, uint32_t& length) const
+            {
+                bool result = false;
+
+                if (frame.Size() == Descriptor) {
+                    frame.GetNumber<uint8_t>(0, slot);
+                    frame.GetNumber<uint32_t>(sizeof(uint8_t), ticket);
+                    frame.GetNumber<uint32_t>(sizeof(uint8_t) + sizeof(uint32_t), length);
+
+                    result = ((slot < Slots) && (length <= _slotSize));
+                }
+
+                return (result);
+            }
+
+        private:
+            Core::DataElementFile _storage;
+            const bool _owner;
+            uint32_t _slotSize;
+            Administration* _administration;
+        };
+
+#ifdef __LINUX__
+        // A file descriptor that came along with an invoke, see Core::IPCChannel::Offer. It is owned for the
+        // duration of the call, whoever needs it beyond that, should duplicate it.
+        class Descriptor {
+        private:
+            Descriptor() = delete;
+            Descriptor(const Descriptor&) = delete;
+            Descriptor& operator=(const Descriptor&) = delete;
+
+        public:
+            Descriptor(Core::IPCChannel& channel, const uint32_t index)
+                : _descriptor(channel.Claim(index))
+            {
+            }
+            ~Descriptor()
+            {
+                if (_descriptor != -1) {
+                    ::close(_descriptor);
+                }
+            }
+
+        public:
+            inline int Handle() const
+            {
+                return (_descriptor);
+            }
+
+        private:
+            int _descriptor;
+        };
+
+        // A buffer too large to copy through the frame (and the socket) travels as a sealed memory file
+        // next to the invoke. The sending side writes it once, the receiving side maps it read only. The
+        // seals guarantee the sender can not change or truncate it while it is mapped.
+        class Blob {
+        private:
+            Blob() = delete;
+            Blob(const Blob&) = delete;
+            Blob& operator=(const Blob&) = delete;
+
+            static constexpr int Seals = (F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL);
+
+        public:
+            Blob(Core::IPCChannel& channel, const uint32_t index)
+                : _buffer(nullptr)
+                , _length(0)
+            {
+                const int descriptor = channel.Claim(index);
+
+                if (descriptor != -1) {
+                    struct stat info;
+
+                    if ((::fcntl(descriptor, F_GET_SEALS) & Seals) != Seals) {
+                        TRACE_L1("Blob %d is not sealed, ignoring it.", index);
+                    } else if ((::fstat(descriptor, &info) == 0) && (info.st_size > 0)) {
+                        void* buffer = ::mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, descriptor, 0);
+
+                        if (buffer != MAP_FAILED) {
+                            _buffer = static_cast<const uint8_t*>(buffer);
+                            _length = static_cast<uint32_t>(info.st_size);
+                        }
+                    }
+
+                    // The mapping keeps the memory.
+                    ::close(descriptor);
+                }
+            }
+            ~Blob()
+            {
+                if (_buffer != nullptr) {
+                    ::munmap(const_cast<uint8_t*>(_buffer), _length);
+                }
+            }
+
+        public:
+            // Returns a sealed memory file with the content of the buffer, or -1.
+            static int Create(const uint8_t buffer[], const uint32_t length)
+            {
+                int descriptor = ::memfd_create("blob", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+
+                if (descriptor != -1) {
+                    uint32_t written = 0;
+
+                    while (written < length) {
+                        const ssize_t result = ::write(descriptor, &(buffer[written]), length - written);
+
+                        if (result <= 0) {
+                            break;
+                        }
+                        written += static_cast<uint32_t>(result);
+                    }
+
+                    if ((written != length) || (::fcntl(descriptor, F_ADD_SEALS, Seals) != 0)) {
+                        ::close(descriptor);
+                        descriptor = -1;
+                    }
+                }
+
+                return (descriptor);
+            }
+
+            inline const uint8_t* Buffer() const
+            {
+                return (_buffer);
+            }
+            inline uint32_t Length() const
+            {
+                return (_length);
+            }
+
+        private:
+            const uint8_t* _buffer;
+            uint32_t _length;
+        };
+#endif
+
         class Input {
         private:
             Input(const Input&) = delete;
@@ -53,6 +440,8 @@ namespace RPC {
         public:
             Input()
                 : _data()
+                , _shared(false)
+                , _oneWay(false)
             {
             }
             ~Input()
@@ -63,9 +452,14 @@ namespace RPC {
             inline void Clear()
             {
                 _data.Clear();
+                _shared = false;
+                _oneWay = false;
             }
             void Set(void* implementation, const uint32_t interfaceId, const uint8_t methodId)
             {
+                _shared = false;
+                _oneWay = false;
+
                 uint16_t result = _data.SetNumber<void*>(0, implementation);
                 result += _data.SetNumber<uint32_t>(result, interfaceId);
                 _data.SetNumber(result, methodId);
@@ -97,7 +491,7 @@ namespace RPC {
             }
             uint32_t Length() const
             {
-                return (_data.Size());
+                return (_data.Size() + 1);
             }
             inline Frame::Writer Writer()
             {
@@ -107,17 +501,79 @@ namespace RPC {
             {
                 return (Frame::Reader(_data, (sizeof(void*) + sizeof(uint32_t) + sizeof(uint8_t))));
             }
+            inline bool IsShared() const
+            {
+                return (_shared);
+            }
+            // A one-way invoke is not answered, the caller does not wait for it.
+            inline bool IsOneWay() const
+            {
+                return (_oneWay);
+            }
+            inline void OneWay(const bool enabled)
+            {
+                _oneWay = enabled;
+            }
+            inline void Offload(FramePool& pool)
+            {
+                _shared = (_shared || pool.Store(_data));
+            }
+            inline bool Reload(FramePool& pool)
+            {
+                bool result = ((_shared == false) || (pool.Load(_data) == true));
+
+                _shared = false;
+
+                return (result);
+            }
+            // Sending failed, or nobody waits for it anymore: the other side will not reload it.
+            inline void Revoke(FramePool& pool)
+            {
+                if (_shared == true) {
+                    pool.Revoke(_data);
+                    _shared = false;
+                }
+            }
+            // The first byte on the wire holds the flags: does the frame content follow, or a FramePool
+            // slot descriptor and is a response expected.
             uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
             {
-                return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
+                uint16_t result = 0;
+
+                if (offset != 0) {
+                    result = static_cast<uint16_t>(_data.Serialize(offset - 1, stream, maxLength));
+                } else if (maxLength > 0) {
+                    stream[0] = (_shared ? SHARED : 0) | (_oneWay ? ONEWAY : 0);
+                    result = static_cast<uint16_t>(1 + _data.Serialize(0, &(stream[1]), maxLength - 1));
+                }
+
+                return (result);
             }
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
             {
-                return (_data.Deserialize(static_cast<uint16_t>(offset), stream, maxLength));
+                uint16_t result = 0;
+
+                if (offset != 0) {
+                    result = static_cast<uint16_t>(_data.Deserialize(offset - 1, stream, maxLength));
+                } else if (maxLength > 0) {
+                    _shared = ((stream[0] & SHARED) != 0);
+                    _oneWay = ((stream[0] & ONEWAY) != 0);
+                    _data.Clear();
+                    result = static_cast<uint16_t>(1 + _data.Deserialize(0, &(stream[1]), maxLength - 1));
+                }
+
+                return (result);
             }
 
         private:
+            enum : uint8_t {
+                SHARED = 0x01,
+                ONEWAY = 0x02
+            };
+
             Frame _data;
+            bool _shared;
+            bool _oneWay;
         };
 
         class Output {
@@ -128,6 +584,7 @@ namespace RPC {
         public:
             Output()
                 : _data()
+                , _shared(false)
             {
             }
             ~Output()
@@ -138,6 +595,7 @@ namespace RPC {
             inline void Clear()
             {
                 _data.Clear();
+                _shared = false;
             }
             inline Frame::Writer Writer()
             {
@@ -154,19 +612,64 @@ namespace RPC {
             }
             inline uint32_t Length() const
             {
-                return (static_cast<uint32_t>(_data.Size()));
+                return (static_cast<uint32_t>(_data.Size()) + 1);
+            }
+            inline bool IsShared() const
+            {
+                return (_shared);
+            }
+            inline void Offload(FramePool& pool)
+            {
+                _shared = (_shared || pool.Store(_data));
+            }
+            inline bool Reload(FramePool& pool)
+            {
+                bool result = ((_shared == false) || (pool.Load(_data) == true));
+
+                _shared = false;
+
+                return (result);
+            }
+            // Sending failed, or nobody waits for it anymore: the other side will not reload it.
+            inline void Revoke(FramePool& pool)
+            {
+                if (_shared == true) {
+                    pool.Revoke(_data);
+                    _shared = false;
+                }
             }
+            // The first byte on the wire tells if the frame content follows, or a FramePool slot descriptor.
             inline uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
             {
-                return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
+                uint16_t result = 0;
+
+                if (offset != 0) {
+                    result = static_cast<uint16_t>(_data.Serialize(offset - 1, stream, maxLength));
+                } else if (maxLength > 0) {
+                    stream[0] = (_shared ? 1 : 0);
+                    result = static_cast<uint16_t>(1 + _data.Serialize(0, &(stream[1]), maxLength - 1));
+                }
+
+                return (result);
             }
             inline uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
             {
-                return (_data.Deserialize(static_cast<uint16_t>(offset), stream, maxLength));
+                uint16_t result = 0;
+
+                if (offset != 0) {
+                    result = static_cast<uint16_t>(_data.Deserialize(offset - 1, stream, maxLength));
+                } else if (maxLength > 0) {
+                    _shared = (stream[0] != 0);
+                    _data.Clear();
+                    result = static_cast<uint16_t>(1 + _data.Deserialize(0, &(stream[1]), maxLength - 1));
+                }
+
+                return (result);
             }
 
         private:
             Frame _data;
+            bool _shared;
         };
 
         class Init {
@@ -320,12 +823,13 @@ namespace RPC {
             {
                 _data.Clear();
             }
-            void Set(void* implementation, const uint32_t sequenceNumber, const string& proxyStubPath, const string& traceCategories)
+            void Set(void* implementation, const uint32_t sequenceNumber, const string& proxyStubPath, const string& traceCategories, const string& frames)
             {
                 _data.SetNumber<void*>(0, implementation);
                 _data.SetNumber<uint32_t>(sizeof(void*), sequenceNumber);
                 uint16_t length = _data.SetText(sizeof(void*) + sizeof(uint32_t), proxyStubPath);
-                _data.SetText(sizeof(void*)+ sizeof(uint32_t) + length, traceCategories);
+                length += _data.SetText(sizeof(void*)+ sizeof(uint32_t) + length, traceCategories);
+                _data.SetText(sizeof(void*)+ sizeof(uint32_t) + length, frames);
             }
             inline bool IsSet() const {
                 return (_data.Size() > 0);
@@ -357,6 +861,21 @@ namespace RPC {
 
                 return (value);
             }
+            string Frames() const
+            {
+                string value;
+
+                uint16_t length = sizeof(void*) + sizeof(uint32_t) ;   // skip implentation and sequencenumber 
+                length += _data.GetText(length, value);  // skip proxyStub path
+                length += _data.GetText(length, value);  // skip trace categories
+
+                value.clear();
+                if (length < _data.Size()) {
+                    _data.GetText(length, value);
+                }
+
+                return (value);
+            }
             void* Implementation() const
             {
                 void* result = nullptr;
@@ -373,11 +892,11 @@ namespace RPC {
             }
             uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
             {
-                return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (static_cast<uint16_t>(_data.Serialize(offset, stream, maxLength)));
             }
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
             {
-                return (_data.Deserialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (static_cast<uint16_t>(_data.Deserialize(offset, stream, maxLength)));
             }
 
         private:
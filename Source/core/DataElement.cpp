@@ -1,5 +1,11 @@
 #include "DataElement.h"
 
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO)
+#include <arm_neon.h>
+#endif
+
 namespace WPEFramework {
 namespace Core {
 
@@ -50,6 +56,179 @@ namespace Core {
         0xbcb4666d, 0xb8757bda, 0xb5365d03, 0xb1f740b4
     };
 
+    namespace {
+
+        // The byte wise table extended to slicing-by-8: Slices[n][i] is the CRC of byte i followed
+        // by n zero bytes, so 8 bytes can be taken in one step. And, if the CPU can multiply
+        // carry-less, the constants to fold the data in 16 byte blocks.
+        class CRC32Tables {
+        public:
+            CRC32Tables(const CRC32Tables&) = delete;
+            CRC32Tables& operator=(const CRC32Tables&) = delete;
+
+            CRC32Tables()
+                : Fold(false)
+            {
+                for (uint16_t index = 0; index < 256; index++) {
+                    Slices[0][index] = g_CRCtable[index];
+                }
+                for (uint8_t slice = 1; slice < 8; slice++) {
+                    for (uint16_t index = 0; index < 256; index++) {
+                        const uint32_t previous = Slices[slice - 1][index];
+                        Slices[slice][index] = (previous << 8) ^ g_CRCtable[previous >> 24];
+                    }
+                }
+
+                Fold64[0] = XnMod(512 + 64);
+                Fold64[1] = XnMod(512);
+                Fold16[0] = XnMod(128 + 64);
+                Fold16[1] = XnMod(128);
+
+#if defined(__GNUC__) && defined(__x86_64__)
+                Fold = ((__builtin_cpu_supports("pclmul") != 0) && (__builtin_cpu_supports("ssse3") != 0));
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO)
+                Fold = true;
+#endif
+            }
+
+        private:
+            // x^n mod P, P being the CRC polynomial.
+            static uint32_t XnMod(const uint32_t n)
+            {
+                uint32_t result = 1;
+
+                for (uint32_t index = 0; index < n; index++) {
+                    result = (result << 1) ^ ((result & 0x80000000) != 0 ? 0x04c11db7 : 0);
+                }
+
+                return (result);
+            }
+
+        public:
+            uint32_t Slices[8][256];
+            uint64_t Fold64[2];
+            uint64_t Fold16[2];
+            bool Fold;
+        };
+
+        static const CRC32Tables& Tables()
+        {
+            static const CRC32Tables tables;
+
+            return (tables);
+        }
+
+        static uint32_t Slice8(const CRC32Tables& tables, uint32_t crc, const uint8_t data[], const uint32_t length)
+        {
+            uint32_t index = 0;
+
+            for (; (index + 8) <= length; index += 8) {
+                const uint8_t* block = &(data[index]);
+
+                crc ^= (static_cast<uint32_t>(block[0]) << 24) | (static_cast<uint32_t>(block[1]) << 16) | (static_cast<uint32_t>(block[2]) << 8) | block[3];
+
+                crc = tables.Slices[7][crc >> 24] ^ tables.Slices[6][(crc >> 16) & 0xff] ^ tables.Slices[5][(crc >> 8) & 0xff] ^ tables.Slices[4][crc & 0xff] ^ tables.Slices[3][block[4]] ^ tables.Slices[2][block[5]] ^ tables.Slices[1][block[6]] ^ tables.Slices[0][block[7]];
+            }
+            for (; index < length; index++) {
+                crc = (crc << 8) ^ tables.Slices[0][((crc >> 24) ^ data[index]) & 0xff];
+            }
+
+            return (crc);
+        }
+
+        // Folding keeps a 128 bits remainder R, with R(x) = M(x) mod P for the data M taken so far.
+        // Taking the next block B: R(x).x^128 + B(x) = hi(x).(x^192 mod P) + lo(x).(x^128 mod P) + B(x).
+        // The CRC of R, as 16 bytes, followed by the bytes that did not fill a block is the CRC
+        // of the data. The initial 0xFFFFFFFF is xor-ed into the first 4 bytes.
+#if defined(__GNUC__) && defined(__x86_64__)
+        __attribute__((target("pclmul,ssse3"))) static uint32_t Fold(const CRC32Tables& tables, const uint8_t data[], const uint32_t length)
+        {
+            const __m128i swap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+            const __m128i fold64 = _mm_set_epi64x(tables.Fold64[0], tables.Fold64[1]);
+            const __m128i fold16 = _mm_set_epi64x(tables.Fold16[0], tables.Fold16[1]);
+            __m128i lanes[4];
+            uint32_t offset = 0;
+
+            ASSERT(length >= 64);
+
+            for (uint8_t lane = 0; lane < 4; lane++) {
+                lanes[lane] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&(data[lane * 16]))), swap);
+            }
+            lanes[0] = _mm_xor_si128(lanes[0], _mm_set_epi32(static_cast<int>(0xFFFFFFFF), 0, 0, 0));
+
+            // Four independent lanes, 64 bytes apart, to keep the multiplier busy.
+            for (offset = 64; (offset + 64) <= length; offset += 64) {
+                for (uint8_t lane = 0; lane < 4; lane++) {
+                    const __m128i block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&(data[offset + (lane * 16)]))), swap);
+                    lanes[lane] = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(lanes[lane], fold64, 0x11), _mm_clmulepi64_si128(lanes[lane], fold64, 0x00)), block);
+                }
+            }
+
+            __m128i remainder = lanes[0];
+
+            for (uint8_t lane = 1; lane < 4; lane++) {
+                remainder = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(remainder, fold16, 0x11), _mm_clmulepi64_si128(remainder, fold16, 0x00)), lanes[lane]);
+            }
+            for (; (offset + 16) <= length; offset += 16) {
+                const __m128i block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&(data[offset]))), swap);
+                remainder = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(remainder, fold16, 0x11), _mm_clmulepi64_si128(remainder, fold16, 0x00)), block);
+            }
+
+            uint8_t bytes[16];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), _mm_shuffle_epi8(remainder, swap));
+
+            return (Slice8(tables, Slice8(tables, 0, bytes, sizeof(bytes)), &(data[offset]), length - offset));
+        }
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO)
+        static inline uint64x2_t Multiply(const uint64x2_t value, const uint64_t high, const uint64_t low)
+        {
+            const uint64x2_t upper = vreinterpretq_u64_p128(vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(value, 1)), static_cast<poly64_t>(high)));
+            const uint64x2_t lower = vreinterpretq_u64_p128(vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(value, 0)), static_cast<poly64_t>(low)));
+
+            return (veorq_u64(upper, lower));
+        }
+        static inline uint64x2_t Load(const uint8_t data[])
+        {
+            // Lane 1 holds the first 8 bytes, big endian, as the high part of the polynomial.
+            const uint8x16_t bytes = vrev64q_u8(vld1q_u8(data));
+
+            return (vcombine_u64(vget_high_u64(vreinterpretq_u64_u8(bytes)), vget_low_u64(vreinterpretq_u64_u8(bytes))));
+        }
+        static uint32_t Fold(const CRC32Tables& tables, const uint8_t data[], const uint32_t length)
+        {
+            uint64x2_t lanes[4];
+            uint32_t offset = 0;
+
+            ASSERT(length >= 64);
+
+            for (uint8_t lane = 0; lane < 4; lane++) {
+                lanes[lane] = Load(&(data[lane * 16]));
+            }
+            lanes[0] = veorq_u64(lanes[0], vcombine_u64(vcreate_u64(0), vcreate_u64(0xFFFFFFFF00000000ULL)));
+
+            for (offset = 64; (offset + 64) <= length; offset += 64) {
+                for (uint8_t lane = 0; lane < 4; lane++) {
+                    lanes[lane] = veorq_u64(Multiply(lanes[lane], tables.Fold64[0], tables.Fold64[1]), Load(&(data[offset + (lane * 16)])));
+                }
+            }
+
+            uint64x2_t remainder = lanes[0];
+
+            for (uint8_t lane = 1; lane < 4; lane++) {
+                remainder = veorq_u64(Multiply(remainder, tables.Fold16[0], tables.Fold16[1]), lanes[lane]);
+            }
+            for (; (offset + 16) <= length; offset += 16) {
+                remainder = veorq_u64(Multiply(remainder, tables.Fold16[0], tables.Fold16[1]), Load(&(data[offset])));
+            }
+
+            uint8_t bytes[16];
+            vst1q_u8(bytes, vrev64q_u8(vreinterpretq_u8_u64(vcombine_u64(vget_high_u64(remainder), vget_low_u64(remainder)))));
+
+            return (Slice8(tables, Slice8(tables, 0, bytes, sizeof(bytes)), &(data[offset]), length - offset));
+        }
+#endif
+    }
+
     /// <summary>
     /// Calculates the CRC value over a (part of) the raw buffer.
     /// </summary>
@@ -59,10 +238,19 @@ namespace Core {
     uint32_t DataElement::CRC32(const uint64_t offset, const uint64_t size) const
     {
         ASSERT(offset + size <= m_Size);
-        uint32_t crc = 0xffffffff;
 
-        for (uint32_t index = 0; index < static_cast<uint32_t>(size); ++index) {
-            crc = (crc << 8) ^ g_CRCtable[((crc >> 24) ^ m_Buffer[static_cast<uint32_t>(offset) + index]) & 0xff];
+        const CRC32Tables& tables(Tables());
+        const uint8_t* data = &(m_Buffer[static_cast<uint32_t>(offset)]);
+        const uint32_t length = static_cast<uint32_t>(size);
+        uint32_t crc;
+
+#if (defined(__GNUC__) && defined(__x86_64__)) || (defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO))
+        if ((tables.Fold == true) && (length >= 64)) {
+            crc = Fold(tables, data, length);
+        } else
+#endif
+        {
+            crc = Slice8(tables, 0xffffffff, data, length);
         }
 
         return (crc);
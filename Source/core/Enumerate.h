@@ -16,7 +16,8 @@ namespace Core {
 
     // ---- Helper types and constants ----
 #define ENUM_CONVERSION_HANDLER(ENUMERATE) \
-namespace Core { template<> EXTERNAL const typename Core::EnumerateConversion<ENUMERATE>* Core::EnumerateType<ENUMERATE>::Table(const uint16_t); }
+namespace Core { template<> EXTERNAL const typename Core::EnumerateConversion<ENUMERATE>* Core::EnumerateType<ENUMERATE>::Table(const uint16_t); \
+                 template<> EXTERNAL const typename Core::EnumerateIndex<ENUMERATE>& Core::EnumerateType<ENUMERATE>::Index(); }
 
 #define ENUM_CONVERSION_BEGIN(ENUMERATE)                                                            \
     namespace Core {                                                                                \
@@ -33,10 +34,24 @@ namespace Core { template<> EXTERNAL const typename Core::EnumerateConversion<EN
     ;                                                                                                    \
     return (index < ((sizeof(table) / sizeof(WPEFramework::Core::EnumerateConversion<ENUMERATE>)) - 1) ? &table[index] : nullptr); \
     }                                                                                                    \
+    template <>                                                                                          \
+    EXTERNAL const Core::EnumerateIndex<ENUMERATE>& EnumerateType<ENUMERATE>::Index()                    \
+    {                                                                                                    \
+        /* Never destroyed: conversions may still be done from the destructors of other statics. */     \
+        static const WPEFramework::Core::EnumerateIndex<ENUMERATE>* index =                              \
+            new WPEFramework::Core::EnumerateIndex<ENUMERATE>(Table(0));                                 \
+        return (*index);                                                                                 \
+    }                                                                                                    \
     }
 
     // ---- Helper functions ----
 
+    // Folds ASCII to lower case, for the case insensitive lookups.
+    inline TCHAR EnumerateFold(const TCHAR character)
+    {
+        return (((character >= 'A') && (character <= 'Z')) ? static_cast<TCHAR>(character + ('a' - 'A')) : character);
+    }
+
     // ---- Class Definition ----
     template <typename ENUMERATEFIELD>
     struct EnumerateConversion {
@@ -45,6 +60,150 @@ namespace Core { template<> EXTERNAL const typename Core::EnumerateConversion<EN
         uint32_t length;
     };
 
+    // Open addressed hash index on top of a conversion table, built once, on first use. Where names or
+    // values occur more than once in the table, the first entry wins, just as a scan through the table
+    // would find it. An index is never destroyed (see ENUM_CONVERSION_END), conversions may still be
+    // done from the destructors of other statics.
+    template <typename ENUMERATE>
+    class EnumerateIndex {
+    private:
+        EnumerateIndex() = delete;
+        EnumerateIndex(const EnumerateIndex<ENUMERATE>&) = delete;
+        EnumerateIndex<ENUMERATE>& operator=(const EnumerateIndex<ENUMERATE>&) = delete;
+
+        static constexpr uint16_t Empty = 0xFFFF;
+
+    public:
+        EnumerateIndex(const EnumerateConversion<ENUMERATE> table[])
+            : _table(table)
+            , _entries(0)
+            , _mask(1)
+            , _lengths(nullptr)
+            , _caseSensitive(nullptr)
+            , _caseInsensitive(nullptr)
+            , _values(nullptr)
+        {
+            while (table[_entries].name != nullptr) {
+                _entries++;
+            }
+
+            // Keep the load below 50%, so probe sequences stay short.
+            while (_mask < (2 * _entries)) {
+                _mask <<= 1;
+            }
+
+            _lengths = new uint32_t[_entries];
+            _caseSensitive = new uint16_t[_mask];
+            _caseInsensitive = new uint16_t[_mask];
+            _values = new uint16_t[_mask];
+            _mask -= 1;
+
+            for (uint32_t slot = 0; slot <= _mask; slot++) {
+                _caseSensitive[slot] = Empty;
+                _caseInsensitive[slot] = Empty;
+                _values[slot] = Empty;
+            }
+
+            for (uint16_t index = 0; index < _entries; index++) {
+                _lengths[index] = (table[index].length != 0 ? table[index].length : static_cast<uint32_t>(_tcslen(table[index].name)));
+
+                Insert<true>(_caseSensitive, index);
+                Insert<false>(_caseInsensitive, index);
+
+                uint32_t slot = Slot(table[index].value);
+                while ((_values[slot] != Empty) && (table[_values[slot]].value != table[index].value)) {
+                    slot = (slot + 1) & _mask;
+                }
+                if (_values[slot] == Empty) {
+                    _values[slot] = index;
+                }
+            }
+        }
+        ~EnumerateIndex() = delete;
+
+    public:
+        // FNV-1a, on the folded characters for the case insensitive variant.
+        static uint32_t Hash(const TCHAR text[], const uint32_t length, const bool caseSensitive)
+        {
+            uint32_t hash = 0x811C9DC5;
+
+            for (uint32_t index = 0; index < length; index++) {
+                hash = (hash ^ static_cast<uint8_t>(caseSensitive ? text[index] : EnumerateFold(text[index]))) * 0x01000193;
+            }
+
+            return (hash);
+        }
+        template <bool CASESENSITIVE>
+        const EnumerateConversion<ENUMERATE>* Find(const TCHAR text[], const uint32_t length) const
+        {
+            const uint16_t* slots = (CASESENSITIVE == true ? _caseSensitive : _caseInsensitive);
+            uint32_t slot = Hash(text, length, CASESENSITIVE) & _mask;
+
+            while ((slots[slot] != Empty) && (Equal<CASESENSITIVE>(slots[slot], text, length) == false)) {
+                slot = (slot + 1) & _mask;
+            }
+
+            return (slots[slot] != Empty ? &(_table[slots[slot]]) : nullptr);
+        }
+        const EnumerateConversion<ENUMERATE>* Find(const ENUMERATE value) const
+        {
+            uint32_t slot = Slot(value);
+
+            while ((_values[slot] != Empty) && (_table[_values[slot]].value != value)) {
+                slot = (slot + 1) & _mask;
+            }
+
+            return (_values[slot] != Empty ? &(_table[_values[slot]]) : nullptr);
+        }
+
+    private:
+        inline uint32_t Slot(const ENUMERATE value) const
+        {
+            return ((static_cast<uint32_t>(value) * 0x9E3779B1) & _mask);
+        }
+        template <bool CASESENSITIVE>
+        bool Equal(const uint16_t index, const TCHAR text[], const uint32_t length) const
+        {
+            bool result = (_lengths[index] == length);
+
+            if (result == true) {
+                const TCHAR* name = _table[index].name;
+
+                if (CASESENSITIVE == true) {
+                    result = (::memcmp(name, text, length * sizeof(TCHAR)) == 0);
+                } else {
+                    for (uint32_t position = 0; (result == true) && (position < length); position++) {
+                        result = (EnumerateFold(name[position]) == EnumerateFold(text[position]));
+                    }
+                }
+            }
+
+            return (result);
+        }
+        template <bool CASESENSITIVE>
+        void Insert(uint16_t slots[], const uint16_t index)
+        {
+            const TCHAR* name = _table[index].name;
+            uint32_t slot = Hash(name, _lengths[index], CASESENSITIVE) & _mask;
+
+            while ((slots[slot] != Empty) && (Equal<CASESENSITIVE>(slots[slot], name, _lengths[index]) == false)) {
+                slot = (slot + 1) & _mask;
+            }
+            if (slots[slot] == Empty) {
+                slots[slot] = index;
+            }
+        }
+
+    private:
+        const EnumerateConversion<ENUMERATE>* _table;
+        uint16_t _entries;
+        uint32_t _mask;
+        uint32_t* _lengths;
+        uint16_t* _caseSensitive;
+        uint16_t* _caseInsensitive;
+        uint16_t* _values;
+    };
+
     template <typename ENUMERATE>
     class EnumerateType {
     private:
@@ -221,51 +380,24 @@ namespace Core { template<> EXTERNAL const typename Core::EnumerateConversion<EN
         // Attach a table to this global parameter to get string conversions
         static const EnumerateConversion<ENUMERATE>* Table(const uint16_t index);
 
+        // The hash index that comes with the table.
+        static const EnumerateIndex<ENUMERATE>& Index();
+
         template <bool CASESENSITIVE>
         const EnumerateConversion<ENUMERATE>* Find(const Core::TextFragment& value) const
         {
-            const struct EnumerateConversion<ENUMERATE>* runner = Table(0);
-
-            if (CASESENSITIVE == true) {
-                while ((runner->name != nullptr) && (value != Core::TextFragment(runner->name, 0, runner->length))) {
-                    runner++;
-                }
-            } else {
-                while ((runner->name != nullptr) && (value.EqualText(Core::TextFragment(runner->name, runner->length)) == false)) {
-                    runner++;
-                }
-            }
-
-            return ((runner->name != nullptr) ? runner : nullptr);
+            return (Index().template Find<CASESENSITIVE>(value.Data(), value.Length()));
         }
 
         template <bool CASESENSITIVE>
         const EnumerateConversion<ENUMERATE>* Find(const TCHAR value[]) const
         {
-            const struct EnumerateConversion<ENUMERATE>* runner = Table(0);
-
-            if (CASESENSITIVE == true) {
-                while ((runner->name != nullptr) && (_tcscmp(runner->name, value) != 0)) {
-                    runner++;
-                }
-            } else {
-                while ((runner->name != nullptr) && (_tcsicmp(runner->name, value) != 0)) {
-                    runner++;
-                }
-            }
-
-            return ((runner->name != nullptr) ? runner : nullptr);
+            return (Index().template Find<CASESENSITIVE>(value, static_cast<uint32_t>(_tcslen(value))));
         }
 
         const EnumerateConversion<ENUMERATE>* Find(const uint32_t value) const
         {
-            const struct EnumerateConversion<ENUMERATE>* runner = Table(0);
-
-            while ((runner->name != nullptr) && (runner->value != static_cast<ENUMERATE>(value))) {
-                runner++;
-            }
-
-            return ((runner->name != nullptr) ? runner : nullptr);
+            return (Index().Find(static_cast<ENUMERATE>(value)));
         }
     };
 }
@@ -6,7 +6,9 @@
 namespace WPEFramework {
 namespace Core {
 
-    template <const uint16_t BLOCKSIZE>
+    // SIZE_CONTEXT is the type used for offsets, lengths and the length prefix of text fields. The
+    // default keeps frames (and their wire format) limited to 64KB, use uint32_t for larger payloads.
+    template <const uint16_t BLOCKSIZE, typename SIZE_CONTEXT = uint16_t>
     class FrameType {
     private:
         template <const uint16_t STARTSIZE>
@@ -44,13 +46,13 @@ namespace Core {
             }
 
         public:
-            inline uint8_t& operator[](const uint16_t index)
+            inline uint8_t& operator[](const SIZE_CONTEXT index)
             {
                 ASSERT(_data != nullptr);
                 ASSERT(index < _bufferSize);
                 return (_data[index]);
             }
-            inline const uint8_t& operator[](const uint16_t index) const
+            inline const uint8_t& operator[](const SIZE_CONTEXT index) const
             {
                 ASSERT(_data != nullptr);
                 ASSERT(index < _bufferSize);
@@ -67,7 +69,7 @@ namespace Core {
             {
                 if (requiredSize > _bufferSize) {
 
-                    _bufferSize = static_cast<uint16_t>(((requiredSize / (STARTSIZE ? STARTSIZE : 1)) + 1) * STARTSIZE);
+                    _bufferSize = static_cast<SIZE_CONTEXT>(((requiredSize / (STARTSIZE ? STARTSIZE : 1)) + 1) * STARTSIZE);
 
                     // oops we need to "reallocate".
                     _data = reinterpret_cast<uint8_t*>(::realloc(_data, _bufferSize));
@@ -79,7 +81,7 @@ namespace Core {
             }
 
         private:
-            uint16_t _bufferSize;
+            SIZE_CONTEXT _bufferSize;
             uint8_t* _data;
         };
 
@@ -97,7 +99,7 @@ namespace Core {
                 , _container(nullptr)
             {
             }
-            Reader(const FrameType& data, const uint16_t offset)
+            Reader(const FrameType& data, const SIZE_CONTEXT offset)
                 : _offset(offset)
                 , _container(&data)
             {
@@ -116,7 +118,7 @@ namespace Core {
             {
                 return ((_container != nullptr) && (_offset < _container->Size()));
             }
-            inline uint16_t Length() const
+            inline SIZE_CONTEXT Length() const
             {
                 return (_container == nullptr ? 0 : _container->Size() - _offset);
             }
@@ -142,7 +144,7 @@ namespace Core {
             template <typename TYPENAME>
             TYPENAME Buffer(const TYPENAME maxLength, uint8_t buffer[]) const
             {
-                uint16_t result;
+                SIZE_CONTEXT result;
 
                 ASSERT(_container != nullptr);
 
@@ -151,7 +153,7 @@ namespace Core {
 
                 return (static_cast<TYPENAME>(result - sizeof(TYPENAME)));
             }
-            void Copy(const uint16_t length, uint8_t buffer[]) const
+            void Copy(const SIZE_CONTEXT length, uint8_t buffer[]) const
             {
                 ASSERT(_container != nullptr);
 
@@ -206,7 +208,7 @@ namespace Core {
 #endif
 
         private:
-            mutable uint16_t _offset;
+            mutable SIZE_CONTEXT _offset;
             const FrameType* _container;
         };
         class Writer {
@@ -220,7 +222,7 @@ namespace Core {
             {
             }
             // TODO: should we make offset 0 by default?
-            Writer(FrameType& data, const uint16_t offset)
+            Writer(FrameType& data, const SIZE_CONTEXT offset)
                 : _offset(offset)
                 , _container(&data)
             {
@@ -235,7 +237,7 @@ namespace Core {
             }
 
         public:
-            inline uint16_t Offset() const
+            inline SIZE_CONTEXT Offset() const
             {
                 return (_offset);
             }
@@ -246,7 +248,7 @@ namespace Core {
 
                 _offset += _container->SetBuffer<TYPENAME>(_offset, length, buffer);
             }
-            void Copy(const uint16_t length, const uint8_t buffer[])
+            void Copy(const SIZE_CONTEXT length, const uint8_t buffer[])
             {
                 ASSERT(_container != nullptr);
 
@@ -279,7 +281,7 @@ namespace Core {
             }
 
         private:
-            uint16_t _offset;
+            SIZE_CONTEXT _offset;
             FrameType* _container;
         };
 
@@ -290,7 +292,7 @@ namespace Core {
         {
             static_assert(BLOCKSIZE != 0, "This method can only be called if you specify an initial blocksize");
         }
-        FrameType(const FrameType<BLOCKSIZE>& copy)
+        FrameType(const FrameType<BLOCKSIZE, SIZE_CONTEXT>& copy)
             : _size(copy._size)
             , _data(copy._data)
         {
@@ -314,24 +316,24 @@ namespace Core {
         {
             return (_size);
         }
-        inline uint8_t& operator[](const uint16_t index)
+        inline uint8_t& operator[](const SIZE_CONTEXT index)
         {
             return _data[index];
         }
-        inline const uint8_t& operator[](const uint16_t index) const
+        inline const uint8_t& operator[](const SIZE_CONTEXT index) const
         {
             return _data[index];
         }
-        void Size(uint16_t size)
+        void Size(SIZE_CONTEXT size)
         {
             _data.Allocate(size);
 
             _size = size;
         }
         template <typename TYPENAME>
-        uint16_t SetBuffer(const uint16_t offset, const TYPENAME& length, const uint8_t buffer[])
+        SIZE_CONTEXT SetBuffer(const SIZE_CONTEXT offset, const TYPENAME& length, const uint8_t buffer[])
         {
-            uint16_t requiredLength(static_cast<uint16_t>(sizeof(TYPENAME) + length));
+            SIZE_CONTEXT requiredLength(static_cast<SIZE_CONTEXT>(sizeof(TYPENAME) + length));
 
             if ((offset + requiredLength) >= _size) {
                 Size(offset + requiredLength);
@@ -343,7 +345,7 @@ namespace Core {
             return (requiredLength);
         }
 
-        uint16_t Copy(const uint16_t offset, const uint16_t length, uint8_t buffer[]) const
+        SIZE_CONTEXT Copy(const SIZE_CONTEXT offset, const SIZE_CONTEXT length, uint8_t buffer[]) const
         {
             ASSERT(offset + length <= _size);
 
@@ -351,7 +353,7 @@ namespace Core {
 
             return (length);
         }
-        uint16_t Copy(const uint16_t offset, const uint16_t length, const uint8_t buffer[])
+        SIZE_CONTEXT Copy(const SIZE_CONTEXT offset, const SIZE_CONTEXT length, const uint8_t buffer[])
         {
             Size(offset + length);
 
@@ -359,16 +361,16 @@ namespace Core {
 
             return (length);
         }
-        uint16_t SetText(const uint16_t offset, const string& value)
+        SIZE_CONTEXT SetText(const SIZE_CONTEXT offset, const string& value)
         {
             std::string convertedText(Core::ToString(value));
-            return (SetBuffer<uint16_t>(offset, static_cast<uint16_t>(convertedText.length()), reinterpret_cast<const uint8_t*>(convertedText.c_str())));
+            return (SetBuffer<SIZE_CONTEXT>(offset, static_cast<SIZE_CONTEXT>(convertedText.length()), reinterpret_cast<const uint8_t*>(convertedText.c_str())));
         }
 
-        uint16_t SetNullTerminatedText(const uint16_t offset, const string& value)
+        SIZE_CONTEXT SetNullTerminatedText(const SIZE_CONTEXT offset, const string& value)
         {
             std::string convertedText(Core::ToString(value));
-            uint16_t requiredLength(convertedText.length() + 1);
+            SIZE_CONTEXT requiredLength(convertedText.length() + 1);
 
             if ((offset + requiredLength) >= _size) {
                 Size(offset + requiredLength);
@@ -380,7 +382,7 @@ namespace Core {
         }
 
         template <typename TYPENAME>
-        uint16_t GetBuffer(const uint16_t offset, const TYPENAME length, uint8_t buffer[]) const
+        SIZE_CONTEXT GetBuffer(const SIZE_CONTEXT offset, const TYPENAME length, uint8_t buffer[]) const
         {
             TYPENAME textLength;
 
@@ -391,42 +393,42 @@ namespace Core {
             ASSERT((textLength + offset + sizeof(TYPENAME)) <= _size);
 
             if ((textLength + offset + sizeof(TYPENAME)) > _size) {
-                textLength = (_size - (offset + static_cast<uint16_t>(sizeof(TYPENAME))));
+                textLength = (_size - (offset + static_cast<SIZE_CONTEXT>(sizeof(TYPENAME))));
             }
 
             memcpy(buffer, &(_data[offset + sizeof(TYPENAME)]), (textLength > length ? length : textLength));
 
-            return (static_cast<uint16_t>(sizeof(TYPENAME) + textLength));
+            return (static_cast<SIZE_CONTEXT>(sizeof(TYPENAME) + textLength));
         }
 
-        uint16_t GetText(const uint16_t offset, string& result) const
+        SIZE_CONTEXT GetText(const SIZE_CONTEXT offset, string& result) const
         {
-            uint16_t textLength;
-            ASSERT((offset + sizeof(uint16_t)) <= _size);
+            SIZE_CONTEXT textLength;
+            ASSERT((offset + sizeof(SIZE_CONTEXT)) <= _size);
 
-            GetNumber<uint16_t>(offset, textLength);
+            GetNumber<SIZE_CONTEXT>(offset, textLength);
 
-            ASSERT((textLength + offset + sizeof(uint16_t)) <= _size);
+            ASSERT((textLength + offset + sizeof(SIZE_CONTEXT)) <= _size);
 
-            if (textLength + offset + sizeof(uint16_t) > _size) {
-                textLength = (_size - (offset + sizeof(uint16_t)));
+            if (textLength + offset + sizeof(SIZE_CONTEXT) > _size) {
+                textLength = (_size - (offset + sizeof(SIZE_CONTEXT)));
             }
 
-            std::string convertedText(reinterpret_cast<const char*>(&(_data[offset + sizeof(uint16_t)])), textLength);
+            std::string convertedText(reinterpret_cast<const char*>(&(_data[offset + sizeof(SIZE_CONTEXT)])), textLength);
 
             result = Core::ToString(convertedText);
 
-            return (sizeof(uint16_t) + textLength);
+            return (sizeof(SIZE_CONTEXT) + textLength);
         }
 
-        uint16_t GetNullTerminatedText(const uint16_t offset, string& result) const
+        SIZE_CONTEXT GetNullTerminatedText(const SIZE_CONTEXT offset, string& result) const
         {
             const char* text = reinterpret_cast<const char*>(&(_data[offset]));
             result = text;
             return (result.length() + 1);
         }
 
-        uint16_t SetBoolean(const uint16_t offset, const bool value)
+        SIZE_CONTEXT SetBoolean(const SIZE_CONTEXT offset, const bool value)
         {
             if ((offset + 1) >= _size) {
                 Size(offset + 1);
@@ -437,7 +439,7 @@ namespace Core {
             return (1);
         }
 
-        uint16_t GetBoolean(const uint16_t offset, bool& value) const
+        SIZE_CONTEXT GetBoolean(const SIZE_CONTEXT offset, bool& value) const
         {
             ASSERT(offset < _size);
 
@@ -447,13 +449,13 @@ namespace Core {
         }
 
         template <typename TYPENAME>
-        inline uint16_t SetNumber(const uint16_t offset, const TYPENAME number)
+        inline SIZE_CONTEXT SetNumber(const SIZE_CONTEXT offset, const TYPENAME number)
         {
             return (SetNumber(offset, number, TemplateIntToType<sizeof(TYPENAME) == 1>()));
         }
 
         template <typename TYPENAME>
-        inline uint16_t GetNumber(const uint16_t offset, TYPENAME& number) const
+        inline SIZE_CONTEXT GetNumber(const SIZE_CONTEXT offset, TYPENAME& number) const
         {
             return (GetNumber(offset, number, TemplateIntToType<sizeof(TYPENAME) == 1>()));
         }
@@ -463,7 +465,7 @@ namespace Core {
         {
             static const TCHAR character[] = "0123456789ABCDEF";
             string info;
-            uint16_t index = offset;
+            SIZE_CONTEXT index = offset;
 
             while (index < _size) {
                 if (info.empty() == false) {
@@ -479,7 +481,7 @@ namespace Core {
 
     private:
         template <typename TYPENAME>
-        uint16_t SetNumber(const uint16_t offset, const TYPENAME number, const TemplateIntToType<true>&)
+        SIZE_CONTEXT SetNumber(const SIZE_CONTEXT offset, const TYPENAME number, const TemplateIntToType<true>&)
         {
             if ((offset + 1) >= _size) {
                 Size(offset + 1);
@@ -491,7 +493,7 @@ namespace Core {
         }
 
         template <typename TYPENAME>
-        uint16_t SetNumber(const uint16_t offset, const TYPENAME number, const TemplateIntToType<false>&)
+        SIZE_CONTEXT SetNumber(const SIZE_CONTEXT offset, const TYPENAME number, const TemplateIntToType<false>&)
         {
             if ((offset + sizeof(TYPENAME)) >= _size) {
                 Size(offset + sizeof(TYPENAME));
@@ -543,7 +545,7 @@ namespace Core {
         }
 
         template <typename TYPENAME>
-        uint16_t GetNumber(const uint16_t offset, TYPENAME& number, const TemplateIntToType<true>&) const
+        SIZE_CONTEXT GetNumber(const SIZE_CONTEXT offset, TYPENAME& number, const TemplateIntToType<true>&) const
         {
             // Only on package level allowed to pass the boundaries!!!
             ASSERT((offset + sizeof(TYPENAME)) <= _size);
@@ -554,7 +556,7 @@ namespace Core {
         }
 
         template <typename TYPENAME>
-        inline uint16_t GetNumber(const uint16_t offset, TYPENAME& value, const TemplateIntToType<false>&) const
+        inline SIZE_CONTEXT GetNumber(const SIZE_CONTEXT offset, TYPENAME& value, const TemplateIntToType<false>&) const
         {
             TYPENAME result;
 
@@ -610,7 +612,7 @@ namespace Core {
         }
 
     private:
-        mutable uint16_t _size;
+        mutable SIZE_CONTEXT _size;
         AllocatorType<BLOCKSIZE> _data;
     };
 }
@@ -18,7 +18,8 @@ namespace Core {
     struct IMessage {
     public:
         typedef IMessage BaseElement;
-        typedef uint32_t Identifier;
+        // The label in the lower 32 bits, the sequence that ties a response to its request in the upper 32 bits.
+        typedef uint64_t Identifier;
 
         class Serializer {
         private:
@@ -47,6 +48,7 @@ namespace Core {
                 // Serialize will not start processing until the current (and
                 // thius all other parameters) are set correctly.
                 _length = element.Length();
+                _sequence = element.Sequence();
                 _offset = 0;
                 _current = &element;
 
@@ -62,7 +64,7 @@ namespace Core {
 
                 while ((_current != nullptr) && (result < maxLength)) {
                     if (_offset < 4) {
-                        uint32_t length = _length + CommandSize();
+                        uint32_t length = _length + CommandSize() + SequenceSize();
 
                         // Write the length. Continue as long as the top bt is active..
                         while ((_offset < 4) && (result < maxLength)) {
@@ -91,16 +93,29 @@ namespace Core {
                         }
                     }
 
+                    // Write the sequence, Same structure as length..
+                    while ((_offset < 12) && (result < maxLength)) {
+                        uint32_t value = _sequence >> (7 * (_offset - 8));
+                        stream[result] = ((value & 0x7F) | (value >= 0x80 ? 0x80 : 0x00));
+                        result++;
+
+                        if (value >= 0x80) {
+                            _offset++;
+                        } else {
+                            _offset = 12;
+                        }
+                    }
+
                     if (result < maxLength) {
                         // Write the command, Same structure as length..
-                        uint16_t handled = _current->Serialize(&stream[result], maxLength - result, _offset - 8);
+                        uint16_t handled = _current->Serialize(&stream[result], maxLength - result, _offset - 12);
 
                         result += handled;
                         _offset += handled;
 
-                        ASSERT_VERBOSE((_offset - 8) <= _length, "%d <= %d", (_offset - 8), _length);
+                        ASSERT_VERBOSE((_offset - 12) <= _length, "%d <= %d", (_offset - 12), _length);
 
-                        if ((_offset - 8) == _length) {
+                        if ((_offset - 12) == _length) {
                             const IMessage* ready = _current;
                             _current = nullptr;
 
@@ -119,10 +134,15 @@ namespace Core {
             {
                 return (_current->Label() > 0x1FFFFF ? 4 : (_current->Label() > 0xCFFF ? 3 : (_current->Label() > 0x7F ? 2 : 1)));
             }
+            inline uint32_t SequenceSize() const
+            {
+                return (_sequence > 0x1FFFFF ? 4 : (_sequence > 0x3FFF ? 3 : (_sequence > 0x7F ? 2 : 1)));
+            }
 
         private:
             uint32_t _length;
             uint32_t _offset;
+            uint32_t _sequence;
             const IMessage* _current;
         };
 
@@ -136,6 +156,7 @@ namespace Core {
                 : _length(0)
                 , _offset(0)
                 , _label(0)
+                , _sequence(0)
                 , _current(nullptr)
             {
             }
@@ -145,14 +166,14 @@ namespace Core {
 
         public:
             virtual void Deserialized(IMessage& element) = 0;
-            virtual IMessage* Element(const uint32_t& label) = 0;
+            virtual IMessage* Element(const Identifier& identifier) = 0;
 
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength)
             {
                 uint16_t result = 0;
 
                 while (result < maxLength) {
-					if ((_current == nullptr) && (_offset < 8)) {
+					if ((_current == nullptr) && (_offset < 12)) {
                         // We have nothing, start by getting the length/command
                         while ((_offset < 4) && (result < maxLength)) {
                             _length |= ((stream[result] & (_offset == 3 ? 0xFF : 0x7F)) << (7 * _offset));
@@ -175,30 +196,42 @@ namespace Core {
                             }
                         }
 
-                        if (_offset == 8) {
-                            _current = Element(_label);
+                        while ((_offset < 12) && (result < maxLength)) {
+                            _sequence |= ((stream[result] & 0x7F) << (7 * (_offset - 8)));
+                            _length--;
+
+                            if ((stream[result++] & 0x80) != 0) {
+                                _offset++;
+                            } else {
+                                _offset = 12;
+                            }
+                        }
+
+                        if (_offset == 12) {
+                            _current = Element((static_cast<Identifier>(_sequence) << 32) | _label);
                             _label = 0;
+                            _sequence = 0;
                         }
                     }
 
-                    ASSERT((_offset - 8) <= _length);
+                    ASSERT((_offset - 12) <= _length);
 
-                    if ((_offset - 8) < _length) {
+                    if ((_offset - 12) < _length) {
 
                         // There could be multiple packages in this frame, do not read/handle more than what fits in the frame.
-                        uint16_t handled((maxLength - result) > static_cast<uint16_t>(_length - (_offset - 8)) ? static_cast<uint16_t>(_length - (_offset - 8)) : (maxLength - result));
+                        uint16_t handled((maxLength - result) > static_cast<uint16_t>(_length - (_offset - 12)) ? static_cast<uint16_t>(_length - (_offset - 12)) : (maxLength - result));
 
                         if (_current != nullptr) {
-                            handled = _current->Deserialize(&stream[result], handled, _offset - 8);
+                            handled = _current->Deserialize(&stream[result], handled, _offset - 12);
                         }
 
                         _offset += handled;
                         result += handled;
                     }
 
-                    ASSERT((_offset - 8) <= _length);
+                    ASSERT((_offset - 12) <= _length);
 
-                    if ((_offset - 8) == _length) {
+                    if ((_offset - 12) == _length) {
                         if (_current != nullptr) {
                             IMessage* ready = _current;
                             _current = nullptr;
@@ -215,6 +248,7 @@ namespace Core {
             uint32_t _length;
             uint32_t _offset;
             uint32_t _label;
+            uint32_t _sequence;
             IMessage* _current;
         };
 
@@ -222,6 +256,7 @@ namespace Core {
         virtual ~IMessage() {}
 
         virtual uint32_t Label() const = 0;
+        virtual uint32_t Sequence() const = 0;
         virtual uint32_t Length() const = 0;
         virtual uint16_t Serialize(uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) const = 0;
         virtual uint16_t Deserialize(const uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) = 0;
@@ -232,6 +267,8 @@ namespace Core {
         virtual ~IIPC();
 
         virtual uint32_t Label() const = 0;
+        virtual uint32_t Sequence() const = 0;
+        virtual void Sequence(const uint32_t sequence) = 0;
         virtual ProxyType<IMessage> IParameters() = 0;
         virtual ProxyType<IMessage> IResponse() = 0;
     };
@@ -285,6 +322,10 @@ namespace Core {
             {
                 return (REALIDENTIFIER);
             }
+            virtual uint32_t Sequence() const
+            {
+                return (_parent.Sequence());
+            }
             virtual uint32_t Length() const
             {
                 return (_Length<PACKAGE, REALIDENTIFIER>());
@@ -416,11 +457,13 @@ namespace Core {
         IPCMessageType()
             : _parameters(*this)
             , _response(*this)
+            , _sequence(0)
         {
         }
         IPCMessageType(const PARAMETERS& info)
             : _parameters(*this, info)
             , _response(*this)
+            , _sequence(0)
         {
         }
 #ifdef __WINDOWS__
@@ -453,6 +496,14 @@ namespace Core {
         {
             return (IDENTIFIER);
         }
+        virtual uint32_t Sequence() const
+        {
+            return (_sequence);
+        }
+        virtual void Sequence(const uint32_t sequence)
+        {
+            _sequence = sequence;
+        }
         virtual ProxyType<IMessage> IParameters()
         {
             return ProxyType<IMessage>(&_parameters, &_parameters);
@@ -470,6 +521,7 @@ namespace Core {
     private:
         RawSerializedType<PARAMETERS, (IDENTIFIER << 1)> _parameters;
         RawSerializedType<RESPONSE, ((IDENTIFIER << 1) | 0x1)> _response;
+        uint32_t _sequence;
     };
 
     class EXTERNAL IPCChannel {
@@ -485,11 +537,20 @@ namespace Core {
             IPCFactory(const IPCFactory& copy) = delete;
             IPCFactory& operator=(const IPCFactory&) = delete;
 
+            // Calls that are waiting for a response, by the sequence they were sent out with.
+            struct Outbound {
+                Core::ProxyType<IIPC> message;
+                IDispatchType<IIPC>* callback;
+                bool synchronous;
+                bool aborted;
+            };
+            typedef std::unordered_map<uint32_t, Outbound> OutboundMap;
+
             IPCFactory()
                 : _lock()
                 , _inbound()
                 , _outbound()
-                , _callback(nullptr)
+                , _sequence(0)
                 , _factory()
                 , _handlers()
             {
@@ -506,7 +567,7 @@ namespace Core {
                 : _lock()
                 , _inbound()
                 , _outbound()
-                , _callback(nullptr)
+                , _sequence(0)
                 , _factory(factory)
                 , _handlers()
             {
@@ -559,21 +620,31 @@ namespace Core {
 
             inline bool InProgress() const
             {
-                return (_outbound.IsValid());
+                _lock.Lock();
+
+                bool result = (_outbound.empty() == false);
+
+                _lock.Unlock();
+
+                return (result);
             }
 
-            inline ProxyType<IMessage> Element(const uint32_t& identifier)
+            inline ProxyType<IMessage> Element(const IMessage::Identifier& identifier)
             {
                 ProxyType<IMessage> result;
-                uint32_t searchIdentifier(identifier >> 1);
+                uint32_t label(static_cast<uint32_t>(identifier & 0xFFFFFFFF));
+                uint32_t sequence(static_cast<uint32_t>(identifier >> 32));
+                uint32_t searchIdentifier(label >> 1);
 
                 _lock.Lock();
 
-                if (identifier & 0x01) {
-                    if ((_outbound.IsValid() == true) && (_outbound->Label() == searchIdentifier)) {
-                        result = _outbound->IResponse();
+                if (label & 0x01) {
+                    OutboundMap::iterator index(_outbound.find(sequence));
+
+                    if ((index != _outbound.end()) && (index->second.aborted == false) && (index->second.message->Label() == searchIdentifier)) {
+                        result = index->second.message->IResponse();
                     } else {
-                        TRACE_L1("Unexpected response message for ID [%d].\n", searchIdentifier);
+                        TRACE_L1("Unexpected response message for ID [%d], sequence [%d].\n", searchIdentifier, sequence);
                     }
                 } else {
                     ASSERT(_inbound.IsValid() == false);
@@ -581,6 +652,8 @@ namespace Core {
                     ProxyType<IIPC> rpcCall(_factory->Element(searchIdentifier));
 
                     if (rpcCall.IsValid() == true) {
+                        // The response goes out with the sequence of the request.
+                        rpcCall->Sequence(sequence);
                         _inbound = rpcCall;
                         result = rpcCall->IParameters();
                     } else {
@@ -599,11 +672,17 @@ namespace Core {
 
                 TRACE_L1("Flushing the IPC mechanims. %d", __LINE__);
 
-                _callback = nullptr;
+                // Synchronous calls clean up after themselves, once their waiting thread picks up the abort.
+                OutboundMap::iterator index(_outbound.begin());
 
-                if (_outbound.IsValid() == true) {
-                    _outbound.Release();
+                while (index != _outbound.end()) {
+                    if (index->second.synchronous == false) {
+                        index = _outbound.erase(index);
+                    } else {
+                        index++;
+                    }
                 }
+
                 if (_inbound.IsValid() == true) {
                     _inbound.Release();
                 }
@@ -614,18 +693,33 @@ namespace Core {
             inline ProxyType<IIPCServer> ReceivedMessage(const Core::ProxyType<IMessage>& rhs, Core::ProxyType<IIPC>& inbound)
             {
                 ProxyType<IIPCServer> procedure;
+                ProxyType<IIPC> completed;
+                IDispatchType<IIPC>* completion = nullptr;
 
                 _lock.Lock();
 
-                if ((_outbound.IsValid() == true) && (_outbound->IResponse() == rhs)) {
+                if ((rhs->Label() & 0x01) != 0) {
+                    OutboundMap::iterator index(_outbound.find(rhs->Sequence()));
+
+                    if ((index != _outbound.end()) && (index->second.message->IResponse() == rhs)) {
+
+                        ASSERT(index->second.callback != nullptr);
 
-                    ASSERT(_callback != nullptr);
+                        ProxyType<IIPC> handledObject(index->second.message);
+                        IDispatchType<IIPC>* callback(index->second.callback);
+                        const bool synchronous(index->second.synchronous);
 
-                    ProxyType<IIPC> handledObject(_outbound);
+                        _outbound.erase(index);
 
-                    _outbound.Release();
-                    _callback->Dispatch(*handledObject);
-                    _callback = nullptr;
+                        if (synchronous == true) {
+                            callback->Dispatch(*handledObject);
+                        } else {
+                            completed = handledObject;
+                            completion = callback;
+                        }
+                    } else {
+                        TRACE_L1("Response for sequence [%d] arrived after the call was aborted.", rhs->Sequence());
+                    }
                 }
                 // If this is *NOT* the outbound call, it is inbound and thus it must have been registered
                 else if (_inbound.IsValid() == true) {
@@ -648,52 +742,105 @@ namespace Core {
 
                 _lock.Unlock();
 
+                // Like in AbortOutbound, a completion callback may invoke again.
+                if (completion != nullptr) {
+                    completion->Dispatch(*completed);
+                }
+
                 return (procedure);
             }
 
-            inline void SetOutbound(const Core::ProxyType<IIPC>& outbound, IDispatchType<IIPC>* callback)
+            // Any number of calls can be outstanding, the sequence ties the response to the call.
+            inline uint32_t SetOutbound(const Core::ProxyType<IIPC>& outbound, IDispatchType<IIPC>* callback, const bool synchronous)
             {
                 _lock.Lock();
 
                 ASSERT((outbound.IsValid() == true) && (callback != nullptr));
-                ASSERT((_outbound.IsValid() == false) && (_callback == nullptr));
 
-                _outbound = outbound;
-                _callback = callback;
+                // Keep it within 28 bits, so it fits the 4 bytes reserved for it on the line.
+                _sequence = (_sequence + 1) & 0x0FFFFFFF;
+
+                ASSERT(_outbound.find(_sequence) == _outbound.end());
+
+                Outbound& entry(_outbound[_sequence]);
+                entry.message = outbound;
+                entry.callback = callback;
+                entry.synchronous = synchronous;
+                entry.aborted = false;
+
+                outbound->Sequence(_sequence);
+
+                uint32_t result = _sequence;
 
                 _lock.Unlock();
+
+                return (result);
             }
 
-            inline bool AbortOutbound()
+            // Drop a call that is no longer waited for. Returns true if no response was received for it.
+            inline bool AbortOutbound(const uint32_t sequence)
             {
                 bool result = false;
 
                 _lock.Lock();
 
-                if (_outbound.IsValid() == true) {
+                OutboundMap::iterator index(_outbound.find(sequence));
 
+                if (index != _outbound.end()) {
                     result = true;
+                    _outbound.erase(index);
+                }
+
+                _lock.Unlock();
+
+                return (result);
+            }
+
+            inline bool AbortOutbound()
+            {
+                std::vector<std::pair<IDispatchType<IIPC>*, Core::ProxyType<IIPC>>> completions;
+                bool result = false;
+
+                _lock.Lock();
 
-                    if (_callback != nullptr) {
-                        _callback->Dispatch(*_outbound);
-                        _callback = nullptr;
+                OutboundMap::iterator index(_outbound.begin());
+
+                while (index != _outbound.end()) {
+                    if (index->second.aborted == false) {
+                        result = true;
+
+                        index->second.aborted = true;
+
+                        if (index->second.synchronous == true) {
+                            // Only wakes up the waiting thread, which can not leave before it took the entry out under this lock.
+                            index->second.callback->Dispatch(*(index->second.message));
+                        } else {
+                            completions.emplace_back(index->second.callback, index->second.message);
+                        }
                     }
 
-                    _outbound.Release();
-                } else {
-                    ASSERT(_callback == nullptr);
+                    if (index->second.synchronous == false) {
+                        index = _outbound.erase(index);
+                    } else {
+                        index++;
+                    }
                 }
 
                 _lock.Unlock();
 
+                // Completion callbacks may well invoke again, so they are called without the lock.
+                for (std::pair<IDispatchType<IIPC>*, Core::ProxyType<IIPC>>& completion : completions) {
+                    completion.first->Dispatch(*(completion.second));
+                }
+
                 return (result);
             }
 
         private:
             mutable CriticalSection _lock;
             Core::ProxyType<IIPC> _inbound;
-            mutable Core::ProxyType<IIPC> _outbound;
-            IDispatchType<IIPC>* _callback;
+            OutboundMap _outbound;
+            uint32_t _sequence;
             Core::ProxyType<FactoryType<IIPC, uint32_t>> _factory;
             std::map<uint32_t, ProxyType<IIPCServer>> _handlers;
         };
@@ -750,12 +897,25 @@ namespace Core {
         {
             return (Execute(command, waitTime));
         }
+        // Send out the command, without waiting for (or expecting) a response.
+        template <typename ACTUALELEMENT>
+        inline uint32_t Post(ProxyType<ACTUALELEMENT>& command)
+        {
+            Core::ProxyType<IIPC> base(Core::proxy_cast<IIPC>(command));
+            return (Execute(base));
+        }
 
         virtual uint32_t ReportResponse(Core::ProxyType<IIPC>& inbound) = 0;
 
+        // Out of band: a file descriptor to pass to the other side, it travels along with the next message
+        // sent on this channel, which can carry the returned index. See SocketPort::Offer and Claim.
+        virtual uint32_t Offer(const int descriptor) = 0;
+        virtual int Claim(const uint32_t index) = 0;
+
     private:
         virtual uint32_t Execute(ProxyType<IIPC>& command, IDispatchType<IIPC>* completed) = 0;
         virtual uint32_t Execute(ProxyType<IIPC>& command, const uint32_t waitTime) = 0;
+        virtual uint32_t Execute(ProxyType<IIPC>& command) = 0;
 
     protected:
         IPCFactory _administration;
@@ -882,16 +1042,16 @@ namespace Core {
             }
 
         public:
-            uint32_t Wait(const uint32_t waitTime)
+            uint32_t Wait(const uint32_t sequence, const uint32_t waitTime)
             {
                 uint32_t result = Core::ERROR_NONE;
 
                 // Now we wait for ever, to get a signal that we are done :-)
                 if (_signal.Lock(waitTime) != Core::ERROR_NONE) {
-                    _administration.AbortOutbound();
+                    _administration.AbortOutbound(sequence);
 
                     result = Core::ERROR_TIMEDOUT;
-                } else if (_administration.AbortOutbound() == true) {
+                } else if (_administration.AbortOutbound(sequence) == true) {
                     result = Core::ERROR_ASYNC_FAILED;
                 }
 
@@ -1012,11 +1172,23 @@ namespace Core {
         }
         virtual uint32_t ReportResponse(Core::ProxyType<IIPC>& inbound)
         {
+            uint32_t result = Core::ERROR_CONNECTION_CLOSED;
 
             // We got the event, start the invoke, wait for the event to be set again..
-            _link.SendResponse(inbound);
+            if (_link.IsOpen() == true) {
+                _link.SendResponse(inbound);
+                result = Core::ERROR_NONE;
+            }
 
-            return (Core::ERROR_NONE);
+            return (result);
+        }
+        virtual uint32_t Offer(const int descriptor)
+        {
+            return (_link.Link().Offer(descriptor));
+        }
+        virtual int Claim(const uint32_t index)
+        {
+            return (_link.Link().Claim(index));
         }
         virtual void StateChange()
         {
@@ -1041,18 +1213,16 @@ namespace Core {
         {
         }
 
+        // Calls are not serialized, every call is tagged with its own sequence so any number of them
+        // can be in flight on the channel. Responses are matched on that sequence, not on arrival order.
         virtual uint32_t Execute(ProxyType<IIPC>& command, IDispatchType<IIPC>* completed)
         {
             uint32_t success = Core::ERROR_UNAVAILABLE;
 
-            _serialize.Lock();
-
-            if (_administration.InProgress() == true) {
-                success = Core::ERROR_INPROGRESS;
-            } else if (_link.IsOpen() == true) {
+            if (_link.IsOpen() == true) {
                 // We need to accept a CONST object to avoid an additional object creation
                 // proxy casted objects.
-                _administration.SetOutbound(command, completed);
+                _administration.SetOutbound(command, completed, false);
 
                 // Send out the
                 _link.Submit(command->IParameters());
@@ -1060,30 +1230,39 @@ namespace Core {
                 success = Core::ERROR_NONE;
             }
 
-            _serialize.Unlock();
-
             return (success);
         }
         virtual uint32_t Execute(ProxyType<IIPC>& command, const uint32_t waitTime)
         {
             uint32_t success = Core::ERROR_CONNECTION_CLOSED;
 
-            _serialize.Lock();
-
             if (_link.IsOpen() == true) {
                 IPCTrigger sink(_administration);
 
                 // We need to accept a CONST object to avoid an additional object creation
                 // proxy casted objects.
-                _administration.SetOutbound(command, &sink);
+                uint32_t sequence = _administration.SetOutbound(command, &sink, true);
 
                 // Send out the
                 _link.Submit(command->IParameters());
 
-                success = sink.Wait(waitTime);
+                success = sink.Wait(sequence, waitTime);
             }
 
-            _serialize.Unlock();
+            return (success);
+        }
+        virtual uint32_t Execute(ProxyType<IIPC>& command)
+        {
+            uint32_t success = Core::ERROR_CONNECTION_CLOSED;
+
+            if (_link.IsOpen() == true) {
+                // Nothing comes back, so there is no outbound administration to keep.
+                command->Sequence(0);
+
+                _link.Submit(command->IParameters());
+
+                success = Core::ERROR_NONE;
+            }
 
             return (success);
         }
@@ -1093,7 +1272,6 @@ namespace Core {
         }
 
     private:
-        CriticalSection _serialize;
         IPCLink _link;
         EXTENSION _extension;
     };
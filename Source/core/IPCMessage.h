@@ -239,10 +239,10 @@ namespace Core {
                 : _buffer()
             {
             }
-            inline BufferType(const uint16_t length, const uint8_t buffer[])
+            inline BufferType(const uint32_t length, const uint8_t buffer[])
                 : _buffer()
             {
-                _buffer.SetBufferType(0, length, buffer);
+                _buffer.Copy(0, length, buffer);
             }
             inline ~BufferType()
             {
@@ -260,12 +260,12 @@ namespace Core {
             {
                 return (&(_buffer[0]));
             }
-            inline void Set (const uint16_t length, const uint8_t buffer[]) {
+            inline void Set (const uint32_t length, const uint8_t buffer[]) {
                 _buffer.Copy(0, length, buffer);
             }
             inline uint16_t Serialize(uint8_t buffer[], const uint16_t length, const uint32_t offset) const
             {
-                uint16_t size = ((_buffer.Size() - offset) > length ? length : (_buffer.Size() - offset));
+                uint16_t size = static_cast<uint16_t>((_buffer.Size() - offset) > length ? length : (_buffer.Size() - offset));
                 ::memcpy(buffer, &(_buffer[offset]), size);
 
                 return (size);
@@ -282,7 +282,8 @@ namespace Core {
             }
 
         private:
-            Core::FrameType<LENGTH> _buffer;
+            // Sent in chunks, so the buffer itself may exceed 64KB.
+            Core::FrameType<LENGTH, uint32_t> _buffer;
         };
  
     }
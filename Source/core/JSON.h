@@ -67,28 +67,40 @@ namespace Core {
         struct EXTERNAL IElement {
 
             static char NullTag[];
+            static constexpr uint32_t MaxWindow = 0x100000;
 
             virtual ~IElement() {}
 
             template <typename INSTANCEOBJECT>
             static bool ToString(const INSTANCEOBJECT& realObject, string& text)
             {
-                char buffer[1024];
-                uint16_t loaded;
-                uint16_t offset = 0;
+                uint32_t window = 1024;
+                uint32_t length = 0;
+                uint32_t loaded;
+                uint32_t offset = 0;
 
                 text.clear();
 
-                // Serialize object
+                // Serialize object straight into the string, doubling the window for large documents
+                // so a multi megabyte object does not take thousands of 1KB round trips.
                 do {
-                    loaded = static_cast<const IElement&>(realObject).Serialize(buffer, sizeof(buffer), offset);
+                    text.resize(length + window);
 
-                    ASSERT(loaded <= sizeof(buffer));
-                    DEBUG_VARIABLE(loaded);
+                    loaded = static_cast<const IElement&>(realObject).Serialize(&(text[length]), window, offset);
 
-                    text += string(buffer, loaded);
+                    ASSERT(loaded <= window);
 
-                } while ((offset != 0) && (loaded == sizeof(buffer)));
+                    length += loaded;
+
+                    if ((loaded == window) && (window < MaxWindow)) {
+                        window <<= 1;
+                    } else if (loaded < window) {
+                        break;
+                    }
+
+                } while (offset != 0);
+
+                text.resize(length);
 
                 return (offset == 0);
             }
@@ -103,13 +115,13 @@ namespace Core {
             template <typename INSTANCEOBJECT>
             static bool FromString(const string& text, INSTANCEOBJECT& realObject, Core::OptionalType<Error>& error)
             {
-                uint16_t offset = 0;
+                uint32_t offset = 0;
 
                 realObject.Clear();
 
                 if (text.empty() == false) {
                     // Deserialize object
-                    uint16_t loaded = static_cast<IElement&>(realObject).Deserialize(text.c_str(), static_cast<uint16_t>(text.length() + 1), offset, error);
+                    uint32_t loaded = static_cast<IElement&>(realObject).Deserialize(text.c_str(), static_cast<uint32_t>(text.length() + 1), offset, error);
 
                     ASSERT(loaded <= (text.length() + 1));
                     DEBUG_VARIABLE(loaded);
@@ -151,8 +163,8 @@ namespace Core {
                 if (fileObject.IsOpen()) {
 
                     char buffer[1024];
-                    uint16_t loaded;
-                    uint16_t offset = 0;
+                    uint32_t loaded;
+                    uint32_t offset = 0;
 
                     // Serialize object
                     do {
@@ -181,15 +193,15 @@ namespace Core {
                 if (fileObject.IsOpen()) {
 
                     char buffer[1024];
-                    uint16_t readBytes;
-                    uint16_t loaded;
-                    uint16_t offset = 0;
+                    uint32_t readBytes;
+                    uint32_t loaded;
+                    uint32_t offset = 0;
 
                     realObject.Clear();
 
                     // Serialize object
                     do {
-                        readBytes = static_cast<uint16_t>(fileObject.Read(reinterpret_cast<uint8_t*>(buffer), sizeof(buffer)));
+                        readBytes = static_cast<uint32_t>(fileObject.Read(reinterpret_cast<uint8_t*>(buffer), sizeof(buffer)));
 
                         if (readBytes == 0) {
                             loaded = ~0;
@@ -239,11 +251,22 @@ namespace Core {
             virtual void Clear() = 0;
             virtual bool IsSet() const = 0;
             virtual bool IsNull() const = 0;
-            virtual uint16_t Serialize(char Stream[], const uint16_t MaxLength, uint16_t& offset) const = 0;
-            uint16_t Deserialize(const char Stream[], const uint16_t MaxLength, uint16_t& offset)
+            virtual uint32_t Serialize(char Stream[], const uint32_t MaxLength, uint32_t& offset) const
+            {
+                // Only reached by an element that implements the 16 bits variant below.
+                ASSERT(offset <= 0xFFFF);
+
+                uint16_t legacyOffset(static_cast<uint16_t>(offset));
+                const uint16_t loaded = Serialize(Stream, static_cast<uint16_t>(std::min(MaxLength, static_cast<uint32_t>(0xFFFF))), legacyOffset);
+
+                offset = legacyOffset;
+
+                return (loaded);
+            }
+            uint32_t Deserialize(const char Stream[], const uint32_t MaxLength, uint32_t& offset)
             {
                 Core::OptionalType<Error> error;
-                uint16_t loaded = Deserialize(Stream, MaxLength, offset, error);
+                uint32_t loaded = Deserialize(Stream, MaxLength, offset, error);
 
                 if (error.IsSet() == true) {
                     Clear();
@@ -253,7 +276,35 @@ namespace Core {
 
                 return loaded;
             }
-            virtual uint16_t Deserialize(const char Stream[], const uint16_t MaxLength, uint16_t& offset, Core::OptionalType<Error>& error) = 0;
+            virtual uint32_t Deserialize(const char Stream[], const uint32_t MaxLength, uint32_t& offset, Core::OptionalType<Error>& error)
+            {
+                // Only reached by an element that implements the 16 bits variant below.
+                ASSERT(offset <= 0xFFFF);
+
+                uint16_t legacyOffset(static_cast<uint16_t>(offset));
+                const uint16_t loaded = Deserialize(Stream, static_cast<uint16_t>(std::min(MaxLength, static_cast<uint32_t>(0xFFFF))), legacyOffset, error);
+
+                offset = legacyOffset;
+
+                return (loaded);
+            }
+
+            // Deprecated, the interface from before lengths and offsets were 32 bits. Elements that still
+            // implement these instead of the variants above keep working, in chunks of at most 64KB.
+            virtual uint16_t Serialize(char /* Stream */[], const uint16_t /* MaxLength */, uint16_t& /* offset */) const
+            {
+                // One of both variants has to be implemented.
+                ASSERT(false);
+
+                return (0);
+            }
+            virtual uint16_t Deserialize(const char /* Stream */[], const uint16_t /* MaxLength */, uint16_t& /* offset */, Core::OptionalType<Error>& /* error */)
+            {
+                // One of both variants has to be implemented.
+                ASSERT(false);
+
+                return (0);
+            }
         };
 
         struct EXTERNAL IMessagePack {
@@ -265,8 +316,8 @@ namespace Core {
             static bool ToBuffer(std::vector<uint8_t>& stream, const INSTANCEOBJECT& realObject)
             {
                 uint8_t buffer[1024];
-                uint16_t loaded;
-                uint16_t offset = 0;
+                uint32_t loaded;
+                uint32_t offset = 0;
 
                 stream.clear();
                 // Serialize object
@@ -285,13 +336,13 @@ namespace Core {
             template <typename INSTANCEOBJECT>
             static bool FromBuffer(const std::vector<uint8_t>& stream, INSTANCEOBJECT& realObject)
             {
-                uint16_t offset = 0;
+                uint32_t offset = 0;
 
                 realObject.Clear();
 
                 if (stream.size() != 0) {
                     // Deserialize object
-                    uint16_t loaded = static_cast<IMessagePack&>(realObject).Deserialize(&stream[0], static_cast<uint16_t>(stream.size() + 1), offset);
+                    uint32_t loaded = static_cast<IMessagePack&>(realObject).Deserialize(&stream[0], static_cast<uint32_t>(stream.size() + 1), offset);
 
                     ASSERT(loaded <= (stream.size() + 1));
                     DEBUG_VARIABLE(loaded);
@@ -312,8 +363,8 @@ namespace Core {
                 if (fileObject.IsOpen()) {
 
                     uint8_t buffer[1024];
-                    uint16_t loaded;
-                    uint16_t offset = 0;
+                    uint32_t loaded;
+                    uint32_t offset = 0;
 
                     // Serialize object
                     do {
@@ -338,15 +389,15 @@ namespace Core {
                 if (fileObject.IsOpen()) {
 
                     uint8_t buffer[1024];
-                    uint16_t readBytes;
-                    uint16_t loaded;
-                    uint16_t offset = 0;
+                    uint32_t readBytes;
+                    uint32_t loaded;
+                    uint32_t offset = 0;
 
                     realObject.Clear();
 
                     // Serialize object
                     do {
-                        readBytes = static_cast<uint16_t>(fileObject.Read(reinterpret_cast<uint8_t*>(buffer), sizeof(buffer)));
+                        readBytes = static_cast<uint32_t>(fileObject.Read(reinterpret_cast<uint8_t*>(buffer), sizeof(buffer)));
 
                         if (readBytes == 0) {
                             loaded = ~0;
@@ -396,8 +447,46 @@ namespace Core {
             virtual void Clear() = 0;
             virtual bool IsSet() const = 0;
             virtual bool IsNull() const = 0;
-            virtual uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const = 0;
-            virtual uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) = 0;
+            virtual uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const
+            {
+                // Only reached by an element that implements the 16 bits variant below.
+                ASSERT(offset <= 0xFFFF);
+
+                uint16_t legacyOffset(static_cast<uint16_t>(offset));
+                const uint16_t loaded = Serialize(stream, static_cast<uint16_t>(std::min(maxLength, static_cast<uint32_t>(0xFFFF))), legacyOffset);
+
+                offset = legacyOffset;
+
+                return (loaded);
+            }
+            virtual uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset)
+            {
+                // Only reached by an element that implements the 16 bits variant below.
+                ASSERT(offset <= 0xFFFF);
+
+                uint16_t legacyOffset(static_cast<uint16_t>(offset));
+                const uint16_t loaded = Deserialize(stream, static_cast<uint16_t>(std::min(maxLength, static_cast<uint32_t>(0xFFFF))), legacyOffset);
+
+                offset = legacyOffset;
+
+                return (loaded);
+            }
+
+            // Deprecated, see IElement.
+            virtual uint16_t Serialize(uint8_t /* stream */[], const uint16_t /* maxLength */, uint16_t& /* offset */) const
+            {
+                // One of both variants has to be implemented.
+                ASSERT(false);
+
+                return (0);
+            }
+            virtual uint16_t Deserialize(const uint8_t /* stream */[], const uint16_t /* maxLength */, uint16_t& /* offset */)
+            {
+                // One of both variants has to be implemented.
+                ASSERT(false);
+
+                return (0);
+            }
         };
 
         enum class ValueValidity : int8_t {
@@ -407,7 +496,7 @@ namespace Core {
             VALID
         };
 
-        static ValueValidity IsNullValue(const char stream[], const uint16_t maxLength, uint16_t& offset, uint16_t& loaded)
+        static ValueValidity IsNullValue(const char stream[], const uint32_t maxLength, uint32_t& offset, uint32_t& loaded)
         {
             ValueValidity validity = ValueValidity::INVALID;
             const size_t nullTagLen = strlen(IElement::NullTag);
@@ -528,9 +617,9 @@ namespace Core {
         private:
             // IElement iface:
             // If this should be serialized/deserialized, it is indicated by a MinSize > 0)
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 ASSERT(maxLength > 0);
 
@@ -589,9 +678,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     // We are starting, see what the current char is
@@ -719,7 +808,7 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 if ((_set & UNDEFINED) != 0) {
                     stream[0] = IMessagePack::NullValue;
@@ -728,7 +817,7 @@ namespace Core {
                 return (Convert(stream, maxLength, offset, TemplateIntToType<SIGNED>()));
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
                 uint8_t loaded = 0;
                 if (offset == 0) {
@@ -766,10 +855,10 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Convert(char stream[], const uint16_t maxLength, uint16_t& offset, const TYPE serialize) const
+            uint32_t Convert(char stream[], const uint32_t maxLength, uint32_t& offset, const TYPE serialize) const
             {
                 uint8_t parsed = 4;
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 TYPE divider = 1;
                 TYPE value = (serialize / BASETYPE);
 
@@ -801,17 +890,17 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Convert(char stream[], const uint16_t maxLength, uint16_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
+            uint32_t Convert(char stream[], const uint32_t maxLength, uint32_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
             {
                 return (Convert(stream, maxLength, offset, _value));
             }
 
-            uint16_t Convert(char stream[], const uint16_t maxLength, uint16_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
+            uint32_t Convert(char stream[], const uint32_t maxLength, uint32_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
             {
                 return (Convert(stream, maxLength, offset, ::abs(_value)));
             }
 
-            uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint16_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
+            uint32_t Convert(uint8_t stream[], const uint32_t maxLength, uint32_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
             {
                 uint8_t loaded = 0;
                 uint8_t bytes = (_value <= 0x7F ? 0 : _value < 0xFF ? 1 : _value < 0xFFFF ? 2 : _value < 0xFFFFFFFF ? 4 : 8);
@@ -854,7 +943,7 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint16_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
+            uint32_t Convert(uint8_t stream[], const uint32_t maxLength, uint32_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
             {
                 uint8_t loaded = 0;
                 uint8_t bytes = (((_value < 16) && (_value > -15)) ? 0 : ((_value < 128) && (_value > -127)) ? 1 : ((_value < 32767) && (_value > -32766)) ? 2 : ((_value < 2147483647) && (_value > -2147483646)) ? 4 : 8);
@@ -1011,12 +1100,12 @@ namespace Core {
 
         private:
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 static constexpr char trueBuffer[] = "true";
                 static constexpr char falseBuffer[] = "false";
 
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if ((_value & NullBit) != 0) {
                     while ((loaded < maxLength) && (offset < 4)) {
                         stream[loaded++] = NullTag[offset++];
@@ -1042,9 +1131,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 static constexpr char trueBuffer[] = "true";
                 static constexpr char falseBuffer[] = "false";
 
@@ -1095,7 +1184,7 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 if ((_value & NullBit) != 0) {
                     stream[0] = IMessagePack::NullValue;
@@ -1107,7 +1196,7 @@ namespace Core {
                 return (1);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
                 if ((stream[0] == IMessagePack::NullValue) != 0) {
                     _value = NullBit;
@@ -1195,6 +1284,14 @@ namespace Core {
                 return (*this);
             }
 
+            String& operator=(std::string&& RHS)
+            {
+                _value = std::move(RHS);
+                _scopeCount |= SetBit;
+
+                return (*this);
+            }
+
             String& operator=(const char RHS[])
             {
                 Core::ToString(RHS, _value);
@@ -1284,6 +1381,19 @@ namespace Core {
                 return (((_scopeCount & (SetBit | NullBit)) == SetBit) ? Core::ToString(_value.c_str()) : Core::ToString(_default.c_str()));
             }
 
+            // The text as it was deserialized, handed out without a copy. Only valid if IsRaw() holds.
+            inline const std::string& Raw() const
+            {
+                ASSERT(IsRaw() == true);
+
+                return (((_scopeCount & SetBit) != 0) ? _value : _default);
+            }
+
+            inline bool IsRaw() const
+            {
+                return ((_scopeCount & (NullBit | QuoteFoundBit)) == 0);
+            }
+
             inline const string& Default() const
             {
                 return (_default);
@@ -1334,16 +1444,21 @@ namespace Core {
             }
 
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 bool quoted = IsQuoted();
-                uint16_t result = 0;
+                uint32_t result = 0;
 
                 ASSERT(maxLength > 0);
 
                 if ((quoted == false) || ((_scopeCount & NullBit) != 0)) {
-                    std::string source((_value.empty() || (_scopeCount & NullBit)) ? NullTag : _value);
-                    result = static_cast<uint16_t>(source.copy(stream, maxLength - result, offset));
+                    // Copy straight from the value, opaque content (JSON-RPC results) can be large.
+                    const bool null = (_value.empty() || ((_scopeCount & NullBit) != 0));
+                    const char* source = (null ? NullTag : _value.c_str());
+                    uint32_t length = (null ? static_cast<uint32_t>(strlen(NullTag)) : static_cast<uint32_t>(_value.length()));
+
+                    result = std::min(length - std::min(length, offset), maxLength);
+                    ::memcpy(stream, &source[offset], result);
                     offset = (result < maxLength ? 0 : offset + result);
                 } else {
                     if (offset == 0) {
@@ -1353,7 +1468,7 @@ namespace Core {
                         _unaccountedCount = 0;
                     }
 
-                    uint16_t length = static_cast<uint16_t>(_value.length()) - (offset - 1);
+                    uint32_t length = static_cast<uint32_t>(_value.length()) - (offset - 1);
                     if (length > 0) {
                         const TCHAR* source = &(_value[offset - 1]);
                         offset += length;
@@ -1385,10 +1500,10 @@ namespace Core {
                 return (result);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
                 bool finished = false;
-                uint16_t result = 0;
+                uint32_t result = 0;
                 ASSERT(maxLength > 0);
 
                 if (offset == 0) {
@@ -1487,7 +1602,7 @@ namespace Core {
                 }
 
                 if (finished == false) {
-                    offset = static_cast<uint16_t>(_value.length()) + _unaccountedCount;
+                    offset = static_cast<uint32_t>(_value.length()) + _unaccountedCount;
                 } else {
                     offset = 0;
                     _scopeCount |= ((_scopeCount & QuoteFoundBit) ? SetBit : (_value == NullTag ? NullBit : SetBit));
@@ -1497,9 +1612,9 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if (offset == 0) {
                     if ((_scopeCount & NullBit) != 0) {
                         stream[loaded++] = IMessagePack::NullValue;
@@ -1526,9 +1641,9 @@ namespace Core {
                         offset++;
                     }
 
-                    uint16_t copied = 0;
+                    uint32_t copied = 0;
                     while ((loaded < maxLength) && (offset != 0)) {
-                        copied = static_cast<uint16_t>(_value.copy(reinterpret_cast<char*>(&stream[loaded]), (maxLength - loaded), offset - _unaccountedCount));
+                        copied = static_cast<uint32_t>(_value.copy(reinterpret_cast<char*>(&stream[loaded]), (maxLength - loaded), offset - _unaccountedCount));
                         offset += copied;
                         loaded += copied;
                         if (_unaccountedCount) {
@@ -1545,9 +1660,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if (offset == 0) {
                     _value.clear();
                     if (stream[loaded] == IMessagePack::NullValue) {
@@ -1576,12 +1691,12 @@ namespace Core {
                         offset++;
                     }
 
-                    while ((loaded < maxLength) && ((offset - 3) < static_cast<uint16_t>(_unaccountedCount))) {
+                    while ((loaded < maxLength) && ((offset - 3) < static_cast<uint32_t>(_unaccountedCount))) {
                         _value += static_cast<char>(stream[loaded++]);
                         offset++;
                     }
 
-                    if ((offset >= 3) && (static_cast<uint16_t>(offset - 3) == _unaccountedCount)) {
+                    if ((offset >= 3) && (static_cast<uint32_t>(offset - 3) == _unaccountedCount)) {
                         offset = 0;
                         _scopeCount |= ((_scopeCount & QuoteFoundBit) ? SetBit : (_value == NullTag ? NullBit : SetBit));
                     }
@@ -1716,13 +1831,13 @@ namespace Core {
 
         protected:
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 static const TCHAR base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
                                                     "abcdefghijklmnopqrstuvwxyz"
                                                     "0123456789+/";
 
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _state = 0;
@@ -1776,9 +1891,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _state = 0xFF;
@@ -1871,6 +1986,11 @@ namespace Core {
                             }
                             _buffer[_index++] = _lastStuff;
                         }
+
+                        if ((_state & SET) == SET) {
+                            _length = _index;
+                            offset = 0;
+                        }
                     }
                 }
 
@@ -1878,26 +1998,30 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if (offset == 0) {
                     if ((_state & UNDEFINED) != 0) {
                         stream[loaded++] = IMessagePack::NullValue;
                     } else if (_length <= 0xFF) {
                         _index = 0;
                         stream[loaded++] = 0xC4;
-                        offset = 2;
-                    } else {
+                        offset = 4;
+                    } else if (_length <= 0xFFFF) {
                         _index = 0;
                         stream[loaded++] = 0xC5;
+                        offset = 3;
+                    } else {
+                        _index = 0;
+                        stream[loaded++] = 0xC6;
                         offset = 1;
                     }
                 }
 
                 if (offset != 0) {
-                    while ((loaded < maxLength) && (offset < 3)) {
-                        stream[loaded++] = static_cast<uint8_t>((_length >> (8 * (2 - offset))) & 0xFF);
+                    while ((loaded < maxLength) && (offset < 5)) {
+                        stream[loaded++] = static_cast<uint8_t>((_length >> (8 * (4 - offset))) & 0xFF);
                         offset++;
                     }
 
@@ -1910,9 +2034,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if (offset == 0) {
                     _state = 0;
                     _length = 0;
@@ -1922,9 +2046,12 @@ namespace Core {
                         _state = UNDEFINED;
                         loaded++;
                     } else if (stream[loaded] == 0xC4) {
-                        offset = 2;
+                        offset = 4;
                         loaded++;
                     } else if (stream[loaded] == 0xC5) {
+                        offset = 3;
+                        loaded++;
+                    } else if (stream[loaded] == 0xC6) {
                         offset = 1;
                         loaded++;
                     } else {
@@ -1933,18 +2060,18 @@ namespace Core {
                 }
 
                 if (offset != 0) {
-                    while ((loaded < maxLength) && (offset < 3)) {
+                    while ((loaded < maxLength) && (offset < 5)) {
                         _length = (_length << 8) + stream[loaded++];
                         offset++;
                     }
 
-                    if (offset == 3) {
+                    if (offset == 5) {
                         if (_length > _maxLength) {
                             _maxLength = _length;
                             ::free(_buffer);
                             _buffer = reinterpret_cast<uint8_t*>(::malloc(_maxLength));
                         }
-                        offset = 4;
+                        offset = 6;
                     }
 
                     while ((loaded < maxLength) && (_index < _length)) {
@@ -1962,9 +2089,9 @@ namespace Core {
         private:
             mutable uint8_t _state;
             mutable uint8_t _lastStuff;
-            mutable uint16_t _index;
-            uint16_t _length;
-            uint16_t _maxLength;
+            mutable uint32_t _index;
+            uint32_t _length;
+            uint32_t _maxLength;
             uint8_t* _buffer;
         };
 
@@ -2063,7 +2190,7 @@ namespace Core {
 
         private:
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 if (offset == 0) {
                     if ((_state & UNDEFINED) != 0) {
@@ -2075,9 +2202,9 @@ namespace Core {
                 return (static_cast<const IElement&>(_parser).Serialize(stream, maxLength, offset));
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t result = static_cast<IElement&>(_parser).Deserialize(stream, maxLength, offset, error);
+                uint32_t result = static_cast<IElement&>(_parser).Deserialize(stream, maxLength, offset, error);
 
                 if (offset == 0) {
 
@@ -2104,9 +2231,9 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     if ((_state & UNDEFINED) != 0) {
@@ -2119,9 +2246,9 @@ namespace Core {
                 return (loaded == 0 ? static_cast<const IMessagePack&>(_package).Serialize(stream, maxLength, offset) : loaded);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t result = 0;
+                uint32_t result = 0;
 
                 if ((offset == 0) && (stream[0] == IMessagePack::NullValue)) {
                     _state = UNDEFINED;
@@ -2496,16 +2623,16 @@ namespace Core {
 
         private:
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _iterator.Reset();
                     stream[loaded++] = '[';
                     offset = (_iterator.Next() == false ? ~0 : PARSE);
                 }
-                while ((loaded < maxLength) && (offset != static_cast<uint16_t>(~0))) {
+                while ((loaded < maxLength) && (offset != static_cast<uint32_t>(~0))) {
                     if (offset >= PARSE) {
                         offset -= PARSE;
                         loaded += static_cast<const IElement&>(_iterator.Current()).Serialize(&(stream[loaded]), maxLength - loaded, offset);
@@ -2515,7 +2642,7 @@ namespace Core {
                         offset = PARSE;
                     }
                 }
-                if ((offset == static_cast<uint16_t>(~0)) && (loaded < maxLength)) {
+                if ((offset == static_cast<uint32_t>(~0)) && (loaded < maxLength)) {
                     stream[loaded++] = ']';
                     offset = 0;
                 }
@@ -2523,9 +2650,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == 0) {
                     while ((loaded < maxLength) && ::isspace(stream[loaded])) {
@@ -2607,9 +2734,9 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _iterator.Reset();
@@ -2645,9 +2772,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     if (stream[0] == IMessagePack::NullValue) {
@@ -2716,6 +2843,19 @@ namespace Core {
             typedef std::pair<const TCHAR*, IElement*> JSONLabelValue;
             typedef std::list<JSONLabelValue> JSONElementList;
 
+            // Every incoming label is looked up while deserializing. With a linear walk a container
+            // with N fields costs N^2 string compares, so beyond a handful of fields the labels get an
+            // index sorted on their hash. Add and Remove keep it up to date, so a lookup on a const
+            // container, e.g. from more threads at once, only reads it.
+            static constexpr uint8_t INDEX_THRESHOLD = 8;
+
+            struct LabelIndex {
+                uint32_t hash;
+                const TCHAR* label;
+                IElement* element;
+            };
+            typedef std::vector<LabelIndex> JSONLabelIndex;
+
             class Iterator {
             private:
                 enum State {
@@ -2790,6 +2930,7 @@ namespace Core {
             Container()
                 : _state(0)
                 , _data()
+                , _index()
                 , _iterator()
                 , _fieldName(true)
             {
@@ -2802,13 +2943,7 @@ namespace Core {
         public:
             bool HasLabel(const string& label) const
             {
-                JSONElementList::const_iterator index(_data.begin());
-
-                while ((index != _data.end()) && (index->first != label)) {
-                    index++;
-                }
-
-                return (index != _data.end());
+                return (Lookup(label.c_str()) != nullptr);
             }
 
             // IElement and IMessagePack iface:
@@ -2844,6 +2979,15 @@ namespace Core {
             void Add(const TCHAR label[], IElement* element)
             {
                 _data.push_back(JSONLabelValue(label, element));
+
+                if (_data.size() == (INDEX_THRESHOLD + 1)) {
+                    BuildIndex();
+                } else if (_data.size() > (INDEX_THRESHOLD + 1)) {
+                    const LabelIndex entry = { Hash(label), label, element };
+
+                    // Behind the equal hashes, so the first one added is still the one found.
+                    _index.insert(std::upper_bound(_index.begin(), _index.end(), entry, [](const LabelIndex& lhs, const LabelIndex& rhs) { return (lhs.hash < rhs.hash); }), entry);
+                }
             }
 
             void Remove(const TCHAR label[])
@@ -2855,15 +2999,66 @@ namespace Core {
                 }
 
                 if (index != _data.end()) {
-                    _data.erase(index);
+                    if (_data.size() <= (INDEX_THRESHOLD + 1)) {
+                        _index.clear();
+                        _data.erase(index);
+                    } else {
+                        JSONLabelIndex::iterator entry(_index.begin());
+
+                        while ((entry != _index.end()) && ((entry->label != index->first) || (entry->element != index->second))) {
+                            entry++;
+                        }
+
+                        _data.erase(index);
+
+                        if (entry != _index.end()) {
+                            _index.erase(entry);
+                        } else {
+                            // Should not happen, but do not leave an index behind that does not match.
+                            ASSERT(false);
+                            _index.clear();
+                            BuildIndex();
+                        }
+                    }
+                }
+            }
+
+        protected:
+            IElement* Lookup(const TCHAR label[]) const
+            {
+                IElement* result = nullptr;
+
+                if (_data.size() <= INDEX_THRESHOLD) {
+                    JSONElementList::const_iterator index = _data.begin();
+
+                    while ((index != _data.end()) && (strcmp(label, index->first) != 0)) {
+                        index++;
+                    }
+
+                    if (index != _data.end()) {
+                        result = index->second;
+                    }
+                } else {
+                    const uint32_t hash(Hash(label));
+                    JSONLabelIndex::const_iterator index(std::lower_bound(_index.begin(), _index.end(), hash, [](const LabelIndex& lhs, const uint32_t value) { return (lhs.hash < value); }));
+
+                    while ((index != _index.end()) && (index->hash == hash) && (strcmp(label, index->label) != 0)) {
+                        index++;
+                    }
+
+                    if ((index != _index.end()) && (index->hash == hash)) {
+                        result = index->element;
+                    }
                 }
+
+                return (result);
             }
 
         private:
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _iterator = _data.begin();
@@ -2876,7 +3071,7 @@ namespace Core {
                         offset = PARSE;
                     }
                 }
-                while ((loaded < maxLength) && (offset != static_cast<uint16_t>(~0))) {
+                while ((loaded < maxLength) && (offset != static_cast<uint32_t>(~0))) {
                     if (offset >= PARSE) {
                         offset -= PARSE;
                         loaded += _current.json->Serialize(&(stream[loaded]), maxLength - loaded, offset);
@@ -2898,7 +3093,7 @@ namespace Core {
                         }
                     }
                 }
-                if ((offset == static_cast<uint16_t>(~0)) && (loaded < maxLength)) {
+                if ((offset == static_cast<uint32_t>(~0)) && (loaded < maxLength)) {
                     stream[loaded++] = '}';
                     offset = 0;
                     _fieldName.Clear();
@@ -2907,9 +3102,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == 0) {
                     while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
@@ -3059,9 +3254,9 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 uint16_t elementSize = Size();
                 if (offset == 0) {
@@ -3125,9 +3320,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     if (stream[0] == IMessagePack::NullValue) {
@@ -3185,30 +3380,41 @@ namespace Core {
 
             IElement* Find(const char label[])
             {
-                IElement* result = nullptr;
-
-                JSONElementList::iterator index = _data.begin();
+                IElement* result = Lookup(label);
 
-                while ((index != _data.end()) && (strcmp(label, index->first) != 0)) {
-                    index++;
+                // Only an unknown label needs a new element, if the container is willing to create one. So a
+                // label that occurs again, in the same or in a next document, is loaded into the element it got
+                // the first time: a VariantContainer no longer grows an element for every occurrence.
+                if ((result == nullptr) && (Request(label) == true)) {
+                    result = Lookup(label);
                 }
 
-                if (index != _data.end()) {
-                    result = index->second;
-                }
-                if (Request(label) == true) {
-                    index = _data.end();
+                return (result);
+            }
 
-                    while ((result == nullptr) && (index != _data.begin())) {
-                        index--;
-                        if (strcmp(label, index->first) == 0) {
-                            result = index->second;
-                        }
-                    }
+            static uint32_t Hash(const TCHAR label[])
+            {
+                // FNV-1a
+                uint32_t result = 2166136261u;
+
+                while (*label != '\0') {
+                    result = (result ^ static_cast<uint32_t>(*label++)) * 16777619u;
                 }
+
                 return (result);
             }
 
+            void BuildIndex()
+            {
+                _index.reserve(_data.size());
+
+                for (const JSONLabelValue& entry : _data) {
+                    _index.push_back({ Hash(entry.first), entry.first, entry.second });
+                }
+
+                std::stable_sort(_index.begin(), _index.end(), [](const LabelIndex& lhs, const LabelIndex& rhs) { return (lhs.hash < rhs.hash); });
+            }
+
             bool FindNext() const
             {
                 _iterator++;
@@ -3246,6 +3452,7 @@ namespace Core {
                 mutable IMessagePack* pack;
             } _current;
             JSONElementList _data;
+            JSONLabelIndex _index;
             mutable JSONElementList::const_iterator _iterator;
             mutable String _fieldName;
         };
@@ -3461,17 +3668,17 @@ namespace Core {
 
         private:
             // IElement iface:
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override;
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override;
 
-            static uint16_t FindEndOfScope(const char stream[], uint16_t maxLength)
+            static uint32_t FindEndOfScope(const char stream[], uint32_t maxLength)
             {
                 ASSERT(maxLength > 0 && (stream[0] == '{' || stream[0] == '['));
                 char charOpen = stream[0];
                 char charClose = charOpen == '{' ? '}' : ']';
                 uint16_t stack = 1;
-                uint16_t endIndex = 0;
+                uint32_t endIndex = 0;
                 bool insideQuotes = false;
-                for (uint16_t i = 1; i < maxLength; ++i) {
+                for (uint32_t i = 1; i < maxLength; ++i) {
                     if (stream[i] == '\"') {
                         insideQuotes = !insideQuotes;
                     }
@@ -3642,11 +3849,11 @@ namespace Core {
                 // First copy all existing ones over, if the rhs does not have a value, remove the entry.
                 while (index != _elements.end()) {
                     // Check if the rhs, has these..
-                    Elements::const_iterator rhs_index(rhs.Find(index->first.c_str()));
+                    const JSON::Variant* rhs_value(rhs.Find(index->first.c_str()));
 
-                    if (rhs_index != rhs._elements.end()) {
+                    if (rhs_value != nullptr) {
                         // This is a valid element, copy the value..
-                        index->second = rhs_index->second;
+                        index->second = *rhs_value;
                         index++;
                     } else {
                         // This element does not exist on the other side..
@@ -3659,7 +3866,7 @@ namespace Core {
 
                 // Now add the ones we are missing from the RHS
                 while (rhs_index != rhs._elements.end()) {
-                    if (Find(rhs_index->first.c_str()) == _elements.end()) {
+                    if (Find(rhs_index->first.c_str()) == nullptr) {
                         _elements.emplace_back(std::piecewise_construct,
                             std::forward_as_tuple(rhs_index->first),
                             std::forward_as_tuple(rhs_index->second));
@@ -3673,9 +3880,9 @@ namespace Core {
 
             void Set(const TCHAR fieldName[], const JSON::Variant& value)
             {
-                Elements::iterator index(Find(fieldName));
-                if (index != _elements.end()) {
-                    index->second = value;
+                JSON::Variant* element(Find(fieldName));
+                if (element != nullptr) {
+                    *element = value;
                 } else {
                     _elements.emplace_back(std::piecewise_construct,
                         std::forward_as_tuple(fieldName),
@@ -3688,10 +3895,10 @@ namespace Core {
             {
                 JSON::Variant result;
 
-                Elements::const_iterator index(Find(fieldName));
+                const JSON::Variant* element(Find(fieldName));
 
-                if (index != _elements.end()) {
-                    result = index->second;
+                if (element != nullptr) {
+                    result = *element;
                 }
 
                 return (result);
@@ -3699,32 +3906,31 @@ namespace Core {
 
             JSON::Variant& operator[](const TCHAR fieldName[])
             {
-                Elements::iterator index(Find(fieldName));
+                JSON::Variant* element(Find(fieldName));
 
-                if (index == _elements.end()) {
+                if (element == nullptr) {
                     _elements.emplace_back(std::piecewise_construct,
                         std::forward_as_tuple(fieldName),
                         std::forward_as_tuple());
                     Container::Add(_elements.back().first.c_str(), &(_elements.back().second));
-                    index = _elements.end();
-                    index--;
+                    element = &(_elements.back().second);
                 }
 
-                return (index->second);
+                return (*element);
             }
 
             const JSON::Variant& operator[](const TCHAR fieldName[]) const
             {
                 static const JSON::Variant emptyVariant;
 
-                Elements::const_iterator index(Find(fieldName));
+                const JSON::Variant* element(Find(fieldName));
 
-                return (index == _elements.end() ? emptyVariant : index->second);
+                return (element == nullptr ? emptyVariant : *element);
             }
 
             bool HasLabel(const TCHAR labelName[]) const
             {
-                return (Find(labelName) != _elements.end());
+                return (Find(labelName) != nullptr);
             }
 
             Iterator Variants() const
@@ -3735,29 +3941,22 @@ namespace Core {
             string GetDebugString(int indent = 0) const;
 
         private:
-            Elements::iterator Find(const TCHAR fieldName[])
+            // Every element is registered in the Container as well, so use its label index.
+            JSON::Variant* Find(const TCHAR fieldName[])
             {
-                Elements::iterator index(_elements.begin());
-                while ((index != _elements.end()) && (index->first != fieldName)) {
-                    index++;
-                }
-                return (index);
+                return (static_cast<JSON::Variant*>(Container::Lookup(fieldName)));
             }
 
-            Elements::const_iterator Find(const TCHAR fieldName[]) const
+            const JSON::Variant* Find(const TCHAR fieldName[]) const
             {
-                Elements::const_iterator index(_elements.begin());
-                while ((index != _elements.end()) && (index->first != fieldName)) {
-                    index++;
-                }
-                return (index);
+                return (static_cast<const JSON::Variant*>(Container::Lookup(fieldName)));
             }
 
             // Container iface:
             bool Request(const TCHAR label[]) override
             {
                 // Whetever comes in and has no counter part, we need to create a Variant for it, so
-                // it can be filled.
+                // it can be filled. Labels that are already known, are not requested again.
                 _elements.emplace_back(std::piecewise_construct,
                     std::forward_as_tuple(label),
                     std::forward_as_tuple());
@@ -3795,11 +3994,11 @@ namespace Core {
             return (result);
         }
 
-        inline uint16_t Variant::Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error)
+        inline uint32_t Variant::Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error)
         {
-            uint16_t result = 0;
+            uint32_t result = 0;
             if (stream[0] == '{' || stream[0] == '[') {
-                uint16_t endIndex = FindEndOfScope(stream, maxLength);
+                uint32_t endIndex = FindEndOfScope(stream, maxLength);
                 if (endIndex > 0 && endIndex < maxLength) {
                     result = endIndex + 1;
                     SetQuoted(false);
@@ -3854,15 +4053,15 @@ namespace Core {
 
             bool FromString(const string& value, Core::ProxyType<INSTANCEOBJECT>& receptor)
             {
-                uint16_t fillCount = 0;
-                uint16_t offset = 0;
-                uint16_t size, loaded;
+                uint32_t fillCount = 0;
+                uint32_t offset = 0;
+                uint32_t size, loaded;
 
                 receptor->Clear();
                 Core::OptionalType<Error> error;
 
                 do {
-                    size = static_cast<uint16_t>((value.size() - fillCount) < SIZE ? (value.size() - fillCount) : SIZE);
+                    size = static_cast<uint32_t>((value.size() - fillCount) < SIZE ? (value.size() - fillCount) : SIZE);
 
                     // Prepare the deserialize buffer
                     memcpy(_buffer, &(value.data()[fillCount]), size);
@@ -3880,8 +4079,8 @@ namespace Core {
 
             bool ToString(const Core::ProxyType<INSTANCEOBJECT>& receptor, string& value)
             {
-                uint16_t offset = 0;
-                uint16_t loaded;
+                uint32_t offset = 0;
+                uint32_t loaded;
 
                 // Serialize object
                 do {
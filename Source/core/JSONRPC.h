@@ -235,6 +235,118 @@ namespace Core {
             Info Error;
         };
 
+        // An outbound event, rendered once for all its subscribers. The parameters text is immutable and
+        // shared by the notifications of all subscribers, only the envelope (the method differs per
+        // subscriber) is kept per notification. Serializing holds no state, so several channels can
+        // send the same notification at the same time.
+        class EXTERNAL Notification : public Core::JSON::IElement {
+        public:
+            class Payload {
+            public:
+                Payload() = delete;
+                Payload(const Payload&) = delete;
+                Payload& operator=(const Payload&) = delete;
+
+                Payload(const string& text)
+                    : _text(text)
+                {
+                }
+                ~Payload()
+                {
+                }
+
+            public:
+                const string& Text() const
+                {
+                    return (_text);
+                }
+
+            private:
+                const string _text;
+            };
+
+        public:
+            Notification(const Notification&) = delete;
+            Notification& operator=(const Notification&) = delete;
+
+            Notification()
+                : _header()
+                , _payload()
+            {
+            }
+            ~Notification() override
+            {
+            }
+
+        public:
+            void Set(const string& designator, const Core::ProxyType<Payload>& payload)
+            {
+                Core::JSON::String method;
+                string text;
+
+                method = designator;
+                method.ToString(text);
+
+                _header = _T("{\"jsonrpc\":\"") + string(Message::DefaultVersion) + _T("\",\"method\":") + text;
+                _payload = payload;
+
+                if ((_payload.IsValid() == true) && (_payload->Text().empty() == false)) {
+                    _header += _T(",\"params\":");
+                }
+            }
+
+            // IElement iface:
+            void Clear() override
+            {
+                _header.clear();
+                _payload.Release();
+            }
+            bool IsSet() const override
+            {
+                return (_header.empty() == false);
+            }
+            bool IsNull() const override
+            {
+                return (false);
+            }
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
+            {
+                static const string closing(_T("}"));
+                const string* parts[] = { &_header, (_payload.IsValid() == true ? &(_payload->Text()) : &closing), &closing };
+                const uint8_t count = (_payload.IsValid() == true ? 3 : 2);
+                uint32_t position = offset;
+                uint32_t result = 0;
+                uint32_t base = 0;
+
+                for (uint8_t index = 0; index < count; index++) {
+                    uint32_t length = static_cast<uint32_t>(parts[index]->length());
+
+                    if ((position < (base + length)) && (result < maxLength)) {
+                        uint32_t size = std::min(base + length - position, maxLength - result);
+                        ::memcpy(&(stream[result]), &(parts[index]->c_str()[position - base]), size);
+                        result += size;
+                        position += size;
+                    }
+                    base += length;
+                }
+
+                offset = (position == base ? 0 : position);
+
+                return (result);
+            }
+            uint32_t Deserialize(const char[], const uint32_t, uint32_t&, Core::OptionalType<Core::JSON::Error>&) override
+            {
+                // Notifications only travel outbound.
+                ASSERT(false);
+
+                return (0);
+            }
+
+        private:
+            string _header;
+            Core::ProxyType<Payload> _payload;
+        };
+
         class EXTERNAL Connection {
         private:
             Connection() = delete;
@@ -397,6 +509,7 @@ namespace Core {
             typedef std::map<string, ObserverList> ObserverMap;
 
             typedef std::function<void(const uint32_t id, const string& designator, const string& data)> NotificationFunction;
+            typedef std::function<void(const uint32_t id, const string& designator, const Core::ProxyType<Notification::Payload>& data)> BroadcastFunction;
 
         public:
             class EventIterator {
@@ -476,6 +589,7 @@ namespace Core {
                 , _handlers()
                 , _observers()
                 , _notificationFunction(notificationFunction)
+                , _broadcastFunction()
                 , _versions(versions)
             {
             }
@@ -484,6 +598,26 @@ namespace Core {
                 , _handlers(copy._handlers)
                 , _observers()
                 , _notificationFunction(notificationFunction)
+                , _broadcastFunction()
+                , _versions(versions)
+            {
+            }
+            // Events are rendered once and the payload is shared by all subscribers.
+            Handler(const BroadcastFunction& broadcastFunction, const std::vector<uint8_t>& versions)
+                : _adminLock()
+                , _handlers()
+                , _observers()
+                , _notificationFunction()
+                , _broadcastFunction(broadcastFunction)
+                , _versions(versions)
+            {
+            }
+            Handler(const BroadcastFunction& broadcastFunction, const std::vector<uint8_t>& versions, const Handler& copy)
+                : _adminLock()
+                , _handlers(copy._handlers)
+                , _observers()
+                , _notificationFunction()
+                , _broadcastFunction(broadcastFunction)
                 , _versions(versions)
             {
             }
@@ -632,6 +766,29 @@ namespace Core {
                 }
                 return (result);
             }
+            // Dispatch straight from a deserialized message: the parameter text is handed to the handler
+            // without copying it out of the message and the result text is moved into the response.
+            // The parameters can not be parsed into the INBOUND of the handler while the message itself is
+            // parsed: the message may still cross a process boundary (PluginHost::IDispatcher) before the
+            // handler is known, and "params" may precede "method". So they stay text up to here and INBOUND
+            // is parsed once, from that text, by the registered handler.
+            uint32_t Invoke(const Connection connection, const string& method, const Core::JSON::String& parameters, Core::JSON::String& response)
+            {
+                uint32_t result;
+                string outbound;
+
+                if (parameters.IsRaw() == true) {
+                    result = Invoke(connection, method, parameters.Raw(), outbound);
+                } else {
+                    result = Invoke(connection, method, parameters.Value(), outbound);
+                }
+
+                if (result == Core::ERROR_NONE) {
+                    response = std::move(outbound);
+                }
+
+                return (result);
+            }
             void Subscribe(const uint32_t id, const string& eventId, const string& callsign, Core::JSONRPC::Message& response)
             {
                 _adminLock.Lock();
@@ -1010,6 +1167,11 @@ namespace Core {
                 if (index != _observers.end()) {
                     ObserverList& clients = index->second;
                     ObserverList::iterator loop = clients.begin();
+                    Core::ProxyType<Notification::Payload> payload;
+
+                    if (_broadcastFunction) {
+                        payload = Core::ProxyType<Notification::Payload>::Create(parameters);
+                    }
 
                     result = Core::ERROR_NONE;
 
@@ -1018,7 +1180,11 @@ namespace Core {
 
                         if (!sendifmethod || sendifmethod(designator)) {
 
-                            _notificationFunction(loop->Id(), (designator.empty() == false ? designator + '.' + event : event), parameters);
+                            if (payload.IsValid() == true) {
+                                _broadcastFunction(loop->Id(), (designator.empty() == false ? designator + '.' + event : event), payload);
+                            } else {
+                                _notificationFunction(loop->Id(), (designator.empty() == false ? designator + '.' + event : event), parameters);
+                            }
                         }
 
                         loop++;
@@ -1035,6 +1201,7 @@ namespace Core {
             HandlerMap _handlers;
             ObserverMap _observers;
             NotificationFunction _notificationFunction;
+            BroadcastFunction _broadcastFunction;
             const std::vector<uint8_t> _versions;
         };
 
@@ -181,12 +181,12 @@ namespace Core {
 
         public:
             // Methods to extract and insert data into the socket buffers
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
             {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
 
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+            virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -347,15 +347,15 @@ namespace Core {
         {
             _channel.Trigger();
         }
-        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
         {
-            // Serialize Response
-            return (_serializerImpl.Serialize(dataFrame, maxSendSize));
+            // Serialize Response, the serializers work on 16 bits lengths.
+            return (_serializerImpl.Serialize(dataFrame, static_cast<uint16_t>(maxSendSize > 0xFFFF ? 0xFFFF : maxSendSize)));
         }
-        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+        uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
         {
-            // Deserialize Request
-            return (_deserialiserImpl.Deserialize(dataFrame, receivedSize));
+            // Deserialize Request, whatever does not fit in 16 bits is offered again in the next round.
+            return (_deserialiserImpl.Deserialize(dataFrame, static_cast<uint16_t>(receivedSize > 0xFFFF ? 0xFFFF : receivedSize)));
         }
 
     private:
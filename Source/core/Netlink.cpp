@@ -146,9 +146,9 @@ namespace Core {
     }
 
     // Methods to extract and insert data into the socket buffers
-    /* virtual */ uint16_t SocketNetlink::SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+    /* virtual */ uint32_t SocketNetlink::SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
     {
-        uint16_t result = 0;
+        uint32_t result = 0;
 
         if (_pending.size() > 0) {
 
@@ -176,10 +176,10 @@ namespace Core {
         return (result);
     }
 
-    /* virtual */ uint16_t SocketNetlink::ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+    /* virtual */ uint32_t SocketNetlink::ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
     {
 
-        uint16_t result = receivedSize;
+        uint32_t result = receivedSize;
         Netlink::Frames frames(dataFrame, receivedSize);
 
 #ifdef DEBUG_FRAMES
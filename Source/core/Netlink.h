@@ -391,8 +391,8 @@ namespace Core {
 
     private:
         // Methods to extract and insert data into the socket buffers
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override;
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override;
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override;
         virtual void StateChange() override;
 
     private:
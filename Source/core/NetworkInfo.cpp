@@ -1580,12 +1580,12 @@ namespace Core {
     }
 
     // Methods to extract and insert data into the socket buffers
-    /* virtual */ uint16_t AdapterObserver::Observer::SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+    /* virtual */ uint32_t AdapterObserver::Observer::SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
     {
         return (0);
     }
 
-    /* virtual */ uint16_t AdapterObserver::Observer::ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+    /* virtual */ uint32_t AdapterObserver::Observer::ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
     {
 
         return (_parser.Deserialize(dataFrame, receivedSize));
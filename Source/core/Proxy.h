@@ -2,6 +2,8 @@
 #define __PROXY_H
 
 // ---- Include system wide include files ----
+#include <atomic>
+#include <list>
 #include <map>
 #include <memory>
 
@@ -557,8 +559,8 @@ namespace Core {
 
             // If it is not the last one, we have to move...
             if (a_Index < m_Current) {
-                // Kill the entry, (again dirty but quick).
-                memcpy(&(m_List[a_Index]), &(m_List[a_Index + 1]), (m_Current - a_Index) * sizeof(IReferenceCounted*));
+                // Kill the entry, the ranges overlap, so move them.
+                memmove(&(m_List[a_Index]), &(m_List[a_Index + 1]), (m_Current - a_Index) * sizeof(IReferenceCounted*));
             }
 
 #ifdef __DEBUG__
@@ -579,8 +581,8 @@ namespace Core {
 
             // If it is not the last one, we have to move...
             if (a_Index < m_Current) {
-                // Kill the entry, (again dirty but quick).
-                memcpy(&(m_List[a_Index]), &(m_List[a_Index + 1]), (m_Current - a_Index) * sizeof(IReferenceCounted*));
+                // Kill the entry, the ranges overlap, so move them.
+                memmove(&(m_List[a_Index]), &(m_List[a_Index + 1]), (m_Current - a_Index) * sizeof(IReferenceCounted*));
             }
 
 #ifdef __DEBUG__
@@ -1064,6 +1066,102 @@ namespace Core {
     private:
         typedef ProxyObjectType<PROXYPOOLELEMENT> ProxyPoolElement;
 
+        // Every thread keeps the elements it released last in a magazine, a small stack it takes
+        // them from again without locking. Only if the magazine runs empty (or full) the queue of
+        // the pool is locked, to refill it (or to empty half of it).
+        static constexpr uint8_t MagazineSize = 8;
+        static constexpr uint8_t MagazinesPerThread = 4;
+
+        struct Magazine {
+            // Only the thread owning the magazine changes it, unless the pool is destructed.
+            std::atomic<const ProxyPoolType<PROXYPOOLELEMENT>*> Pool;
+            uint32_t Hits;
+            uint8_t Count;
+            ProxyPoolElement* Elements[MagazineSize];
+        };
+
+        // The magazines of a thread, for the pools it used last. When the thread exits, what is
+        // left in them is returned to the queue of their pool.
+        class LocalMagazines {
+        public:
+            LocalMagazines(const LocalMagazines&) = delete;
+            LocalMagazines& operator=(const LocalMagazines&) = delete;
+
+            LocalMagazines()
+                : _next(0)
+                , _closed(false)
+            {
+                for (Magazine& magazine : _magazines) {
+                    magazine.Pool = nullptr;
+                    magazine.Hits = 0;
+                    magazine.Count = 0;
+                }
+            }
+            ~LocalMagazines()
+            {
+                Registry().Lock();
+
+                for (Magazine& magazine : _magazines) {
+                    const ProxyPoolType<PROXYPOOLELEMENT>* pool = magazine.Pool;
+
+                    if (pool != nullptr) {
+                        pool->Unbind(magazine);
+                    }
+                }
+
+                // Elements released by the thread locals destructed after this one, go straight to their pool.
+                _closed = true;
+
+                Registry().Unlock();
+            }
+
+        public:
+            inline Magazine* Find(const ProxyPoolType<PROXYPOOLELEMENT>* pool)
+            {
+                uint8_t index = 0;
+
+                while ((index < MagazinesPerThread) && (_magazines[index].Pool.load(std::memory_order_relaxed) != pool)) {
+                    index++;
+                }
+
+                return (index < MagazinesPerThread ? &(_magazines[index]) : nullptr);
+            }
+            Magazine* Bind(const ProxyPoolType<PROXYPOOLELEMENT>* pool)
+            {
+                Magazine* result = nullptr;
+
+                Registry().Lock();
+
+                if (_closed == false) {
+                    uint8_t index = 0;
+
+                    while ((index < MagazinesPerThread) && (_magazines[index].Pool != nullptr)) {
+                        index++;
+                    }
+
+                    if (index == MagazinesPerThread) {
+                        // All in use, take them over in turns.
+                        index = _next;
+                        _next = (_next + 1) % MagazinesPerThread;
+
+                        _magazines[index].Pool.load()->Unbind(_magazines[index]);
+                    }
+
+                    result = &(_magazines[index]);
+                    pool->Bind(*result);
+                }
+
+                Registry().Unlock();
+
+                return (result);
+            }
+
+        private:
+            Magazine _magazines[MagazinesPerThread];
+            uint8_t _next;
+            bool _closed;
+        };
+
     public:
         ProxyPoolType(const ProxyPoolType<PROXYPOOLELEMENT>&) = delete;
         ProxyPoolType<PROXYPOOLELEMENT>& operator=(const ProxyPoolType<PROXYPOOLELEMENT>&) = delete;
@@ -1072,96 +1170,273 @@ namespace Core {
             : _createdElements(0)
             , _queue(initialQueueSize)
             , _lock()
+            , _users(0)
+            , _hits(0)
+            , _misses(0)
+            , _contention(0)
+            , _magazines()
         {
+            // Make sure the registry outlives static pools.
+            Registry();
         }
         ~ProxyPoolType()
         {
+            Registry().Lock();
+
+            // What is left in the magazines of the threads is left behind, just like what is left in the queue.
+            for (Magazine* magazine : _magazines) {
+                magazine->Count = 0;
+                magazine->Pool = nullptr;
+            }
+
+            Registry().Unlock();
         }
 
     public:
         Core::ProxyType<PROXYPOOLELEMENT> Element()
         {
             Core::ProxyType<PROXYPOOLELEMENT> result;
+            ProxyPoolElement* element = Take();
 
-            _lock.Lock();
+            if (element == nullptr) {
+                result = ProxyPoolElement::Create(*this);
 
-            if (_queue.Count() == 0) {
+                // TRACE_L1("Created a new element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*result));
+            } else {
+                result = Handout(element);
+            }
 
-                _createdElements++;
+            return (result);
+        }
+        template <typename Arg1>
+        Core::ProxyType<PROXYPOOLELEMENT> Element(Arg1 argument1)
+        {
+            Core::ProxyType<PROXYPOOLELEMENT> result;
+            ProxyPoolElement* element = Take();
 
-                _lock.Unlock();
+            if (element == nullptr) {
+                result = ProxyPoolElement::Create(*this, argument1);
+            } else {
+                result = Handout(element);
+            }
 
-                result = ProxyPoolElement::Create(*this);
+            return (result);
+        }
+        void Return(Core::ProxyType<ProxyPoolElement>& element) const
+        {
+            ProxyPoolElement* entry = element.operator->();
+            Magazine* magazine = Local();
 
-                // TRACE_L1("Created a new element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*result));
+            // TRACE_L1("Returned an element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*element));
+
+            // The magazine, or the queue, holds on to it.
+            entry->AddRef();
+
+            if ((magazine != nullptr) && (magazine->Count < MagazineSize)) {
+                magazine->Elements[magazine->Count++] = entry;
             } else {
-                Core::ProxyType<ProxyPoolElement> listLoad;
+                Enter();
+
+                if (magazine == nullptr) {
+                    Push(entry);
+                } else {
+                    // Full, the ones released longest ago go to the queue.
+                    const uint8_t half = (MagazineSize / 2);
+
+                    for (uint8_t index = 0; index < half; index++) {
+                        Push(magazine->Elements[index]);
+                    }
 
-                _queue.Remove(0, listLoad);
+                    ::memmove(&(magazine->Elements[0]), &(magazine->Elements[half]), (MagazineSize - half) * sizeof(ProxyPoolElement*));
+                    magazine->Count = (MagazineSize - half);
+                    magazine->Elements[magazine->Count++] = entry;
+                }
 
-                _lock.Unlock();
+                Leave();
+            }
+        }
+        inline uint32_t CreatedElements() const
+        {
+            return (_createdElements);
+        }
+        uint32_t QueuedElements() const
+        {
+            uint32_t result = _queue.Count();
 
-                result = Core::proxy_cast<PROXYPOOLELEMENT>(listLoad);
+            Registry().Lock();
 
-                // TRACE_L1("Reused an element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*result));
+            for (const Magazine* magazine : _magazines) {
+                result += magazine->Count;
             }
 
+            Registry().Unlock();
+
             return (result);
         }
-        template <typename Arg1>
-        Core::ProxyType<PROXYPOOLELEMENT> Element(Arg1 argument1)
+        inline uint32_t CurrentQueueSize() const
         {
-            Core::ProxyType<PROXYPOOLELEMENT> result;
+            return (_queue.CurrentQueueSize());
+        }
+        // Elements handed out from the magazine of the calling thread, without any locking.
+        uint32_t Hits() const
+        {
+            uint32_t result = _hits;
 
-            _lock.Lock();
+            Registry().Lock();
 
-            if (_queue.Count() == 0) {
+            for (const Magazine* magazine : _magazines) {
+                result += magazine->Hits;
+            }
 
-                _createdElements++;
+            Registry().Unlock();
 
-                _lock.Unlock();
+            return (result);
+        }
+        // Elements taken from the queue of the pool, or created, with the lock taken.
+        inline uint32_t Misses() const
+        {
+            return (_misses);
+        }
+        // The number of times the queue was locked while another thread was using it as well.
+        inline uint32_t Contention() const
+        {
+            return (_contention);
+        }
 
-                result = ProxyPoolElement::Create(*this, argument1);
+    private:
+        static Core::CriticalSection& Registry()
+        {
+            // Guards which magazine belongs to which pool, taken only when this changes.
+            static Core::CriticalSection registry;
 
-                // TRACE_L1("Created a new element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*result));
+            return (registry);
+        }
+        static LocalMagazines& Magazines()
+        {
+            static thread_local LocalMagazines magazines;
+
+            return (magazines);
+        }
+        inline Magazine* Local() const
+        {
+            LocalMagazines& magazines(Magazines());
+            Magazine* result = magazines.Find(this);
+
+            return (result != nullptr ? result : magazines.Bind(this));
+        }
+        // An element with a reference for the caller, or nullptr if a new one has to be created.
+        ProxyPoolElement* Take()
+        {
+            ProxyPoolElement* result = nullptr;
+            Magazine* magazine = Local();
+
+            if ((magazine != nullptr) && (magazine->Count > 0)) {
+                magazine->Hits++;
+                result = magazine->Elements[--magazine->Count];
             } else {
-                Core::ProxyType<ProxyPoolElement> listLoad;
+                Enter();
 
-                _queue.Remove(0, listLoad);
+                _misses++;
 
-                _lock.Unlock();
+                if (_queue.Count() == 0) {
+                    _createdElements++;
+                } else {
+                    result = Pop();
 
-                result = Core::proxy_cast<PROXYPOOLELEMENT>(listLoad);
+                    // Take some more along for the next requests of this thread.
+                    if (magazine != nullptr) {
+                        while ((magazine->Count < (MagazineSize / 2)) && (_queue.Count() > 0)) {
+                            magazine->Elements[magazine->Count++] = Pop();
+                        }
+                    }
+                }
 
-                // TRACE_L1("Reused an element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*result));
+                Leave();
             }
 
             return (result);
         }
-        void Return(Core::ProxyType<ProxyPoolElement>& element) const
+        inline Core::ProxyType<PROXYPOOLELEMENT> Handout(ProxyPoolElement* element)
+        {
+            Core::ProxyType<PROXYPOOLELEMENT> result(static_cast<IReferenceCounted*>(element), element);
+
+            // The reference of the magazine, or the queue, now held by the result.
+            element->Release();
+
+            // TRACE_L1("Reused an element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*result));
+
+            return (result);
+        }
+        inline void Enter() const
         {
+            const bool contended = (_users.fetch_add(1) > 0);
+
             _lock.Lock();
-            // TRACE_L1("Returned an element for: %s [%p]\n", typeid(PROXYPOOLELEMENT).name(), &static_cast<PROXYPOOLELEMENT&>(*element));
-            _queue.Add(element);
+
+            if (contended == true) {
+                _contention++;
+            }
+        }
+        inline void Leave() const
+        {
+            _users.fetch_sub(1);
+
             _lock.Unlock();
         }
-        inline uint32_t CreatedElements() const
+        // Moving elements between a magazine and the queue, with the lock taken.
+        void Push(ProxyPoolElement* element) const
         {
-            return (_createdElements);
+            Core::ProxyType<ProxyPoolElement> entry(static_cast<IReferenceCounted*>(element), element);
+
+            _queue.Add(entry);
+            element->Release();
         }
-        inline uint32_t QueuedElements() const
+        ProxyPoolElement* Pop() const
         {
-            return (_queue.Count());
+            Core::ProxyType<ProxyPoolElement> entry;
+
+            // The last one in is still warm, and leaves nothing to move.
+            _queue.Remove(_queue.Count() - 1, entry);
+
+            ProxyPoolElement* element = entry.operator->();
+            element->AddRef();
+
+            return (element);
         }
-        inline uint32_t CurrentQueueSize() const
+        // Bind and Unbind are called with the registry locked.
+        void Bind(Magazine& magazine) const
         {
-            return (_queue.CurrentQueueSize());
+            magazine.Pool = this;
+            magazine.Hits = 0;
+            magazine.Count = 0;
+
+            _magazines.push_back(&magazine);
+        }
+        void Unbind(Magazine& magazine) const
+        {
+            Enter();
+
+            while (magazine.Count > 0) {
+                Push(magazine.Elements[--magazine.Count]);
+            }
+
+            _hits += magazine.Hits;
+
+            Leave();
+
+            _magazines.remove(&magazine);
+            magazine.Pool = nullptr;
         }
 
     private:
         uint32_t _createdElements;
         mutable Core::ProxyList<ProxyPoolElement> _queue;
         mutable Core::CriticalSection _lock;
+        mutable std::atomic<uint32_t> _users;
+        mutable uint32_t _hits;
+        uint32_t _misses;
+        mutable uint32_t _contention;
+        mutable std::list<Magazine*> _magazines;
     };
 
     template <typename PROXYKEY, typename PROXYELEMENT>
@@ -18,5 +18,126 @@ namespace Core {
         return (_instance);
 #endif
     }
+
+    ResourceMonitor::ResourceMonitor()
+        : _adminLock()
+        , _sealed(false)
+        , _reactors()
+    {
+        _reactors.push_back(new ResourceMonitorBase());
+    }
+
+    ResourceMonitor::~ResourceMonitor()
+    {
+        for (ResourceMonitorBase* reactor : _reactors) {
+            delete reactor;
+        }
+    }
+
+    uint32_t ResourceMonitor::Configure(const uint8_t reactors, const bool affinity)
+    {
+        uint32_t result = Core::ERROR_NONE;
+
+        _adminLock.Lock();
+
+        if (reactors == 0) {
+            // Without a reactor there is nothing to monitor the resources, keep the ones we have.
+            result = Core::ERROR_BAD_REQUEST;
+        } else if (_sealed.load(std::memory_order_relaxed) == true) {
+            // Resources are bound to the reactor selected on their address, we can not move them.
+            result = Core::ERROR_ILLEGAL_STATE;
+        } else {
+            for (ResourceMonitorBase* reactor : _reactors) {
+                delete reactor;
+            }
+            _reactors.clear();
+
+#ifdef __WINDOWS__
+            SYSTEM_INFO systemInfo;
+            ::GetSystemInfo(&systemInfo);
+            uint16_t cores = static_cast<uint16_t>(systemInfo.dwNumberOfProcessors);
+#else
+            long online = ::sysconf(_SC_NPROCESSORS_ONLN);
+            uint16_t cores = static_cast<uint16_t>(online > 0 ? online : 1);
+#endif
+
+            for (uint8_t index = 0; index < reactors; index++) {
+                ResourceMonitorBase* reactor = new ResourceMonitorBase();
+
+                if (affinity == true) {
+                    reactor->Affinity(index % cores);
+                }
+
+                _reactors.push_back(reactor);
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    void ResourceMonitor::Seal()
+    {
+        // Waits for a Configure in progress, the reactors it leaves behind are the ones used from now on.
+        _adminLock.Lock();
+        _sealed.store(true, std::memory_order_release);
+        _adminLock.Unlock();
+    }
+
+    bool ResourceMonitor::IsReactor(const ::ThreadId id) const
+    {
+        std::vector<ResourceMonitorBase*>::const_iterator index(_reactors.cbegin());
+
+        while ((index != _reactors.cend()) && ((*index)->Id() != id)) {
+            index++;
+        }
+
+        return (index != _reactors.cend());
+    }
+
+    uint32_t ResourceMonitor::Runs() const
+    {
+        uint32_t result = 0;
+
+        for (const ResourceMonitorBase* reactor : _reactors) {
+            result += reactor->Runs();
+        }
+
+        return (result);
+    }
+
+    uint32_t ResourceMonitor::Count() const
+    {
+        uint32_t result = 0;
+
+        for (const ResourceMonitorBase* reactor : _reactors) {
+            result += reactor->Count();
+        }
+
+        return (result);
+    }
+
+    bool ResourceMonitor::Info(const uint32_t position, Metadata& info) const
+    {
+        uint32_t offset = position;
+        std::vector<ResourceMonitorBase*>::const_iterator index(_reactors.cbegin());
+
+        while ((index != _reactors.cend()) && (offset >= (*index)->Count())) {
+            offset -= (*index)->Count();
+            index++;
+        }
+
+        return ((index != _reactors.cend()) && ((*index)->Info(offset, info) == true));
+    }
+
+    void ResourceMonitor::Break()
+    {
+        for (ResourceMonitorBase* reactor : _reactors) {
+            if (reactor->Count() != 0) {
+                reactor->Break();
+            }
+        }
+    }
 }
 } // namespace WPEFramework::Core
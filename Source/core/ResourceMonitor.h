@@ -1,12 +1,19 @@
 #ifndef RESOURCE_MONITOR_TYPE_H
 #define RESOURCE_MONITOR_TYPE_H
 
+#include <atomic>
+
 #include "Module.h"
 #include "Portability.h"
 #include "Singleton.h"
 #include "Thread.h"
 #include "Trace.h"
 
+// The epoll backend is opt-in (-DRESOURCE_MONITOR_EPOLL), the poll backend remains the default.
+#if defined(RESOURCE_MONITOR_EPOLL) && defined(__LINUX__) && !defined(__APPLE__)
+#define __RESOURCE_MONITOR_EPOLL__
+#endif
+
 namespace WPEFramework {
 
 namespace Core {
@@ -25,6 +32,23 @@ namespace Core {
     class ResourceMonitorType {
     private:
         static constexpr uint8_t FileDescriptorAllocation = 32;
+#ifdef __RESOURCE_MONITOR_EPOLL__
+        static constexpr uint8_t EventAllocation = 64;
+        static constexpr uint64_t SignalSlot = ~static_cast<uint64_t>(0);
+
+        // Every registered resource occupies a slot. The slot index and its generation are
+        // handed to epoll, so events reported for a slot that got reused in the mean time
+        // can be recognised and dropped.
+        struct Entry {
+            RESOURCE* resource;
+            signed int descriptor;
+            uint32_t generation;
+            uint32_t cycle;
+            uint16_t monitor;
+            uint16_t events;
+            bool queued;
+        };
+#endif
 
         typedef ResourceMonitorType<RESOURCE> Parent;
 
@@ -82,8 +106,20 @@ namespace Core {
             , _monitorRuns(0)
             , _watchDog()
             , _name(_T("Monitor::") + ClassNameOnly(typeid(RESOURCE).name()).Text())
+            , _core(-1)
 #ifdef __WINDOWS__
             , _action(WSACreateEvent())
+#elif defined(__RESOURCE_MONITOR_EPOLL__)
+            , _epollDescriptor(-1)
+            , _signalDescriptor(-1)
+            , _entries()
+            , _freeSlots()
+            , _slots()
+            , _registered()
+            , _pending()
+            , _triggerLock()
+            , _triggered()
+            , _breakAll(false)
 #else
             , _descriptorArrayLength(FileDescriptorAllocation)
             , _descriptorArray(static_cast<struct pollfd*>(::malloc(sizeof(::pollfd) * (_descriptorArrayLength + 1))))
@@ -96,7 +132,7 @@ namespace Core {
         {
 
             // All resources should be gone !!!
-            ASSERT(_resourceList.size() == 0);
+            ASSERT(Count() == 0);
 
             if (_monitor != nullptr) {
 
@@ -113,7 +149,14 @@ namespace Core {
                 delete _monitor;
             }
 
-#ifdef __LINUX__
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                ::close(_epollDescriptor);
+            }
+            if (_signalDescriptor != -1) {
+                ::close(_signalDescriptor);
+            }
+#elif defined(__LINUX__)
             ::free(_descriptorArray);
             if (_signalDescriptor != -1) {
                 ::close(_signalDescriptor);
@@ -133,14 +176,111 @@ namespace Core {
         {
             return (_monitorRuns);
         }
+        // Pin the monitor thread to the given core. Only effective if set before the first Register().
+        void Affinity(const uint16_t core)
+        {
+            _core = core;
+        }
         ::ThreadId Id() const
         {
             return (_monitor != nullptr ? _monitor->Id() : 0);
         }
         uint32_t Count() const 
         {
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            return (static_cast<uint32_t>(_slots.size()));
+#else
             return (static_cast<uint32_t>(_resourceList.size()));
+#endif
         }
+#ifdef __RESOURCE_MONITOR_EPOLL__
+        bool Info (const uint32_t position, Metadata& info) const
+        {
+            uint32_t count = position;
+
+            _adminLock.Lock();
+
+            typename std::vector<Entry>::const_iterator index(_entries.cbegin());
+            while (index != _entries.cend()) {
+                if (index->resource != nullptr) {
+                    if (count == 0) {
+                        break;
+                    }
+                    count--;
+                }
+                index++;
+            }
+
+            bool found = (index != _entries.cend());
+
+            if (found == true) {
+                info.descriptor = index->descriptor;
+                info.classname  = typeid(*(index->resource)).name();
+                info.monitor = index->monitor;
+                info.events  = index->events;
+            }
+
+            _adminLock.Unlock();
+
+            return (found);
+        }
+        void Register(RESOURCE& resource)
+        {
+            _adminLock.Lock();
+
+            // Make sure this entry does not exist, only register resources once !!!
+            ASSERT(_slots.find(&resource) == _slots.end());
+
+            Queue(Attach(resource));
+
+            if (_slots.size() == 1) {
+                if (_monitor == nullptr) {
+                    _monitor = new MonitorWorker(*this);
+
+                    // Wait till we are at least initialized
+                    _monitor->Wait(Thread::BLOCKED | Thread::STOPPED);
+                }
+
+                _monitor->Run();
+            }
+
+            // The worker might be waiting in epoll_wait, make sure it picks up the new resource.
+            Signal();
+
+            _adminLock.Unlock();
+        }
+        void Unregister(RESOURCE& resource)
+        {
+            _adminLock.Lock();
+
+            typename std::unordered_map<RESOURCE*, uint32_t>::iterator index(_slots.find(&resource));
+
+            if (index != _slots.end()) {
+                Detach(index->second);
+            }
+
+            _adminLock.Unlock();
+        }
+        // Only the given resource needs to re-evaluate its Events() and to receive a Handle(),
+        // all other resources are left untouched. Resources call this with their own locks
+        // taken, so do not take the _adminLock here, it is held while calling the resources.
+        void Trigger(RESOURCE& resource)
+        {
+            _triggerLock.Lock();
+            _triggered.push_back(&resource);
+            _triggerLock.Unlock();
+
+            Signal();
+        }
+        inline void Break()
+        {
+            _triggerLock.Lock();
+            _breakAll = true;
+            _triggerLock.Unlock();
+
+            Signal();
+        }
+#else
         bool Info (const uint32_t position, Metadata& info) const
         {
             uint32_t count = position;
@@ -212,7 +352,19 @@ namespace Core {
 
             _adminLock.Unlock();
         }
+        // Without an incremental backend every resource is re-evaluated on a Break anyway.
+        inline void Trigger(RESOURCE& /* resource */)
+        {
+            Break();
+        }
         inline void Break()
+        {
+            Signal();
+        }
+#endif
+
+    private:
+        inline void Signal()
         {
 
             ASSERT(_monitor != nullptr);
@@ -265,6 +417,18 @@ namespace Core {
 #ifdef __LINUX__
         bool Initialize()
         {
+#ifndef __APPLE__
+            if (_core != -1) {
+                cpu_set_t cpus;
+                CPU_ZERO(&cpus);
+                CPU_SET(_core, &cpus);
+
+                if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0) {
+                    TRACE_L1("Could not pin the monitor thread to core %d. Error %d", _core, errno);
+                }
+            }
+#endif
+
 #ifdef __APPLE__
 
             if ((_signalDescriptor = ::socket(AF_UNIX, SOCK_DGRAM, 0)) == -1) {
@@ -303,15 +467,261 @@ namespace Core {
 
             ASSERT(_signalDescriptor != -1);
 
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            _epollDescriptor = ::epoll_create1(EPOLL_CLOEXEC);
+
+            ASSERT(_epollDescriptor != -1);
+
+            if ((_epollDescriptor != -1) && (_signalDescriptor != -1)) {
+                struct epoll_event event;
+                event.events = EPOLLIN;
+                event.data.u64 = SignalSlot;
+
+                if (::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, _signalDescriptor, &event) != 0) {
+                    TRACE_L1("epoll_ctl on the signal descriptor failed with error <%d>", errno);
+                    ::close(_epollDescriptor);
+                    _epollDescriptor = -1;
+                }
+            }
+
+            return ((_signalDescriptor != -1) && (_epollDescriptor != -1));
+#else
             _descriptorArray[0].fd = _signalDescriptor;
             _descriptorArray[0].events = POLLIN;
             _descriptorArray[0].revents = 0;
 
             return (_signalDescriptor != -1);
+#endif
         }
 #endif
 
-#ifdef __LINUX__
+#ifdef __RESOURCE_MONITOR_EPOLL__
+        uint32_t Attach(RESOURCE& resource)
+        {
+            uint32_t slot;
+
+            if (_freeSlots.empty() == true) {
+                slot = static_cast<uint32_t>(_entries.size());
+                _entries.push_back(Entry());
+                _entries[slot].generation = 0;
+                _entries[slot].queued = false;
+            } else {
+                slot = _freeSlots.back();
+                _freeSlots.pop_back();
+            }
+
+            Entry& entry(_entries[slot]);
+            entry.resource = &resource;
+            entry.descriptor = -1;
+            entry.cycle = 0;
+            entry.monitor = 0;
+            entry.events = 0;
+
+            _slots.emplace(&resource, slot);
+
+            return (slot);
+        }
+        void Detach(const uint32_t slot)
+        {
+            Entry& entry(_entries[slot]);
+
+            ASSERT(entry.resource != nullptr);
+
+            Unsubscribe(slot);
+
+            _slots.erase(entry.resource);
+
+            entry.resource = nullptr;
+            entry.generation++;
+            _freeSlots.push_back(slot);
+        }
+        inline void Queue(const uint32_t slot)
+        {
+            if (_entries[slot].queued == false) {
+                _entries[slot].queued = true;
+                _pending.push_back(slot);
+            }
+        }
+        void Unsubscribe(const uint32_t slot)
+        {
+            Entry& entry(_entries[slot]);
+
+            if (entry.monitor != 0) {
+                typename std::unordered_map<signed int, uint32_t>::iterator index(_registered.find(entry.descriptor));
+
+                // Only remove the descriptor from epoll if it is still ours. If it was closed, the kernel
+                // dropped it already and the number might be in use by another resource by now.
+                if ((index != _registered.end()) && (index->second == slot)) {
+                    ::epoll_ctl(_epollDescriptor, EPOLL_CTL_DEL, entry.descriptor, nullptr);
+                    _registered.erase(index);
+                }
+
+                entry.monitor = 0;
+            }
+        }
+        void Subscribe(const uint32_t slot, const uint16_t events)
+        {
+            Entry& entry(_entries[slot]);
+
+            struct epoll_event event;
+            event.events = events;
+            event.data.u64 = (static_cast<uint64_t>(entry.generation) << 32) | slot;
+
+            int result;
+
+            if (entry.monitor != 0) {
+                result = ::epoll_ctl(_epollDescriptor, EPOLL_CTL_MOD, entry.descriptor, &event);
+            } else {
+                std::pair<typename std::unordered_map<signed int, uint32_t>::iterator, bool> index(_registered.emplace(entry.descriptor, slot));
+
+                if (index.second == false) {
+                    // This descriptor number was closed and reused, the previous owner lost its registration.
+                    _entries[index.first->second].monitor = 0;
+                    index.first->second = slot;
+                    ::epoll_ctl(_epollDescriptor, EPOLL_CTL_DEL, entry.descriptor, nullptr);
+                }
+
+                result = ::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, entry.descriptor, &event);
+            }
+
+            if (result != 0) {
+                TRACE_L1("epoll_ctl failed for descriptor <%d> with error <%d>", entry.descriptor, errno);
+            } else {
+                entry.monitor = events;
+            }
+        }
+        void Update(const uint32_t slot)
+        {
+            RESOURCE* resource = _entries[slot].resource;
+
+            uint16_t events = resource->Events();
+
+            // Events() might have (un)registered resources, so do not keep references to the slots.
+            if (_entries[slot].resource == resource) {
+                if (events == 0) {
+                    Detach(slot);
+                } else {
+                    signed int descriptor = resource->Descriptor();
+
+                    if (descriptor != _entries[slot].descriptor) {
+                        Unsubscribe(slot);
+                        _entries[slot].descriptor = descriptor;
+                    }
+                    if (events != _entries[slot].monitor) {
+                        Subscribe(slot, events);
+                    }
+                }
+            }
+        }
+        void Dispatch(const uint32_t slot, const uint16_t flagsSet)
+        {
+            Entry& entry(_entries[slot]);
+
+            if ((entry.resource != nullptr) && (entry.cycle != _monitorRuns)) {
+                RESOURCE* resource = entry.resource;
+
+                entry.cycle = _monitorRuns;
+                entry.events = flagsSet;
+
+                // Whatever happened in the Handle, the resource might want to be monitored differently.
+                Queue(slot);
+
+                Arm<WATCHDOG>();
+
+                resource->Handle(flagsSet);
+
+                Reset<WATCHDOG>();
+            }
+        }
+#endif
+
+#ifdef __RESOURCE_MONITOR_EPOLL__
+        uint32_t Worker()
+        {
+            uint32_t delay = 0;
+
+            _monitorRuns++;
+
+            _adminLock.Lock();
+
+            // Only the resources that registered or were handled last round need their Events() re-evaluated.
+            while (_pending.empty() == false) {
+                std::vector<uint32_t> pending;
+                pending.swap(_pending);
+
+                for (const uint32_t slot : pending) {
+                    _entries[slot].queued = false;
+
+                    if (_entries[slot].resource != nullptr) {
+                        Update(slot);
+                    }
+                }
+            }
+
+            if (_slots.empty() == false) {
+                _adminLock.Unlock();
+
+                int result = ::epoll_wait(_epollDescriptor, _eventArray, EventAllocation, -1);
+
+                _adminLock.Lock();
+
+                if (result == -1) {
+                    if (errno != EINTR) {
+                        TRACE_L1("epoll_wait failed with error <%d>", errno);
+                    }
+                    result = 0;
+                }
+
+                for (int index = 0; index < result; index++) {
+                    const uint64_t data = _eventArray[index].data.u64;
+
+                    if (data == SignalSlot) {
+                        /* We have a valid signal, read the info from the fd */
+                        struct signalfd_siginfo info;
+                        uint32_t VARIABLE_IS_NOT_USED bytes = read(_signalDescriptor, &info, sizeof(info));
+                        ASSERT(bytes == sizeof(info) || bytes == 0);
+                    } else {
+                        const uint32_t slot = static_cast<uint32_t>(data & 0xFFFFFFFF);
+
+                        // Drop events of resources that were unregistered while we were waiting.
+                        if ((slot < _entries.size()) && (_entries[slot].generation == static_cast<uint32_t>(data >> 32))) {
+                            Dispatch(slot, static_cast<uint16_t>(_eventArray[index].events));
+                        }
+                    }
+                }
+
+                std::vector<RESOURCE*> triggered;
+
+                _triggerLock.Lock();
+                triggered.swap(_triggered);
+                bool breakAll = _breakAll;
+                _breakAll = false;
+                _triggerLock.Unlock();
+
+                // Resources that issued a Break, get a Handle, even if no flags were set.
+                for (RESOURCE* resource : triggered) {
+                    typename std::unordered_map<RESOURCE*, uint32_t>::iterator index(_slots.find(resource));
+
+                    if (index != _slots.end()) {
+                        Dispatch(index->second, 0);
+                    }
+                }
+
+                if (breakAll == true) {
+                    for (uint32_t slot = 0; slot < _entries.size(); slot++) {
+                        Dispatch(slot, 0);
+                    }
+                }
+            } else {
+                _monitor->Block();
+                delay = Core::infinite;
+            }
+
+            _adminLock.Unlock();
+
+            return (delay);
+        }
+#elif defined(__LINUX__)
         uint32_t Worker()
         {
             uint32_t delay = 0;
@@ -501,8 +911,21 @@ namespace Core {
         uint32_t _monitorRuns;
         WATCHDOG _watchDog;
         string _name;
+        int32_t _core;
 
-#ifdef __LINUX__
+#ifdef __RESOURCE_MONITOR_EPOLL__
+        int _epollDescriptor;
+        int _signalDescriptor;
+        std::vector<Entry> _entries;
+        std::vector<uint32_t> _freeSlots;
+        std::unordered_map<RESOURCE*, uint32_t> _slots;
+        std::unordered_map<signed int, uint32_t> _registered;
+        std::vector<uint32_t> _pending;
+        Core::CriticalSection _triggerLock;
+        std::vector<RESOURCE*> _triggered;
+        bool _breakAll;
+        struct epoll_event _eventArray[EventAllocation];
+#elif defined(__LINUX__)
         uint32_t _descriptorArrayLength;
         struct ::pollfd* _descriptorArray;
         int _signalDescriptor;
@@ -543,20 +966,82 @@ namespace Core {
     typedef ResourceMonitorType<IResource> ResourceMonitorBase;
 #endif
 
-    class EXTERNAL ResourceMonitor : public ResourceMonitorBase {
+    // The ResourceMonitor spreads the resources over one or more reactors, each with its own monitor
+    // thread. A resource is always handled by the same reactor, selected by hashing its address, so
+    // no administration is needed to find it back and connections accepted by a SocketServerType are
+    // balanced over all reactors.
+    class EXTERNAL ResourceMonitor {
     private:
-        ResourceMonitor()
-            : ResourceMonitorBase()
-        {
-        }
+        ResourceMonitor();
         ResourceMonitor(const ResourceMonitor&) = delete;
         ResourceMonitor& operator=(const ResourceMonitor&) = delete;
 
         friend class SingletonType<ResourceMonitor>;
 
     public:
+        typedef ResourceMonitorBase::Metadata Metadata;
+
         static ResourceMonitor& Instance();
-        ~ResourceMonitor() {}
+        ~ResourceMonitor();
+
+    public:
+        // The number of reactors can only be changed before the first resource is registered, from
+        // then on the reactors are fixed, so the other methods can use them without locking. At least
+        // one reactor is required, asking for none is refused with ERROR_BAD_REQUEST.
+        uint32_t Configure(const uint8_t reactors, const bool affinity);
+
+        inline uint8_t Reactors() const
+        {
+            return (static_cast<uint8_t>(_reactors.size()));
+        }
+        inline ::ThreadId Id(const uint8_t reactor = 0) const
+        {
+            ASSERT(reactor < _reactors.size());
+
+            return (_reactors[reactor]->Id());
+        }
+        inline void Register(IResource& resource)
+        {
+            if (_sealed.load(std::memory_order_acquire) == false) {
+                Seal();
+            }
+
+            Reactor(resource).Register(resource);
+        }
+        inline void Unregister(IResource& resource)
+        {
+            Reactor(resource).Unregister(resource);
+        }
+        inline void Trigger(IResource& resource)
+        {
+            Reactor(resource).Trigger(resource);
+        }
+        bool IsReactor(const ::ThreadId id) const;
+        uint32_t Runs() const;
+        uint32_t Count() const;
+        bool Info(const uint32_t position, Metadata& info) const;
+        void Break();
+
+    private:
+        void Seal();
+
+        inline ResourceMonitorBase& Reactor(const IResource& resource) const
+        {
+            if (_reactors.size() == 1) {
+                return (*(_reactors[0]));
+            }
+
+            // Objects are at least pointer aligned, mix in the upper bits before selecting the reactor.
+            uintptr_t key = (reinterpret_cast<uintptr_t>(&resource) >> 4);
+            key ^= (key >> 16);
+
+            return (*(_reactors[key % _reactors.size()]));
+        }
+
+    private:
+        Core::CriticalSection _adminLock;
+        std::atomic<bool> _sealed;
+        std::vector<ResourceMonitorBase*> _reactors;
     };
 }
 } // namespace WPEFramework::Core
@@ -6,7 +6,8 @@ namespace Core {
     /* static */ ServiceAdministrator ServiceAdministrator::_systemServiceAdministrator;
 
     ServiceAdministrator::ServiceAdministrator()
-        : _services()
+        : _adminLock()
+        , _services()
         , _instanceCount(0)
     {
     }
@@ -17,20 +18,30 @@ namespace Core {
 
     void ServiceAdministrator::Register(IServiceMetadata* service)
     {
+        _adminLock.Lock();
+
         // Only register a service once !!!
         ASSERT(std::find(_services.begin(), _services.end(), service) == _services.end());
 
         _services.push_back(service);
+
+        _adminLock.Unlock();
     }
 
     void ServiceAdministrator::Unregister(IServiceMetadata* service)
     {
+        _adminLock.Lock();
+
         std::list<IServiceMetadata*>::iterator index = std::find(_services.begin(), _services.end(), service);
 
         // Only unregister a service once !!!
         ASSERT(index != _services.end());
 
-        _services.erase(index);
+        if (index != _services.end()) {
+            _services.erase(index);
+        }
+
+        _adminLock.Unlock();
     }
 
     /* static */ ServiceAdministrator& ServiceAdministrator::Instance()
@@ -40,7 +51,11 @@ namespace Core {
 
     void* ServiceAdministrator::Instantiate(const Library& library, const char name[], const uint32_t version, const uint32_t interfaceNumber)
     {
+        void* result = nullptr;
         bool found = false;
+
+        _adminLock.Lock();
+
         std::list<IServiceMetadata*>::iterator index = _services.begin();
 
         while ((index != _services.end()) && (found == false)) {
@@ -51,19 +66,29 @@ namespace Core {
                 index++;
             }
         }
-        return (found == true ? (*index)->Create(library, interfaceNumber) : nullptr);
+        if (found == true) {
+            result = (*index)->Create(library, interfaceNumber);
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
     }
 
     void ServiceAdministrator::ReleaseLibrary(const Library& reference)
     {
+        _adminLock.Lock();
         UnreferencedLibraries.push_back(reference);
+        _adminLock.Unlock();
     }
 
     void ServiceAdministrator::FlushLibraries()
     {
+        _adminLock.Lock();
         while (UnreferencedLibraries.size() != 0) {
             UnreferencedLibraries.pop_front();
         }
+        _adminLock.Unlock();
     }
 }
 } // namespace Core
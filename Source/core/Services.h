@@ -70,6 +70,8 @@ namespace Core {
         }
 
     private:
+        // Plugins are loaded concurrently at startup, so libraries register while others instantiate.
+        Core::CriticalSection _adminLock;
         std::list<IServiceMetadata*> _services;
         mutable uint32_t _instanceCount;
         static ServiceAdministrator _systemServiceAdministrator;
@@ -1,4 +1,5 @@
 #include "SharedBuffer.h"
+#include "Number.h"
 
 // TODO: remove if no longer needed for simple tracing.
 #include <iostream>
@@ -8,8 +9,8 @@ namespace WPEFramework {
 namespace Core {
 
 #ifdef __WINDOWS__
-    SharedBuffer::Semaphore::Semaphore(const TCHAR sourceName[])
-        : _semaphore(::CreateSemaphore(nullptr, 1, 1, sourceName))
+    SharedBuffer::Semaphore::Semaphore(const TCHAR sourceName[], const uint32_t count)
+        : _semaphore(::CreateSemaphore(nullptr, count, 1, sourceName))
     {
     }
 #else
@@ -144,5 +145,133 @@ namespace Core {
     SharedBuffer::~SharedBuffer()
     {
     }
+
+    SharedBufferRing::SharedBufferRing(const TCHAR name[])
+        : _data(name, File::USER_READ | File::USER_WRITE | File::SHAREABLE)
+        , _administrationBuffer((string(name) + _T(".ring")), File::USER_READ | File::USER_WRITE | File::SHAREABLE)
+        , _slotSize(0)
+        , _slots()
+        , _producerLock()
+        , _head(0)
+        , _tail(0)
+    {
+        if (_administrationBuffer.Size() >= (sizeof(Administration) + sizeof(void*))) {
+            Load(false);
+        }
+    }
+
+    SharedBufferRing::SharedBufferRing(const TCHAR name[], const uint32_t mode, const uint8_t slots, const uint32_t slotSize, const uint16_t administrationSize)
+        : _data(name, mode | File::SHAREABLE | File::CREATE, slots * slotSize)
+        , _administrationBuffer((string(name) + _T(".ring")), mode | File::SHAREABLE | File::CREATE, sizeof(Administration) + (slots * Stride(administrationSize)) + (2 * sizeof(void*)) + 8 /* Align buffer on 64 bits boundary */)
+        , _slotSize(slotSize)
+        , _slots()
+        , _producerLock()
+        , _head(0)
+        , _tail(0)
+    {
+        ASSERT(slots > 0);
+
+        Administration* administration = reinterpret_cast<Administration*>(PointerAlign(_administrationBuffer.Buffer()));
+
+        administration->_slots = slots;
+        administration->_slotSize = slotSize;
+        administration->_administrationSize = administrationSize;
+
+        Load(true);
+    }
+
+    SharedBufferRing::~SharedBufferRing()
+    {
+        for (Entry& entry : _slots) {
+            delete entry.Free;
+            delete entry.Produced;
+            delete entry.Consumed;
+        }
+    }
+
+    void SharedBufferRing::Load(const bool initialize)
+    {
+        const Administration* administration = reinterpret_cast<const Administration*>(PointerAlign(_administrationBuffer.Buffer()));
+        const uint32_t stride = Stride(static_cast<uint16_t>(administration->_administrationSize));
+        uint8_t* base = PointerAlign(&(reinterpret_cast<uint8_t*>(const_cast<Administration*>(administration))[sizeof(Administration)]));
+
+        // The consumer takes the layout from a file someone else wrote, a layout that does not fit in
+        // what is mapped leaves the ring without slots, so it is not valid.
+        if ((administration->_slots == 0) || (administration->_slots > 0xFF) || (administration->_slotSize == 0) || (administration->_administrationSize > 0xFFFF) || (_data.Size() < (static_cast<uint64_t>(administration->_slots) * administration->_slotSize)) || (_administrationBuffer.Size() < (static_cast<uint64_t>(base - _administrationBuffer.Buffer()) + (static_cast<uint64_t>(administration->_slots) * stride)))) {
+            TRACE_L1("SharedBufferRing %s: the layout does not fit the mapped size", Name().c_str());
+
+            ASSERT(initialize == false);
+
+            return;
+        }
+
+        _slotSize = administration->_slotSize;
+        _slots.reserve(administration->_slots);
+
+        for (uint32_t index = 0; index < administration->_slots; index++) {
+            Slot* slot = reinterpret_cast<Slot*>(&(base[index * stride]));
+            Entry entry;
+
+            if (initialize == true) {
+                ::memset(slot, 0, stride);
+
+#ifndef __WINDOWS__
+                sem_init(&(slot->_free), 1, 1); /* Initial value is 1. */
+                sem_init(&(slot->_produced), 1, 0); /* Initial value is 0. */
+                sem_init(&(slot->_consumed), 1, 0); /* Initial value is 0. */
+#endif
+            }
+
+            entry.Shared = slot;
+            entry.Administration = &(reinterpret_cast<uint8_t*>(slot)[sizeof(Slot)]);
+#ifdef __WINDOWS__
+            const string prefix(Name() + _T(".slot") + Core::NumberType<uint32_t>(index).Text());
+            entry.Free = new SharedBuffer::Semaphore((prefix + _T(".free")).c_str(), 1);
+            entry.Produced = new SharedBuffer::Semaphore((prefix + _T(".produced")).c_str(), 0);
+            entry.Consumed = new SharedBuffer::Semaphore((prefix + _T(".consumed")).c_str(), 0);
+#else
+            entry.Free = new SharedBuffer::Semaphore(&(slot->_free));
+            entry.Produced = new SharedBuffer::Semaphore(&(slot->_produced));
+            entry.Consumed = new SharedBuffer::Semaphore(&(slot->_consumed));
+#endif
+            _slots.push_back(entry);
+        }
+    }
+
+    uint32_t SharedBufferRing::RequestProduce(const uint32_t waitTime, uint8_t& slot)
+    {
+        ASSERT(_slots.size() != 0);
+
+        // Slots are handed out in order, the next producer waits for the same slot to be released,
+        // otherwise it would get ahead of a slot that was not produced and stall the consumer.
+        _producerLock.Lock();
+
+        const uint8_t next = static_cast<uint8_t>(_head % _slots.size());
+        uint32_t result = _slots[next].Free->Lock(waitTime);
+
+        if (result == ERROR_NONE) {
+            slot = next;
+            _head++;
+        }
+
+        _producerLock.Unlock();
+
+        return (result);
+    }
+
+    uint32_t SharedBufferRing::RequestConsume(const uint32_t waitTime, uint8_t& slot)
+    {
+        ASSERT(_slots.size() != 0);
+
+        const uint8_t next = static_cast<uint8_t>(_tail % _slots.size());
+        uint32_t result = _slots[next].Produced->Lock(waitTime);
+
+        if (result == ERROR_NONE) {
+            slot = next;
+            _tail++;
+        }
+
+        return (result);
+    }
 }
 }
@@ -2,10 +2,12 @@
 #define __SHARED_BUFFER_H
 
 #include <memory> // align
+#include <vector>
 
 // ---- Include local include files ----
 #include "DataElementFile.h"
 #include "Module.h"
+#include "Sync.h"
 
 #ifndef __WINDOWS__
 #include <semaphore.h>
@@ -40,6 +42,9 @@ namespace Core {
     //               jumps. Do not use SharedBuffer class when the Time subsystem is not yet available.
     //
     class EXTERNAL SharedBuffer : public DataElementFile {
+    private:
+        friend class SharedBufferRing;
+
     private:
         SharedBuffer() = delete;
         SharedBuffer(const SharedBuffer&) = delete;
@@ -54,7 +59,7 @@ namespace Core {
 
         public:
 #ifdef __WINDOWS__
-            Semaphore(const TCHAR name[]);
+            Semaphore(const TCHAR name[], const uint32_t count = 1);
 #else
             Semaphore(sem_t* storage);
             //Semaphore(sem_t* storage, bool initialize) {
@@ -169,6 +174,166 @@ namespace Core {
         Semaphore _consumer;
         uint8_t* _customerAdministration;
     };
+
+    // Rationale:
+    // The SharedBuffer hands one buffer back and forth, so the producer has to wait for every
+    // buffer to come back before it can produce the next one. The SharedBufferRing has a number
+    // of slots, all the same size, each with an administration area of its own. The producer
+    // can fill the next slots while the consumer is still handling the previous ones, and the
+    // consumer can handle all slots that have been produced, back to back.
+    // Slots are produced and consumed in order. Every slot goes around:
+    //   producer: RequestProduce -> fill the slot -> Produced
+    //   consumer: RequestConsume -> handle the slot -> Consumed
+    //   producer: RequestResult -> read the slot -> Release
+    // There can be more threads producing in the same process, there is only one consumer.
+    class EXTERNAL SharedBufferRing {
+    private:
+        SharedBufferRing() = delete;
+        SharedBufferRing(const SharedBufferRing&) = delete;
+        SharedBufferRing& operator=(const SharedBufferRing&) = delete;
+
+    private:
+        struct Administration {
+            uint32_t _slots;
+            uint32_t _slotSize;
+            uint32_t _administrationSize;
+        };
+        struct Slot {
+            uint32_t _bytesWritten;
+
+#ifndef __WINDOWS__
+            sem_t _free;
+            sem_t _produced;
+            sem_t _consumed;
+#endif
+        };
+
+    public:
+        // This is the consumer constructor. It should always take place, after, the producer
+        // construct. The layout of the slots is taken from what the producer created.
+        SharedBufferRing(const TCHAR name[]);
+
+        // This is the Producer constructor. All slots are free.
+        SharedBufferRing(const TCHAR name[], const uint32_t mode, const uint8_t slots, const uint32_t slotSize, const uint16_t administrationSize);
+
+        ~SharedBufferRing();
+
+    public:
+        // The producer creates the ring next to the buffer a SharedBuffer would have.
+        static bool Exists(const TCHAR name[])
+        {
+            return (File(string(name) + _T(".ring")).Exists());
+        }
+
+        inline bool IsValid() const
+        {
+            return ((_data.IsValid() == true) && (_administrationBuffer.IsValid() == true) && (_slots.size() != 0));
+        }
+        inline const string& Name() const
+        {
+            return (_data.Name());
+        }
+        inline uint8_t Slots() const
+        {
+            return (static_cast<uint8_t>(_slots.size()));
+        }
+        inline uint32_t SlotSize() const
+        {
+            return (_slotSize);
+        }
+        inline uint8_t* Buffer(const uint8_t slot)
+        {
+            ASSERT(slot < _slots.size());
+
+            return (&(_data.Buffer()[slot * _slotSize]));
+        }
+        inline const uint8_t* Buffer(const uint8_t slot) const
+        {
+            ASSERT(slot < _slots.size());
+
+            return (&(_data.Buffer()[slot * _slotSize]));
+        }
+        inline uint8_t* AdministrationBuffer(const uint8_t slot)
+        {
+            ASSERT(slot < _slots.size());
+
+            return (_slots[slot].Administration);
+        }
+        inline const uint8_t* AdministrationBuffer(const uint8_t slot) const
+        {
+            ASSERT(slot < _slots.size());
+
+            return (_slots[slot].Administration);
+        }
+        inline uint32_t BytesWritten(const uint8_t slot) const
+        {
+            ASSERT(slot < _slots.size());
+
+            return (_slots[slot].Shared->_bytesWritten);
+        }
+        inline void BytesWritten(const uint8_t slot, const uint32_t length)
+        {
+            ASSERT(slot < _slots.size());
+            ASSERT(length <= _slotSize);
+
+            _slots[slot].Shared->_bytesWritten = (length <= _slotSize ? length : _slotSize);
+        }
+
+        // Producer side
+        uint32_t RequestProduce(const uint32_t waitTime, uint8_t& slot);
+        uint32_t Produced(const uint8_t slot)
+        {
+            ASSERT(slot < _slots.size());
+
+            return (_slots[slot].Produced->Unlock());
+        }
+        uint32_t RequestResult(const uint8_t slot, const uint32_t waitTime)
+        {
+            ASSERT(slot < _slots.size());
+
+            return (_slots[slot].Consumed->Lock(waitTime));
+        }
+        uint32_t Release(const uint8_t slot)
+        {
+            ASSERT(slot < _slots.size());
+
+            return (_slots[slot].Free->Unlock());
+        }
+
+        // Consumer side
+        uint32_t RequestConsume(const uint32_t waitTime, uint8_t& slot);
+        uint32_t Consumed(const uint8_t slot)
+        {
+            ASSERT(slot < _slots.size());
+
+            return (_slots[slot].Consumed->Unlock());
+        }
+
+    private:
+        struct Entry {
+            Slot* Shared;
+            uint8_t* Administration;
+            SharedBuffer::Semaphore* Free;
+            SharedBuffer::Semaphore* Produced;
+            SharedBuffer::Semaphore* Consumed;
+        };
+
+        static uint32_t Stride(const uint16_t administrationSize)
+        {
+            return (((sizeof(Slot) + administrationSize) + (sizeof(uint64_t) - 1)) & ~static_cast<uint32_t>(sizeof(uint64_t) - 1));
+        }
+
+        void Load(const bool initialize);
+
+    private:
+        DataElementFile _data;
+        DataElementFile _administrationBuffer;
+        uint32_t _slotSize;
+        std::vector<Entry> _slots;
+        CriticalSection _producerLock;
+        uint32_t _head;
+        uint32_t _tail;
+    };
 }
 } // namespace WPEFramework::Core
 
@@ -121,6 +121,18 @@ namespace Core {
     static constexpr uint32_t MAX_LISTEN_QUEUE = 64;
     static constexpr uint32_t SLEEPSLOT_TIME = 100;
 
+    // On a stream, the next message is only serialized behind the previous one if there is at least
+    // this much room left. Smaller leftovers would just chop the message in tiny pieces.
+    static constexpr uint32_t GATHER_THRESHOLD = 128;
+
+    // What was gathered before a close, still goes out. If the socket has no room for it, the reactor
+    // sends the rest as room comes available, for at most this long, before the link is shut down.
+    static constexpr uint32_t LINGER_TIME = 1000;
+
+    // The number of descriptors that travel along with a single send(), the receiving side reserves
+    // room for this many on every read.
+    static constexpr uint8_t MAX_DESCRIPTORS = 16;
+
     inline void DestroySocket(SOCKET& socket)
     {
 #ifdef __LINUX__
@@ -169,8 +181,8 @@ namespace Core {
         const enumType socketType,
         const NodeId& refLocalNode,
         const NodeId& refremoteNode,
-        const uint16_t nSendBufferSize,
-        const uint16_t nReceiveBufferSize)
+        const uint32_t nSendBufferSize,
+        const uint32_t nReceiveBufferSize)
         : m_LocalNode(refLocalNode)
         , m_RemoteNode(refremoteNode)
         , m_ReceiveBufferSize(nReceiveBufferSize)
@@ -182,6 +194,11 @@ namespace Core {
         , m_ReceivedNode()
         , m_SendBuffer(nullptr)
         , m_ReceiveBuffer(nullptr)
+        , m_Linger(0)
+        , m_Offered()
+        , m_OfferCount(0)
+        , m_Received()
+        , m_ReceiveCount(0)
     {
         TRACE_L5("Constructor SocketPort (NodeId&) <%p>", (this));
     }
@@ -190,8 +207,8 @@ namespace Core {
         const enumType socketType,
         const SOCKET& refConnector,
         const NodeId& remoteNode,
-        const uint16_t nSendBufferSize,
-        const uint16_t nReceiveBufferSize)
+        const uint32_t nSendBufferSize,
+        const uint32_t nReceiveBufferSize)
         : m_LocalNode(remoteNode.AnyInterface())
         , m_RemoteNode(remoteNode)
         , m_ReceiveBufferSize(nReceiveBufferSize)
@@ -203,6 +220,11 @@ namespace Core {
         , m_ReceivedNode()
         , m_SendBuffer(nullptr)
         , m_ReceiveBuffer(nullptr)
+        , m_Linger(0)
+        , m_Offered()
+        , m_OfferCount(0)
+        , m_Received()
+        , m_ReceiveCount(0)
     {
         NodeId::SocketInfo localAddress;
         socklen_t localSize = sizeof(localAddress);
@@ -290,10 +312,13 @@ namespace Core {
     {
         uint32_t nStatus = Core::ERROR_ILLEGAL_STATE;
 
+        m_ReadOffset = 0;
         m_ReadBytes = 0;
         m_SendBytes = 0;
         m_SendOffset = 0;
 
+        Dispose();
+
         if ((m_State & (SocketPort::LINK | SocketPort::OPEN | SocketPort::MONITOR)) == (SocketPort::LINK | SocketPort::OPEN)) {
             // Open up an accepted socket, but not yet added to the monitor.
             nStatus = Core::ERROR_NONE;
@@ -391,17 +416,30 @@ namespace Core {
                     // No use to wait on anything !!, Signal a FORCED CLOSURE (EXCEPTION && SHUTDOWN)
                     m_State |= (SHUTDOWN | EXCEPTION);
                 } else {
-                    m_State |= SHUTDOWN;
+                    // Messages gathered in the send buffer before the close was requested, still go out.
+                    // Whatever does not fit in the socket now, is left to the reactor, nobody waits for it here.
+                    m_State &= (~SocketPort::WRITE);
+
+                    if (m_SendOffset != m_SendBytes) {
+                        Transmit();
+                    }
+
+                    if ((m_SendOffset != m_SendBytes) && ((m_State & SocketPort::EXCEPTION) == 0)) {
+                        m_Linger = Time::Now().Add(LINGER_TIME).Ticks();
+                        m_State |= (SHUTDOWN | LINGER);
+                    } else {
+                        m_State |= SHUTDOWN;
 
-					// Block new data from coming in, signal the other side that we close !!
+                        // Block new data from coming in, signal the other side that we close !!
 #ifdef __WINDOWS__
-                    shutdown(m_Socket, SD_BOTH);
+                        shutdown(m_Socket, SD_BOTH);
 #else
-                    shutdown(m_Socket, SHUT_RDWR);
+                        shutdown(m_Socket, SHUT_RDWR);
 #endif
+                    }
                 }
 
-                ResourceMonitor::Instance().Break();
+                ResourceMonitor::Instance().Trigger(*this);
             }
 
             if (waitTime > 0) {
@@ -413,7 +451,7 @@ namespace Core {
 
                     // We probably did not get a response from the otherside on the close
                     // sloppy but let's forcefully close it
-                    ResourceMonitor::Instance().Break();
+                    ResourceMonitor::Instance().Trigger(*this);
 
                     closed = (WaitForClosure(Core::infinite) == Core::ERROR_NONE);
 
@@ -434,7 +472,7 @@ namespace Core {
         if ((m_State & (SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) {
 
             m_State |= SocketPort::WRITESLOT;
-            ResourceMonitor::Instance().Break();
+            ResourceMonitor::Instance().Trigger(*this);
         }
         m_syncAdmin.Unlock();
     }
@@ -450,7 +488,7 @@ namespace Core {
         uint32_t receiveBuffer = m_ReceiveBufferSize;
         uint32_t sendBuffer = m_SendBufferSize;
 
-        if (m_ReceiveBufferSize == static_cast<uint16_t>(~0)) {
+        if (m_ReceiveBufferSize == static_cast<uint32_t>(~0)) {
             ::getsockopt(socket, SOL_SOCKET, SO_RCVBUF, (char*)&value, &valueLength);
 
             receiveBuffer = static_cast<uint32_t>(value);
@@ -460,7 +498,7 @@ namespace Core {
             TRACE_L1("Error could not set Receive buffer size (%d).", receiveBuffer);
         }
 
-        if (m_SendBufferSize == static_cast<uint16_t>(~0)) {
+        if (m_SendBufferSize == static_cast<uint32_t>(~0)) {
             ::getsockopt(socket, SOL_SOCKET, SO_SNDBUF, (char*)&value, &valueLength);
 
             sendBuffer = static_cast<uint32_t>(value);
@@ -600,7 +638,7 @@ namespace Core {
         // Right, a wait till connection is closed is requested..
         while ((waiting > 0) && (IsOpen() == false)) {
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(ResourceMonitor::Instance().IsReactor(Core::Thread::ThreadId()) == false);
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -635,7 +673,7 @@ namespace Core {
                 break;
             }
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(ResourceMonitor::Instance().IsReactor(Core::Thread::ThreadId()) == false);
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -664,7 +702,7 @@ namespace Core {
         // Right, a wait till connection is closed is requested..
         while ((waiting > 0) && (IsClosed() == false)) {
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(ResourceMonitor::Instance().IsReactor(Core::Thread::ThreadId()) == false);
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -695,7 +733,8 @@ namespace Core {
 #ifdef __WINDOWS__
             result = FD_CLOSE;
 #else
-            result = POLLIN;
+            // While lingering, nothing is read anymore.
+            result = ((m_State & SocketPort::LINGER) == 0 ? POLLIN : 0);
 #endif
 
             // It is the first time we are going to pick this one up..
@@ -720,7 +759,9 @@ namespace Core {
                 m_State &= ~SocketPort::MONITOR;
             } else {
 
-                if ((IsOpen()) && ((m_State & SocketPort::WRITESLOT) != 0)) {
+                if ((m_State & SocketPort::LINGER) != 0) {
+                    Linger();
+                } else if ((IsOpen()) && ((m_State & SocketPort::WRITESLOT) != 0)) {
                     Write();
                 }
 #ifdef __LINUX__
@@ -742,6 +783,10 @@ namespace Core {
 #ifdef __WINDOWS__
             if ((flagsSet & FD_CLOSE) != 0) {
                 Closed();
+            } else if ((m_State & SocketPort::LINGER) != 0) {
+                if ((flagsSet & FD_WRITE) != 0) {
+                    Linger();
+                }
             } else if (IsListening()) {
                 if ((flagsSet & FD_ACCEPT) != 0) {
                     // This triggeres an Addition of clients
@@ -761,7 +806,15 @@ namespace Core {
 
 #else
             if ((flagsSet & POLLHUP) != 0) {
+                // What the other side sent before it hung up, is still handed over.
+                if ((IsOpen() == true) && ((flagsSet & POLLIN) != 0)) {
+                    Read();
+                }
                 Closed();
+            } else if ((m_State & SocketPort::LINGER) != 0) {
+                if ((flagsSet & POLLOUT) != 0) {
+                    Linger();
+                }
             } else if (IsListening()) {
                 if ((flagsSet & POLLIN) != 0) {
                     // This triggeres an Addition of clients
@@ -791,52 +844,150 @@ namespace Core {
 
         while (((m_State & (SocketPort::WRITE | SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) && (dataLeftToSend == true)) {
             if (m_SendOffset == m_SendBytes) {
-                m_SendBytes = SendData(m_SendBuffer, m_SendBufferSize);
                 m_SendOffset = 0;
+                m_SendBytes = 0;
+                Gather();
                 dataLeftToSend = (m_SendOffset != m_SendBytes);
 
                 ASSERT(m_SendBytes <= m_SendBufferSize);
             }
 
-            if (dataLeftToSend == true) {
-                int32_t sendSize;
+            // Gathering might have closed the link, in which case Close() already flushed the buffer.
+            if ((dataLeftToSend == true) && ((m_State & SocketPort::SHUTDOWN) == 0)) {
+                Transmit();
+            }
+        }
 
-                // Sockets are non blocking the Send buffer size is equal to the buffer size. We only send
-                // if the buffer free (SEND flag) is active, so the buffer should always fit.
-                if (((m_State & SocketPort::LINK) == 0) && (m_RemoteNode.IsValid() == true)) {
-                    ASSERT(m_RemoteNode.IsValid() == true);
+        m_syncAdmin.Unlock();
+    }
 
-                    sendSize = ::sendto(m_Socket,
-                        reinterpret_cast<const char*>(&m_SendBuffer[m_SendOffset]),
-                        m_SendBytes - m_SendOffset, 0,
-                        static_cast<const NodeId&>(m_RemoteNode),
-                        m_RemoteNode.Size());
+    void SocketPort::Gather()
+    {
+        // m_SendBytes is kept up to date while gathering: a SendData() may close the link, and Close()
+        // sends what was gathered up to then.
+        uint32_t space = m_SendBufferSize;
+        uint32_t loaded = SendData(m_SendBuffer, space);
+
+        m_SendBytes += loaded;
+
+        // A datagram is one message, but on a stream the messages that are ready can share a single send().
+        // Keep on serializing as long as the previous message completed in the room it was offered.
+        if ((m_State & SocketPort::LINK) != 0) {
+            while ((loaded != 0) && (loaded < space) && ((m_SendBufferSize - m_SendBytes) >= GATHER_THRESHOLD) && ((m_State & SocketPort::SHUTDOWN) == 0)) {
+                space = m_SendBufferSize - m_SendBytes;
+                loaded = SendData(&(m_SendBuffer[m_SendBytes]), space);
+                m_SendBytes += loaded;
+            }
+        }
+    }
 
-                } else {
-                    sendSize = ::send(m_Socket,
-                        reinterpret_cast<const char*>(&m_SendBuffer[m_SendOffset]),
-                        m_SendBytes - m_SendOffset, 0);
-                }
+    void SocketPort::Linger()
+    {
+        m_syncAdmin.Lock();
 
-                if (sendSize >= 0) {
-                    m_SendOffset = ((m_State & SocketPort::LINK) != 0 ? m_SendOffset + sendSize : m_SendBytes);
-                } else {
-                    uint32_t l_Result = __ERRORRESULT__;
+        m_State &= (~SocketPort::WRITE);
 
-                    if ((l_Result == __ERROR_WOULDBLOCK__) || (l_Result == __ERROR_AGAIN__) || (l_Result == __ERROR_INPROGRESS__)) {
-                        m_State |= SocketPort::WRITE;
-                    } else {
-                        printf("Write exception. %d\n", l_Result);
-                        m_State |= SocketPort::EXCEPTION;
-                        StateChange();
-                    }
-                }
+        if ((m_SendOffset != m_SendBytes) && ((m_State & SocketPort::EXCEPTION) == 0)) {
+            Transmit();
+        }
+
+        // Done when all went out, when it can not go out, or when the other side takes too long to make room.
+        if ((m_SendOffset == m_SendBytes) || ((m_State & SocketPort::EXCEPTION) != 0) || (Time::Now().Ticks() >= m_Linger)) {
+            if (m_SendOffset != m_SendBytes) {
+                TRACE_L1("Closing with %d bytes left unsent.", m_SendBytes - m_SendOffset);
             }
+
+            m_State &= (~(SocketPort::LINGER | SocketPort::WRITE));
+
+#ifdef __WINDOWS__
+            shutdown(m_Socket, SD_BOTH);
+#else
+            shutdown(m_Socket, SHUT_RDWR);
+#endif
         }
 
         m_syncAdmin.Unlock();
     }
 
+    void SocketPort::Transmit()
+    {
+        int32_t sendSize;
+
+        // Sockets are non blocking the Send buffer size is equal to the buffer size. We only send
+        // if the buffer free (SEND flag) is active, so the buffer should always fit.
+        if (((m_State & SocketPort::LINK) == 0) && (m_RemoteNode.IsValid() == true)) {
+            ASSERT(m_RemoteNode.IsValid() == true);
+
+            sendSize = ::sendto(m_Socket,
+                reinterpret_cast<const char*>(&m_SendBuffer[m_SendOffset]),
+                m_SendBytes - m_SendOffset, 0,
+                static_cast<const NodeId&>(m_RemoteNode),
+                m_RemoteNode.Size());
+
+        }
+#ifndef __WINDOWS__
+        else if (m_Offered.empty() == false) {
+            // The descriptors go with the first byte of what is sent now. If there are more than fit
+            // in one send(), only send that byte, so no data can overtake a descriptor offered before it.
+            const uint8_t count = static_cast<uint8_t>(std::min(m_Offered.size(), static_cast<size_t>(MAX_DESCRIPTORS)));
+            uint8_t control[CMSG_SPACE(sizeof(int) * MAX_DESCRIPTORS)];
+            struct iovec vector;
+            struct msghdr message;
+
+            vector.iov_base = &m_SendBuffer[m_SendOffset];
+            vector.iov_len = (m_Offered.size() > MAX_DESCRIPTORS ? 1 : m_SendBytes - m_SendOffset);
+
+            ::memset(&message, 0, sizeof(message));
+            ::memset(control, 0, sizeof(control));
+            message.msg_iov = &vector;
+            message.msg_iovlen = 1;
+            message.msg_control = control;
+            message.msg_controllen = CMSG_SPACE(sizeof(int) * count);
+
+            struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+            header->cmsg_level = SOL_SOCKET;
+            header->cmsg_type = SCM_RIGHTS;
+            header->cmsg_len = CMSG_LEN(sizeof(int) * count);
+
+            int* descriptors = reinterpret_cast<int*>(CMSG_DATA(header));
+            std::list<int>::const_iterator index(m_Offered.cbegin());
+
+            for (uint8_t entry = 0; entry < count; entry++, index++) {
+                descriptors[entry] = *index;
+            }
+
+            sendSize = ::sendmsg(m_Socket, &message, MSG_NOSIGNAL);
+
+            if (sendSize >= 0) {
+                // The other side has its own copies now.
+                for (uint8_t entry = 0; entry < count; entry++) {
+                    ::close(m_Offered.front());
+                    m_Offered.pop_front();
+                }
+            }
+        }
+#endif
+        else {
+            sendSize = ::send(m_Socket,
+                reinterpret_cast<const char*>(&m_SendBuffer[m_SendOffset]),
+                m_SendBytes - m_SendOffset, 0);
+        }
+
+        if (sendSize >= 0) {
+            m_SendOffset = ((m_State & SocketPort::LINK) != 0 ? m_SendOffset + sendSize : m_SendBytes);
+        } else {
+            uint32_t l_Result = __ERRORRESULT__;
+
+            if ((l_Result == __ERROR_WOULDBLOCK__) || (l_Result == __ERROR_AGAIN__) || (l_Result == __ERROR_INPROGRESS__)) {
+                m_State |= SocketPort::WRITE;
+            } else {
+                printf("Write exception. %d\n", l_Result);
+                m_State |= SocketPort::EXCEPTION;
+                StateChange();
+            }
+        }
+    }
+
     void SocketPort::Read()
     {
         m_syncAdmin.Lock();
@@ -846,25 +997,84 @@ namespace Core {
         while ((m_State & (SocketPort::READ | SocketPort::EXCEPTION | SocketPort::OPEN)) == SocketPort::OPEN) {
             uint32_t l_Size;
 
-            if (m_ReadBytes == m_ReceiveBufferSize) {
-                m_ReadBytes = 0;
+            // The receive buffer is used as a sliding window: unconsumed data stays where it is and
+            // new data is appended behind it. Only when the window hits the end of the buffer, the
+            // leftover is moved to the front, instead of after every ReceiveData().
+            if ((m_ReadOffset + m_ReadBytes) == m_ReceiveBufferSize) {
+                if (m_ReadOffset == 0) {
+                    m_ReadBytes = 0;
+                } else {
+                    ::memmove(m_ReceiveBuffer, &m_ReceiveBuffer[m_ReadOffset], m_ReadBytes);
+                    m_ReadOffset = 0;
+                }
             }
 
+            uint8_t* writePosition = &m_ReceiveBuffer[m_ReadOffset + m_ReadBytes];
+            uint32_t writeSpace = m_ReceiveBufferSize - (m_ReadOffset + m_ReadBytes);
+
             // Read the actual data from the port.
             if (((m_State & SocketPort::LINK) == 0) && (m_LocalNode.Type() != NodeId::TYPE_NETLINK)) {
                 NodeId::SocketInfo l_Remote;
                 socklen_t l_Address = sizeof(l_Remote);
 
                 l_Size = ::recvfrom(m_Socket,
-                    reinterpret_cast<char*>(&m_ReceiveBuffer[m_ReadBytes]),
-                    m_ReceiveBufferSize - m_ReadBytes, 0, (struct sockaddr*)&l_Remote,
+                    reinterpret_cast<char*>(writePosition),
+                    writeSpace, 0, (struct sockaddr*)&l_Remote,
                     &l_Address);
 
                 m_ReceivedNode = l_Remote;
-            } else {
+            }
+#ifndef __WINDOWS__
+            else if (m_LocalNode.Type() == NodeId::TYPE_DOMAIN) {
+                // The other side might pass descriptors along, collect them with the data they came with.
+                uint8_t control[CMSG_SPACE(sizeof(int) * MAX_DESCRIPTORS)];
+                struct iovec vector;
+                struct msghdr message;
+
+                vector.iov_base = writePosition;
+                vector.iov_len = writeSpace;
+
+                ::memset(&message, 0, sizeof(message));
+                message.msg_iov = &vector;
+                message.msg_iovlen = 1;
+                message.msg_control = control;
+                message.msg_controllen = sizeof(control);
+
+                l_Size = ::recvmsg(m_Socket, &message, MSG_CMSG_CLOEXEC);
+
+                if ((l_Size != 0) && (l_Size != static_cast<uint32_t>(SOCKET_ERROR))) {
+                    // Descriptors that did not fit are lost, and with them the order of the ones that
+                    // follow, nothing to recover. Do not keep the ones that did arrive, and fail the link.
+                    const bool truncated = ((message.msg_flags & MSG_CTRUNC) != 0);
+
+                    for (struct cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header)) {
+                        if ((header->cmsg_level == SOL_SOCKET) && (header->cmsg_type == SCM_RIGHTS)) {
+                            const int* descriptors = reinterpret_cast<const int*>(CMSG_DATA(header));
+                            const uint32_t count = static_cast<uint32_t>((header->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+
+                            for (uint32_t entry = 0; entry < count; entry++) {
+                                if (truncated == true) {
+                                    ::close(descriptors[entry]);
+                                } else {
+                                    m_Received.emplace(m_ReceiveCount++, descriptors[entry]);
+                                }
+                            }
+                        }
+                    }
+
+                    if (truncated == true) {
+                        TRACE_L1("More than %d descriptors in one message, closing the link.", MAX_DESCRIPTORS);
+
+                        // Handled as if the other side closed the link, the data they came with is dropped.
+                        l_Size = 0;
+                    }
+                }
+            }
+#endif
+            else {
                 l_Size = ::recv(m_Socket,
-                    reinterpret_cast<char*>(&m_ReceiveBuffer[m_ReadBytes]),
-                    m_ReceiveBufferSize - m_ReadBytes, 0);
+                    reinterpret_cast<char*>(writePosition),
+                    writeSpace, 0);
             }
 
             if (l_Size == 0) {
@@ -888,17 +1098,16 @@ namespace Core {
                 }
             }
 
-            if (m_ReadBytes != 0) {
-                uint16_t handledBytes = ReceiveData(m_ReceiveBuffer, m_ReadBytes);
+            // Hand out what we have, as long as the handler makes progress on it.
+            uint32_t handledBytes = 1;
+
+            while ((m_ReadBytes != 0) && (handledBytes != 0)) {
+                handledBytes = ReceiveData(&m_ReceiveBuffer[m_ReadOffset], m_ReadBytes);
 
                 ASSERT(m_ReadBytes >= handledBytes);
 
                 m_ReadBytes -= handledBytes;
-
-                if ((m_ReadBytes != 0) && (handledBytes != 0)) {
-                    // Oops not all data was consumed, Lets remove the read data
-                    ::memcpy(m_ReceiveBuffer, &m_ReceiveBuffer[handledBytes], m_ReadBytes);
-                }
+                m_ReadOffset = (m_ReadBytes == 0 ? 0 : m_ReadOffset + handledBytes);
             }
         }
 
@@ -925,6 +1134,7 @@ namespace Core {
             result = false;
         } else {
             DestroySocket(m_Socket);
+            Dispose();
             // Remove socket descriptor for UNIX domain datagram socket.
             if ((m_LocalNode.Type() == NodeId::TYPE_DOMAIN) && ((m_SocketType == SocketPort::LISTEN) || (SocketMode() != SOCK_STREAM))) {
                 TRACE_L1("CLOSED: Remove socket descriptor %s", m_LocalNode.HostName().c_str());
@@ -978,6 +1188,63 @@ namespace Core {
         return (result);
     }
 
+    uint32_t SocketPort::Offer(const int descriptor)
+    {
+        uint32_t result = ~0;
+
+        ASSERT(descriptor >= 0);
+        ASSERT(((m_State & SocketPort::LINK) != 0) && (m_LocalNode.Type() == NodeId::TYPE_DOMAIN));
+
+#ifdef __WINDOWS__
+        DEBUG_VARIABLE(descriptor);
+#else
+        m_syncAdmin.Lock();
+
+        m_Offered.push_back(descriptor);
+        result = m_OfferCount++;
+
+        m_syncAdmin.Unlock();
+#endif
+
+        return (result);
+    }
+
+    int SocketPort::Claim(const uint32_t index)
+    {
+        int result = -1;
+
+        m_syncAdmin.Lock();
+
+        std::map<uint32_t, int>::iterator entry(m_Received.find(index));
+
+        if (entry != m_Received.end()) {
+            result = entry->second;
+            m_Received.erase(entry);
+        }
+
+        m_syncAdmin.Unlock();
+
+        return (result);
+    }
+
+    // Descriptors that were not sent or claimed have no meaning beyond this connection.
+    void SocketPort::Dispose()
+    {
+#ifndef __WINDOWS__
+        for (const int descriptor : m_Offered) {
+            ::close(descriptor);
+        }
+        for (const std::pair<const uint32_t, int>& entry : m_Received) {
+            ::close(entry.second);
+        }
+#endif
+
+        m_Offered.clear();
+        m_Received.clear();
+        m_OfferCount = 0;
+        m_ReceiveCount = 0;
+    }
+
     NodeId SocketPort::Accept()
     {
         NodeId newConnection;
@@ -1121,8 +1388,8 @@ namespace Core {
     SocketDatagram::SocketDatagram(const bool rawSocket,
         const NodeId& localNode,
         const NodeId& remoteNode,
-        const uint16_t sendBufferSize,
-        const uint16_t receiveBufferSize)
+        const uint32_t sendBufferSize,
+        const uint32_t receiveBufferSize)
         : SocketPort((rawSocket ? SocketPort::RAW : SocketPort::DATAGRAM), localNode, remoteNode, sendBufferSize, receiveBufferSize)
     {
     }
@@ -11,6 +11,9 @@
 #include "ResourceMonitor.h"
 #include "StateTrigger.h"
 
+#include <list>
+#include <map>
+
 #ifdef __WINDOWS__
 #include <winsock2.h>
 #pragma comment(lib, "ws2_32.lib")
@@ -49,6 +52,7 @@ namespace Core {
             LINK = 0x040,
             MONITOR = 0x080,
             WRITESLOT = 0x100,
+            LINGER = 0x200,
             UPDATE = 0x8000
 
         } enumState;
@@ -66,14 +70,14 @@ namespace Core {
         SocketPort(const enumType socketType,
             const NodeId& localNode,
             const NodeId& remoteNode,
-            const uint16_t sendBufferSize,
-            const uint16_t receiveBufferSize);
+            const uint32_t sendBufferSize,
+            const uint32_t receiveBufferSize);
 
         SocketPort(const enumType socketType,
             const SOCKET& connector,
             const NodeId& remoteNode,
-            const uint16_t sendBufferSize,
-            const uint16_t receiveBufferSize);
+            const uint32_t sendBufferSize,
+            const uint32_t receiveBufferSize);
 
         virtual ~SocketPort();
 
@@ -154,17 +158,18 @@ namespace Core {
         {
             return (m_ReceivedNode);
         }
-        inline uint16_t SendBufferSize() const
+        inline uint32_t SendBufferSize() const
         {
             return (m_SendBufferSize);
         }
-        inline uint16_t ReceiveBufferSize() const
+        inline uint32_t ReceiveBufferSize() const
         {
             return (m_ReceiveBufferSize);
         }
         inline void Flush()
         {
             m_syncAdmin.Lock();
+            m_ReadOffset = 0;
             m_ReadBytes = 0;
             m_SendBytes = 0;
             m_SendOffset = 0;
@@ -189,8 +194,34 @@ namespace Core {
         void Trigger();
 
         // Methods to extract and insert data into the socket buffers
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
+        {
+            // Only reached by a socket that implements the 16 bits variant below.
+            return (SendData(dataFrame, static_cast<uint16_t>(std::min(maxSendSize, static_cast<uint32_t>(0xFFFF)))));
+        }
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
+        {
+            // Only reached by a socket that implements the 16 bits variant below. What it does not
+            // consume, is offered again.
+            return (ReceiveData(dataFrame, static_cast<uint16_t>(std::min(receivedSize, static_cast<uint32_t>(0xFFFF)))));
+        }
+
+        // Deprecated, the interface from before the buffers could exceed 64KB. Sockets that still
+        // implement these instead of the variants above keep working, in chunks of at most 64KB.
+        virtual uint16_t SendData(uint8_t* /* dataFrame */, const uint16_t /* maxSendSize */)
+        {
+            // One of both variants has to be implemented.
+            ASSERT(false);
+
+            return (0);
+        }
+        virtual uint16_t ReceiveData(uint8_t* /* dataFrame */, const uint16_t /* receivedSize */)
+        {
+            // One of both variants has to be implemented.
+            ASSERT(false);
+
+            return (0);
+        }
 
         // Signal a state change, Opened, Closed or Accepted
         virtual void StateChange() = 0;
@@ -204,6 +235,15 @@ namespace Core {
         void Listen();
         SOCKET Accept(NodeId& remoteId);
 
+        // Only for a connected unix domain socket: hand a file descriptor to the other side, it is sent
+        // along with the data that goes out next. From here on the descriptor is owned by the socket.
+        // The descriptors are received in the order they are offered, the returned index is the index
+        // under which the other side can Claim it.
+        uint32_t Offer(const int descriptor);
+        // Returns the descriptor received under this index, the caller owns it from here on, or -1 if
+        // there is none (anymore).
+        int Claim(const uint32_t index);
+
     protected:
         virtual bool Initialize();
 
@@ -223,6 +263,10 @@ namespace Core {
         void Accepted();
         void Read();
         void Write();
+        void Gather();
+        void Linger();
+        void Transmit();
+        void Dispose();
         void BufferAlignment(SOCKET socket);
         SOCKET ConstructSocket(NodeId& localNode, const string& interfaceName);
         uint32_t WaitForOpen(const uint32_t time) const;
@@ -232,8 +276,8 @@ namespace Core {
     private:
         NodeId m_LocalNode;
         NodeId m_RemoteNode;
-        uint16_t m_ReceiveBufferSize;
-        uint16_t m_SendBufferSize;
+        uint32_t m_ReceiveBufferSize;
+        uint32_t m_SendBufferSize;
         enumType m_SocketType;
         SOCKET m_Socket;
         mutable CriticalSection m_syncAdmin;
@@ -241,9 +285,15 @@ namespace Core {
         NodeId m_ReceivedNode;
         uint8_t* m_SendBuffer;
         uint8_t* m_ReceiveBuffer;
-        uint16_t m_ReadBytes;
-        uint16_t m_SendBytes;
-        uint16_t m_SendOffset;
+        uint32_t m_ReadOffset;
+        uint32_t m_ReadBytes;
+        uint32_t m_SendBytes;
+        uint32_t m_SendOffset;
+        uint64_t m_Linger;
+        std::list<int> m_Offered;
+        uint32_t m_OfferCount;
+        std::map<uint32_t, int> m_Received;
+        uint32_t m_ReceiveCount;
     };
 
     class EXTERNAL SocketStream : public SocketPort {
@@ -256,8 +306,8 @@ namespace Core {
         SocketStream(const bool rawSocket,
             const NodeId& localNode,
             const NodeId& remoteNode,
-            const uint16_t sendBufferSize,
-            const uint16_t receiveBufferSize)
+            const uint32_t sendBufferSize,
+            const uint32_t receiveBufferSize)
             : SocketPort((rawSocket ? SocketPort::RAW : SocketPort::STREAM), localNode, remoteNode, sendBufferSize, receiveBufferSize)
         {
         }
@@ -265,8 +315,8 @@ namespace Core {
         SocketStream(const bool rawSocket,
             const SOCKET& connector,
             const NodeId& remoteNode,
-            const uint16_t sendBufferSize,
-            const uint16_t receiveBufferSize)
+            const uint32_t sendBufferSize,
+            const uint32_t receiveBufferSize)
             : SocketPort((rawSocket ? SocketPort::RAW : SocketPort::STREAM),
                   connector, remoteNode, sendBufferSize, receiveBufferSize)
         {
@@ -277,10 +327,6 @@ namespace Core {
         }
 
     public:
-        // Methods to extract and insert data into the socket buffers
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
-
         // Signal a state change, Opened, Closed or Accepted
         virtual void StateChange() = 0;
     };
@@ -295,15 +341,11 @@ namespace Core {
         SocketDatagram(const bool rawSocket,
             const NodeId& localNode,
             const NodeId& remoteNode,
-            const uint16_t sendBufferSize,
-            const uint16_t receiveBufferSize);
+            const uint32_t sendBufferSize,
+            const uint32_t receiveBufferSize);
         virtual ~SocketDatagram();
 
     public:
-        // Methods to extract and insert data into the socket buffers
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
-
         // Signal a state change, Opened, Closed or Accepted
         virtual void StateChange() = 0;
     };
@@ -336,14 +378,14 @@ namespace Core {
             {
                 SocketPort::LocalNode(localNode);
             }
-            virtual uint16_t SendData(uint8_t* /* dataFrame */, const uint16_t /* maxSendSize */)
+            virtual uint32_t SendData(uint8_t* /* dataFrame */, const uint32_t /* maxSendSize */)
             {
                 // This should not happen on this socket !!!!!
                 ASSERT(false);
 
                 return (0);
             }
-            virtual uint16_t ReceiveData(uint8_t* /* dataFrame */, const uint16_t /* receivedSize */)
+            virtual uint32_t ReceiveData(uint8_t* /* dataFrame */, const uint32_t /* receivedSize */)
             {
                 // This should not happen on this socket !!!!!
                 ASSERT(false);
@@ -46,9 +46,9 @@ namespace Core {
 
                 return (trigger);
             }
-            inline uint16_t Serialize(uint8_t* stream, const uint16_t length) const
+            inline uint32_t Serialize(uint8_t* stream, const uint32_t length) const
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 _adminLock.Lock();
 
@@ -69,10 +69,10 @@ namespace Core {
             }
 
         private:
-            inline uint16_t Serialize(const Core::ProxyType<Core::JSON::IElement>& source, uint8_t* stream, const uint16_t length) const {
+            inline uint32_t Serialize(const Core::ProxyType<Core::JSON::IElement>& source, uint8_t* stream, const uint32_t length) const {
                 return(source->Serialize(reinterpret_cast<char*>(stream), length, _offset));
             }
-            inline uint16_t Serialize(const Core::ProxyType<Core::JSON::IMessagePack>& source, uint8_t* stream, const uint16_t length) const {
+            inline uint32_t Serialize(const Core::ProxyType<Core::JSON::IMessagePack>& source, uint8_t* stream, const uint32_t length) const {
                 return(source->Serialize(stream, length, _offset));
             }
             
@@ -80,7 +80,7 @@ namespace Core {
             ParentClass& _parent;
             mutable Core::CriticalSection _adminLock;
             mutable Core::ProxyList<INTERFACE> _sendQueue;
-            mutable uint16_t _offset;
+            mutable uint32_t _offset;
         };
         class DeserializerImpl {
         public:
@@ -111,9 +111,9 @@ namespace Core {
             {
                 return (_current.IsValid() == false);
             }
-            inline uint16_t Deserialize(const uint8_t* stream, const uint16_t length)
+            inline uint32_t Deserialize(const uint8_t* stream, const uint32_t length)
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (_current.IsValid() == false) {
                     _current = Core::ProxyType<INTERFACE>(_factory.Element(EMPTY_STRING));
@@ -132,10 +132,10 @@ namespace Core {
 
 
         private:
-            inline uint16_t Deserialize(const Core::ProxyType<Core::JSON::IElement>& source, const uint8_t* stream, const uint16_t length) {
+            inline uint32_t Deserialize(const Core::ProxyType<Core::JSON::IElement>& source, const uint8_t* stream, const uint32_t length) {
                 return(source->Deserialize(reinterpret_cast<const char*>(stream), length, _offset));
             }
-            inline uint16_t Deserialize(const Core::ProxyType<Core::JSON::IMessagePack>& source, const uint8_t* stream, const uint16_t length) {
+            inline uint32_t Deserialize(const Core::ProxyType<Core::JSON::IMessagePack>& source, const uint8_t* stream, const uint32_t length) {
                 return (source->Deserialize(stream, length, _offset));
             }
 
@@ -143,7 +143,7 @@ namespace Core {
             ParentClass& _parent;
             ALLOCATOR _factory;
             Core::ProxyType<INTERFACE> _current;
-            uint16_t _offset;
+            uint32_t _offset;
         };
 
         class HandlerType : public SOURCE {
@@ -169,12 +169,12 @@ namespace Core {
 
         public:
             // Methods to extract and insert data into the socket buffers
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
             {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
 
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+            virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -266,13 +266,13 @@ namespace Core {
         {
             return ((_serializer.IsIdle() == true) && (_deserializer.IsIdle() == true));
         }
-        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
         {
             return (_serializer.Serialize(dataFrame, maxSendSize));
         }
-        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+        uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
         {
-            uint16_t handled = 0;
+            uint32_t handled = 0;
 
             do {
                 handled += _deserializer.Deserialize(&dataFrame[handled], (receivedSize - handled));
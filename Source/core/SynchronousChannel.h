@@ -89,21 +89,22 @@ namespace Core {
             {
                 return (_response);
             }
-            uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
             {
-                uint16_t result = _message.Serialize(dataFrame, maxSendSize);
+                const uint16_t length = static_cast<uint16_t>(maxSendSize > 0xFFFF ? 0xFFFF : maxSendSize);
+                uint32_t result = _message.Serialize(dataFrame, length);
 
-                if (result < maxSendSize) {
+                if (result < length) {
                     _state = (_response == nullptr ? COMPLETE : INBOUND);
                 }
                 return (result);
             }
-            uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t availableData)
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t availableData)
             {
-                uint16_t result = 0;
+                uint32_t result = 0;
 
                 if (_response != nullptr) {
-                    result = _response->Deserialize(dataFrame, availableData);
+                    result = _response->Deserialize(dataFrame, static_cast<uint16_t>(availableData > 0xFFFF ? 0xFFFF : availableData));
                     IInbound::state newState = _response->IsCompleted();
                     if (newState == IInbound::COMPLETED) {
                         _state = COMPLETE;
@@ -317,9 +318,9 @@ namespace Core {
         }
 
         // Methods to extract and insert data into the socket buffers
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
         {
-            uint16_t result = 0;
+            uint32_t result = 0;
 
             _adminLock.Lock();
 
@@ -347,9 +348,9 @@ namespace Core {
 
             return (result);
         }
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t availableData) override
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t availableData) override
         {
-            uint16_t result = 0;
+            uint32_t result = 0;
 
             _adminLock.Lock();
 
@@ -380,7 +381,8 @@ namespace Core {
             _adminLock.Unlock();
 
             if (result < availableData) {
-                result += Deserialize(&(dataFrame[result]), availableData - result);
+                const uint32_t remaining = availableData - result;
+                result += Deserialize(&(dataFrame[result]), static_cast<uint16_t>(remaining > 0xFFFF ? 0xFFFF : remaining));
             }
 
             return (result);
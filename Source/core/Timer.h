@@ -357,6 +357,446 @@ namespace Core {
         uint64_t m_NextTrigger;
     };
 
+    // Hierarchical timing wheel, an alternative engine for the TimerType when thousands of timers
+    // are armed and revoked. Schedule and Revoke are O(1), where the TimerType walks its sorted list.
+    // Next to Timed() and operator==, the CONTENT must offer a Key() returning a pointer that
+    // identifies it (typically the object it wraps), so a Revoke does not have to walk the wheel.
+    // The resolution is 1 ms, an entry never fires early but it might fire up to 1 ms late.
+    template <typename CONTENT>
+    class TimerWheelType {
+    private:
+        TimerWheelType(const TimerWheelType&) = delete;
+        TimerWheelType& operator=(const TimerWheelType&) = delete;
+
+        static constexpr uint8_t SlotBits = 6;
+        static constexpr uint32_t Slots = (1 << SlotBits);
+        static constexpr uint8_t Levels = 4;
+
+        struct Link {
+            Link* next;
+            Link* previous;
+        };
+        struct Entry : public Link {
+            Entry(const uint64_t time, CONTENT&& info)
+                : scheduleTime(time)
+                , level(0)
+                , slot(0)
+                , content(std::move(info))
+            {
+            }
+
+            uint64_t scheduleTime;
+            uint8_t level;
+            uint8_t slot;
+            CONTENT content;
+        };
+
+        class TimeWorker : public Thread {
+        public:
+            TimeWorker() = delete;
+            TimeWorker(const TimeWorker&) = delete;
+            TimeWorker& operator=(const TimeWorker&) = delete;
+
+            inline TimeWorker(TimerWheelType& parent, const uint32_t stackSize, const TCHAR* timerName)
+                : Thread(stackSize, timerName)
+                , _parent(parent)
+            {
+            }
+            inline ~TimeWorker()
+            {
+            }
+
+            virtual uint32_t Worker()
+            {
+                return (_parent.Process());
+            }
+
+        private:
+            TimerWheelType<CONTENT>& _parent;
+        };
+
+        typedef std::unordered_multimap<const void*, Entry*> Index;
+
+    public:
+        TimerWheelType(const uint32_t stackSize, const TCHAR* timerName)
+            : _timerThread(*this, stackSize, timerName)
+            , _adminLock()
+            , _index()
+            , _overflow()
+            , _current(Time::Now().Ticks() / Time::TicksPerMillisecond)
+            , _nextTrigger(NUMBER_MAX_UNSIGNED(uint64_t))
+        {
+            for (uint8_t level = 0; level < Levels; level++) {
+                for (uint32_t slot = 0; slot < Slots; slot++) {
+                    Clear(_wheel[level][slot]);
+                }
+                _occupied[level] = 0;
+            }
+            Clear(_overflow);
+
+            // Everything is initialized, go...
+            _timerThread.Block();
+        }
+        ~TimerWheelType()
+        {
+            _adminLock.Lock();
+
+            _timerThread.Stop();
+
+            // Force kill on all pending stuff...
+            for (typename Index::value_type& element : _index) {
+                delete element.second;
+            }
+            _index.clear();
+
+            _adminLock.Unlock();
+
+            _timerThread.Wait(Thread::BLOCKED | Thread::STOPPED, Core::infinite);
+        }
+
+        inline void Schedule(const Time& time, CONTENT&& info)
+        {
+            Schedule(time.Ticks(), std::move(info));
+        }
+
+        inline void Schedule(const Time& time, const CONTENT& info)
+        {
+            Schedule(time.Ticks(), info);
+        }
+
+        inline void Schedule(const uint64_t& time, const CONTENT& info)
+        {
+            Schedule(time, CONTENT(info));
+        }
+
+        void Schedule(const uint64_t& time, CONTENT&& info)
+        {
+            Entry* entry = new Entry(time, std::move(info));
+
+            _adminLock.Lock();
+
+            if (Add(entry) == true) {
+                // If we added the new time up front, retrigger the scheduler.
+                _timerThread.Run();
+            }
+
+            _adminLock.Unlock();
+        }
+
+        void Trigger(const uint64_t& time, const CONTENT& info)
+        {
+            Entry* entry = new Entry(time, CONTENT(info));
+
+            _adminLock.Lock();
+
+            Drop(info);
+
+            if (Add(entry) == true) {
+                _timerThread.Run();
+            }
+
+            _adminLock.Unlock();
+        }
+
+        bool Revoke(const CONTENT& info)
+        {
+            _adminLock.Lock();
+
+            // Since we have the admin lock, we are pretty sure that there is not any
+            // context running, so we can be pretty sure that if it was scheduled, it
+            // is gone !!!
+            bool foundElement = Drop(info);
+
+            if (foundElement == true) {
+                _timerThread.Run();
+            }
+
+            _adminLock.Unlock();
+
+            return (foundElement);
+        }
+
+        uint64_t NextTrigger() const
+        {
+            return (_nextTrigger);
+        }
+
+        uint32_t Pending() const
+        {
+            return (static_cast<uint32_t>(_index.size()));
+        }
+
+        ::ThreadId ThreadId() const
+        {
+            return (_timerThread.Id());
+        }
+
+    protected:
+        uint32_t Process()
+        {
+            uint32_t delayTime = Core::infinite;
+            uint64_t now = Time::Now().Ticks();
+            uint64_t target = now / Time::TicksPerMillisecond;
+            uint64_t stop;
+
+            _adminLock.Lock();
+
+            // Move to a blocked delay state. We would like to have some delay afterwards..
+            // Ranging from 0-Core::infinite
+            _timerThread.Block();
+
+            while ((stop = NextStop()) <= target) {
+                _current = stop;
+
+                Cascade();
+
+                Link& slot(_wheel[0][_current & (Slots - 1)]);
+
+                while (IsEmpty(slot) == false) {
+                    Entry* entry = static_cast<Entry*>(slot.next);
+
+                    // Make sure we loose the current one before we do the call, that one might add ;-)
+                    Remove(entry);
+
+                    _adminLock.Unlock();
+
+                    uint64_t reschedule = entry->content.Timed(entry->scheduleTime);
+
+                    _adminLock.Lock();
+
+                    if (reschedule != 0) {
+                        ASSERT(reschedule > now);
+
+                        entry->scheduleTime = reschedule;
+                        Add(entry);
+                    } else {
+                        delete entry;
+                    }
+                }
+
+                _current++;
+            }
+
+            // Nothing to do up to the next stop, so there is nothing to move or fire before it either.
+            if (_current <= target) {
+                _current = target + 1;
+                stop = NextStop();
+            }
+
+            // Calculate the delay...
+            if (stop == NUMBER_MAX_UNSIGNED(uint64_t)) {
+                _nextTrigger = NUMBER_MAX_UNSIGNED(uint64_t);
+            } else {
+                // Refresh the time, just to be on the safe side...
+                uint64_t delta = Time::Now().Ticks();
+                uint64_t next = stop * Time::TicksPerMillisecond;
+
+                if (delta >= next) {
+                    _nextTrigger = delta;
+                    delayTime = 0;
+                } else {
+                    _nextTrigger = next;
+                    delayTime = static_cast<uint32_t>((next - delta + Time::TicksPerMillisecond - 1) / Time::TicksPerMillisecond);
+                }
+            }
+
+            _adminLock.Unlock();
+
+            return (delayTime);
+        }
+
+    private:
+        static inline void Clear(Link& list)
+        {
+            list.next = &list;
+            list.previous = &list;
+        }
+        static inline bool IsEmpty(const Link& list)
+        {
+            return (list.next == &list);
+        }
+        static inline void Append(Link& list, Link* element)
+        {
+            element->next = &list;
+            element->previous = list.previous;
+            list.previous->next = element;
+            list.previous = element;
+        }
+        static inline void Unlink(Link* element)
+        {
+            element->previous->next = element->next;
+            element->next->previous = element->previous;
+        }
+        static inline uint8_t LowestBit(const uint64_t value)
+        {
+#ifdef __WINDOWS__
+            unsigned long index;
+            _BitScanForward64(&index, value);
+            return (static_cast<uint8_t>(index));
+#else
+            return (static_cast<uint8_t>(__builtin_ctzll(value)));
+#endif
+        }
+        static inline const void* Key(const CONTENT& info)
+        {
+            return (static_cast<const void*>(info.Key()));
+        }
+
+        bool Add(Entry* entry)
+        {
+            bool reevaluate = (entry->scheduleTime < _nextTrigger);
+
+            _index.emplace(Key(entry->content), entry);
+
+            Insert(entry);
+
+            if (reevaluate == true) {
+                _nextTrigger = entry->scheduleTime;
+            }
+
+            return (reevaluate);
+        }
+        void Remove(Entry* entry)
+        {
+            std::pair<typename Index::iterator, typename Index::iterator> range(_index.equal_range(Key(entry->content)));
+
+            while ((range.first != range.second) && (range.first->second != entry)) {
+                ++(range.first);
+            }
+
+            ASSERT(range.first != range.second);
+
+            _index.erase(range.first);
+
+            Detach(entry);
+        }
+        bool Drop(const CONTENT& info)
+        {
+            bool found = false;
+            std::pair<typename Index::iterator, typename Index::iterator> range(_index.equal_range(Key(info)));
+
+            while (range.first != range.second) {
+                Entry* entry = range.first->second;
+
+                if (entry->content == info) {
+                    Detach(entry);
+                    delete entry;
+                    range.first = _index.erase(range.first);
+                    found = true;
+                } else {
+                    ++(range.first);
+                }
+            }
+
+            return (found);
+        }
+        // An entry sits on the lowest level where all bits above that level match the current
+        // tick, so a level only has to be revisited (cascaded) when the current tick wraps into it.
+        void Insert(Entry* entry)
+        {
+            uint64_t tick = (entry->scheduleTime + Time::TicksPerMillisecond - 1) / Time::TicksPerMillisecond;
+
+            if (tick < _current) {
+                // Overdue, it will be fired in the first slot that is processed.
+                tick = _current;
+            }
+
+            uint64_t distance = tick ^ _current;
+            uint8_t level = 0;
+
+            while ((level < Levels) && ((distance >> (SlotBits * (level + 1))) != 0)) {
+                level++;
+            }
+
+            entry->level = level;
+
+            if (level == Levels) {
+                Append(_overflow, entry);
+            } else {
+                entry->slot = static_cast<uint8_t>((tick >> (SlotBits * level)) & (Slots - 1));
+                Append(_wheel[level][entry->slot], entry);
+                _occupied[level] |= (1ULL << entry->slot);
+            }
+        }
+        void Detach(Entry* entry)
+        {
+            Unlink(entry);
+
+            if ((entry->level < Levels) && (IsEmpty(_wheel[entry->level][entry->slot]) == true)) {
+                _occupied[entry->level] &= ~(1ULL << entry->slot);
+            }
+        }
+        // Redistribute the slots of the higher levels the current tick just wrapped into.
+        void Cascade()
+        {
+            uint8_t level = Levels;
+
+            while (level > 0) {
+                uint8_t shift = SlotBits * level;
+
+                if ((_current & ((1ULL << shift) - 1)) == 0) {
+                    Link pending;
+                    Link& source(level == Levels ? _overflow : _wheel[level][(_current >> shift) & (Slots - 1)]);
+
+                    if (IsEmpty(source) == false) {
+                        pending.next = source.next;
+                        pending.previous = source.previous;
+                        pending.next->previous = &pending;
+                        pending.previous->next = &pending;
+                        Clear(source);
+
+                        if (level < Levels) {
+                            _occupied[level] &= ~(1ULL << ((_current >> shift) & (Slots - 1)));
+                        }
+
+                        while (IsEmpty(pending) == false) {
+                            Entry* entry = static_cast<Entry*>(pending.next);
+                            Unlink(entry);
+                            Insert(entry);
+                        }
+                    }
+                }
+                level--;
+            }
+        }
+        // The first tick at which a slot needs to be fired or cascaded.
+        uint64_t NextStop() const
+        {
+            uint64_t result = NUMBER_MAX_UNSIGNED(uint64_t);
+
+            for (uint8_t level = 0; level < Levels; level++) {
+                uint8_t shift = SlotBits * level;
+                uint8_t index = static_cast<uint8_t>((_current >> shift) & (Slots - 1));
+                uint64_t pending = (_occupied[level] >> index);
+
+                if (pending != 0) {
+                    uint64_t base = (_current >> (shift + SlotBits)) << (shift + SlotBits);
+                    uint64_t stop = base + (static_cast<uint64_t>(index + LowestBit(pending)) << shift);
+
+                    if (stop < result) {
+                        result = (stop < _current ? _current : stop);
+                    }
+                }
+            }
+
+            if ((result == NUMBER_MAX_UNSIGNED(uint64_t)) && (IsEmpty(_overflow) == false)) {
+                result = ((_current >> (SlotBits * Levels)) + 1) << (SlotBits * Levels);
+            }
+
+            return (result);
+        }
+
+    private:
+        TimeWorker _timerThread;
+        CriticalSection _adminLock;
+        Index _index;
+        Link _wheel[Levels][Slots];
+        Link _overflow;
+        uint64_t _occupied[Levels];
+        uint64_t _current;
+        uint64_t _nextTrigger;
+    };
+
     template <typename HANDLER>
     class WatchDogType : public Thread {
     public:
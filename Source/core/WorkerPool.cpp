@@ -6,12 +6,32 @@ namespace WPEFramework {
 
 	    /* static */ WorkerPool* WorkerPool::_instance = nullptr;
 
+		static uint16_t Cores()
+		{
+#ifdef __WINDOWS__
+			SYSTEM_INFO systemInfo;
+			::GetSystemInfo(&systemInfo);
+			return (static_cast<uint16_t>(systemInfo.dwNumberOfProcessors));
+#else
+			long online = ::sysconf(_SC_NPROCESSORS_ONLN);
+			return (static_cast<uint16_t>(online > 0 ? online : 1));
+#endif
+		}
+
 		WorkerPool::WorkerPool(const uint8_t threadCount, uint32_t* counters)
-			: _handleQueue(16)
+			: _queues(new LocalQueue[threadCount])
+			, _jobs()
+			, _signal(0, static_cast<unsigned int>(~0))
+			, _enabled(true)
+			, _pending(0)
+			, _sleeping(0)
+			, _next(0)
+			, _shared((threadCount == 1) || (Cores() == 1))
 			, _occupation(0)
 			, _timer(1024 * 1024, _T("WorkerPool::Timer"))
 		{
 			ASSERT(_instance == nullptr);
+			ASSERT(threadCount > 0);
 
 			_metadata.Slots = threadCount;
 			_metadata.Slot = counters;
@@ -20,8 +40,124 @@ namespace WPEFramework {
 
 		WorkerPool ::~WorkerPool()
 		{
-			_handleQueue.Disable();
+			Disable();
 			_instance = nullptr;
+
+			for (uint8_t index = 0; index < _metadata.Slots; index++) {
+				_queues[index].Clear();
+			}
+
+			delete[] _queues;
+		}
+
+		void WorkerPool::Submit(const Core::ProxyType<Core::IDispatch>& job)
+		{
+			Job entry(job);
+
+			// Count it before it can be picked up, the decrement after the Pop should never go below zero.
+			_pending++;
+
+			if (_shared == true) {
+				_queues[0].Push(entry);
+			} else {
+				uint8_t index = Queue();
+
+				// Register it before it can be picked up, the Remove after the Pop should always find it.
+				_jobs.Add(entry, index);
+				_queues[index].Push(entry);
+			}
+
+			// Only wake up a thread if there is one sleeping, busy pools do not touch the semaphore.
+			if (_sleeping.load() != 0) {
+				_signal.Unlock();
+			}
+		}
+
+		uint32_t WorkerPool::Revoke(const Core::ProxyType<Core::IDispatch>& job, const uint32_t /* waitTime */)
+		{
+			Job compare(job);
+			bool removed = _timer.Revoke(compare);
+			uint8_t index;
+
+			if ((removed == false) && (_shared == true)) {
+
+				if (_queues[0].Remove(compare) == true) {
+					_pending--;
+					removed = true;
+				}
+			} else if ((removed == false) && (_jobs.Find(compare, index) == true)) {
+
+				// Most likely it is still on the queue it was submitted to, if it got stolen it is running already.
+				removed = _queues[index].Remove(compare);
+
+				for (uint8_t count = 0; (removed == false) && (count < _metadata.Slots); count++) {
+					removed = (count != index) && (_queues[count].Remove(compare) == true);
+				}
+
+				if (removed == true) {
+					_jobs.Remove(compare);
+					_pending--;
+				}
+			}
+
+			return (removed == true ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
+		}
+
+		void WorkerPool::Disable()
+		{
+			_enabled = false;
+
+			// Wake up everyone that is waiting for work, so they can see we are disabled.
+			_signal.Unlock(_metadata.Slots);
+		}
+
+		uint8_t WorkerPool::Queue()
+		{
+			::ThreadId id = Core::Thread::ThreadId();
+
+			for (uint8_t index = 0; index < _metadata.Slots; index++) {
+				if (_queues[index].Id() == id) {
+					return (index);
+				}
+			}
+
+			return (_next++ % _metadata.Slots);
+		}
+
+		bool WorkerPool::Next(const uint8_t index, Job& job)
+		{
+			bool found = false;
+
+			while ((found == false) && (_enabled == true)) {
+
+				if (_shared == true) {
+					found = _queues[0].Pop(job);
+				} else {
+					// Our own queue first, than steal from the others..
+					for (uint8_t count = 0; (found == false) && (count < _metadata.Slots); count++) {
+						found = _queues[(index + count) % _metadata.Slots].Pop(job);
+					}
+				}
+
+				if (found == true) {
+					if (_shared == false) {
+						_jobs.Remove(job);
+					}
+					_pending--;
+				} else {
+					// Announce we are going to sleep before the final check, the Submit checks in the
+					// opposite order, so either we see the new job, or it sees us sleeping.
+					_sleeping++;
+
+					if ((_pending.load() == 0) && (_enabled == true)) {
+						_signal.Lock();
+					}
+
+					_sleeping--;
+				}
+			}
+
+			return (found);
 		}
 	}
 }
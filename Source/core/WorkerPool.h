@@ -3,6 +3,7 @@
 #include "Thread.h"
 #include "Timer.h"
 #include <atomic>
+#include <deque>
 #include <functional>
 
 namespace WPEFramework {
@@ -48,6 +49,10 @@ namespace Core {
             {
                 return (!operator==(RHS));
             }
+            inline const IReferenceCounted* Key() const
+            {
+                return (static_cast<IReferenceCounted*>(_job));
+            }
             uint64_t Timed(const uint64_t /* scheduledTime */)
             {
                WorkerPool::Instance().Submit(_job);
@@ -155,7 +160,155 @@ namespace Core {
             uint8_t _index;
         };
 
-        typedef Core::QueueType<Job> MessageQueue;
+        // Every thread in the pool owns a queue, slot 0 belongs to the thread that Join()s. Jobs submitted
+        // from a pool thread stay on its own queue, others are spread round robin. Idle threads steal.
+        class LocalQueue {
+        private:
+            LocalQueue(const LocalQueue&) = delete;
+            LocalQueue& operator=(const LocalQueue&) = delete;
+
+        public:
+            LocalQueue()
+                : _lock()
+                , _jobs()
+                , _id(0)
+            {
+            }
+            ~LocalQueue()
+            {
+            }
+
+        public:
+            inline ::ThreadId Id() const
+            {
+                return (_id);
+            }
+            inline void Id(const ::ThreadId id)
+            {
+                _id = id;
+            }
+            inline void Push(const Job& job)
+            {
+                _lock.Lock();
+                _jobs.push_back(job);
+                _lock.Unlock();
+            }
+            inline bool Pop(Job& job)
+            {
+                bool result = false;
+
+                _lock.Lock();
+                if (_jobs.empty() == false) {
+                    job = _jobs.front();
+                    _jobs.pop_front();
+                    result = true;
+                }
+                _lock.Unlock();
+
+                return (result);
+            }
+            inline bool Remove(const Job& job)
+            {
+                bool result = false;
+
+                _lock.Lock();
+                std::deque<Job>::iterator index(std::find(_jobs.begin(), _jobs.end(), job));
+                if (index != _jobs.end()) {
+                    _jobs.erase(index);
+                    result = true;
+                }
+                _lock.Unlock();
+
+                return (result);
+            }
+            inline void Clear()
+            {
+                _lock.Lock();
+                _jobs.clear();
+                _lock.Unlock();
+            }
+
+        private:
+            Core::CriticalSection _lock;
+            std::deque<Job> _jobs;
+            ::ThreadId _id;
+        };
+
+        // Keeps track of the queue a job was submitted to, so a Revoke of a job that is not
+        // pending, which is the common case, does not have to look into any queue.
+        class PendingMap {
+        private:
+            static constexpr uint8_t Buckets = 16;
+
+            struct Entry {
+                uint32_t count;
+                uint8_t queue;
+            };
+
+            struct Bucket {
+                Core::CriticalSection lock;
+                std::unordered_map<const IReferenceCounted*, Entry> jobs;
+            };
+
+            PendingMap(const PendingMap&) = delete;
+            PendingMap& operator=(const PendingMap&) = delete;
+
+        public:
+            PendingMap()
+            {
+            }
+            ~PendingMap()
+            {
+            }
+
+        public:
+            void Add(const Job& job, const uint8_t queue)
+            {
+                Bucket& bucket(Select(job));
+
+                bucket.lock.Lock();
+                Entry& entry(bucket.jobs[job.Key()]);
+                entry.count++;
+                entry.queue = queue;
+                bucket.lock.Unlock();
+            }
+            void Remove(const Job& job)
+            {
+                Bucket& bucket(Select(job));
+
+                bucket.lock.Lock();
+                std::unordered_map<const IReferenceCounted*, Entry>::iterator index(bucket.jobs.find(job.Key()));
+                if (index != bucket.jobs.end()) {
+                    if (--(index->second.count) == 0) {
+                        bucket.jobs.erase(index);
+                    }
+                }
+                bucket.lock.Unlock();
+            }
+            bool Find(const Job& job, uint8_t& queue)
+            {
+                Bucket& bucket(Select(job));
+
+                bucket.lock.Lock();
+                std::unordered_map<const IReferenceCounted*, Entry>::const_iterator index(bucket.jobs.find(job.Key()));
+                bool result = (index != bucket.jobs.end());
+                if (result == true) {
+                    queue = index->second.queue;
+                }
+                bucket.lock.Unlock();
+
+                return (result);
+            }
+
+        private:
+            inline Bucket& Select(const Job& job)
+            {
+                return (_buckets[(reinterpret_cast<uintptr_t>(job.Key()) >> 4) % Buckets]);
+            }
+
+        private:
+            Bucket _buckets[Buckets];
+        };
 
     public:
         struct Metadata {
@@ -176,23 +329,17 @@ namespace Core {
         ~WorkerPool();
 
     public:
-        inline void Submit(const Core::ProxyType<Core::IDispatch>& job)
-        {
-            _handleQueue.Insert(Job(job), Core::infinite);
-        }
+        void Submit(const Core::ProxyType<Core::IDispatch>& job);
+        uint32_t Revoke(const Core::ProxyType<Core::IDispatch>& job, const uint32_t waitTime = Core::infinite);
+
         inline void Schedule(const Core::Time& time, const Core::ProxyType<Core::IDispatch>& job)
         {
             _timer.Schedule(time, Job(job));
         }
-        inline uint32_t Revoke(const Core::ProxyType<Core::IDispatch>& job, const uint32_t waitTime = Core::infinite)
-        {
-            Job compare(job);
-            return (_timer.Revoke(compare) == true || _handleQueue.Remove(compare) ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
-        }
         inline const WorkerPool::Metadata& Snapshot()
         {
             _metadata.Occupation = _occupation.load();
-            _metadata.Pending = _handleQueue.Length();
+            _metadata.Pending = _pending.load();
             return (_metadata);
         }
 	void Join() {
@@ -200,7 +347,7 @@ namespace Core {
 	}
         void Run()
         {
-            _handleQueue.Enable();
+            _enabled = true;
             for (uint8_t index = 1; index < _metadata.Slots; index++) {
                 Minion& minion = Index(index);
                 minion.Set(*this, index);
@@ -209,7 +356,7 @@ namespace Core {
         }
         void Stop()
         {
-            _handleQueue.Disable();
+            Disable();
             for (uint8_t index = 1; index < _metadata.Slots; index++) {
                 Minion& minion = Index(index);
                 minion.Block();
@@ -243,7 +390,9 @@ namespace Core {
         {
             Job newRequest;
 
-            while ((Running() == true) && (_handleQueue.Extract(newRequest, Core::infinite) == true)) {
+            _queues[index].Id(Core::Thread::ThreadId());
+
+            while ((Running() == true) && (Next(index, newRequest) == true)) {
 
                 _metadata.Slot[index]++;
 
@@ -256,9 +405,22 @@ namespace Core {
         }
 
     private:
-        MessageQueue _handleQueue;
+        void Disable();
+        bool Next(const uint8_t index, Job& job);
+        uint8_t Queue();
+
+    private:
+        LocalQueue* _queues;
+        PendingMap _jobs;
+        Core::CountingSemaphore _signal;
+        std::atomic<bool> _enabled;
+        std::atomic<uint32_t> _pending;
+        std::atomic<uint8_t> _sleeping;
+        std::atomic<uint8_t> _next;
+        // With one thread, or one core, to run them, spreading jobs only adds bookkeeping: all go to queue 0.
+        const bool _shared;
         std::atomic<uint8_t> _occupation;
-        Core::TimerType<Job> _timer;
+        Core::TimerWheelType<Job> _timer;
         Metadata _metadata;
         static WorkerPool* _instance;
     };
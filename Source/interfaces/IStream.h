@@ -88,7 +88,10 @@ namespace Exchange {
 
                 virtual ~ICallback() {}
 
+                // The player does not wait for these to be handled, both are one-way so they stay in order.
+                // @oneway
                 virtual void Event(const uint32_t eventid) = 0;
+                // @oneway
                 virtual void TimeUpdate(const uint64_t position) = 0;
             };
 
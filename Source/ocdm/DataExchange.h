@@ -12,6 +12,8 @@ namespace OCDM {
 
 class DataExchange : public WPEFramework::Core::SharedBuffer {
 private:
+    friend class DataExchangeRing;
+
     DataExchange() = delete;
     DataExchange(const DataExchange&) = delete;
     DataExchange& operator=(const DataExchange&) = delete;
@@ -129,6 +131,135 @@ public:
     }
 };
 
+// The same exchange, with a number of samples in flight. The buffer of every slot holds a sample,
+// the administration of the slot what is needed to decrypt it. The OCDM side creates the ring, next
+// to its DataExchange, and reports its name through OCDM::ISessionRing; the client never goes looking
+// for one.
+class DataExchangeRing : public WPEFramework::Core::SharedBufferRing {
+private:
+    DataExchangeRing() = delete;
+    DataExchangeRing(const DataExchangeRing&) = delete;
+    DataExchangeRing& operator=(const DataExchangeRing&) = delete;
+
+    typedef DataExchange::Administration Administration;
+
+public:
+    DataExchangeRing(const string& name)
+        : WPEFramework::Core::SharedBufferRing(name.c_str())
+    {
+    }
+    DataExchangeRing(const string& name, const uint8_t slots, const uint32_t slotSize)
+        : WPEFramework::Core::SharedBufferRing(name.c_str(),
+              WPEFramework::Core::File::USER_READ    |
+              WPEFramework::Core::File::USER_WRITE   |
+              WPEFramework::Core::File::USER_EXECUTE |
+              WPEFramework::Core::File::GROUP_READ   |
+              WPEFramework::Core::File::GROUP_WRITE  |
+              WPEFramework::Core::File::OTHERS_READ  |
+              WPEFramework::Core::File::OTHERS_WRITE,
+              slots,
+              slotSize,
+              sizeof(Administration))
+    {
+    }
+    ~DataExchangeRing() {}
+
+public:
+    inline void Status(const uint8_t slot, uint32_t status)
+    {
+        Admin(slot)->Status = status;
+    }
+    inline uint32_t Status(const uint8_t slot) const
+    {
+        return (Admin(slot)->Status);
+    }
+    inline void InitWithLast15(const uint8_t slot, bool initWithLast15)
+    {
+        Admin(slot)->InitWithLast15 = initWithLast15;
+    }
+    inline bool InitWithLast15(const uint8_t slot) const
+    {
+        return (Admin(slot)->InitWithLast15);
+    }
+    void SetIV(const uint8_t slot, const uint8_t ivDataLength, const uint8_t ivData[])
+    {
+        Administration* admin = Admin(slot);
+        ASSERT(ivDataLength <= sizeof(Administration::IV));
+        admin->IVLength = (ivDataLength > sizeof(Administration::IV) ? sizeof(Administration::IV)
+                                                                     : ivDataLength);
+        ::memcpy(admin->IV, ivData, admin->IVLength);
+        if (admin->IVLength < sizeof(Administration::IV)) {
+            ::memset(&(admin->IV[admin->IVLength]), 0,
+                (sizeof(Administration::IV) - admin->IVLength));
+        }
+    }
+    void SetSubSampleData(const uint8_t slot, const uint16_t length, const uint8_t* data)
+    {
+        Administration* admin = Admin(slot);
+        admin->SubLength = (length > sizeof(Administration::Sub) ? sizeof(Administration::Sub)
+                                                                 : length);
+        if (data != nullptr) {
+            ::memcpy(admin->Sub, data, admin->SubLength);
+        }
+    }
+    const uint8_t* SubSampleData(const uint8_t slot, uint16_t& length) const
+    {
+        const Administration* admin = Admin(slot);
+        length = admin->SubLength;
+        return (admin->Sub);
+    }
+    // Slots do not grow, a sample that does not fit is not written.
+    bool Write(const uint8_t slot, const uint32_t length, const uint8_t* data)
+    {
+        bool result = (length <= SlotSize());
+
+        if (result == true) {
+            ::memcpy(Buffer(slot), data, length);
+            BytesWritten(slot, length);
+        }
+
+        return (result);
+    }
+    void Read(const uint8_t slot, const uint32_t length, uint8_t* data) const
+    {
+        ::memcpy(data, Buffer(slot), std::min(length, BytesWritten(slot)));
+    }
+    const uint8_t* IVKey(const uint8_t slot) const
+    {
+        return (Admin(slot)->IV);
+    }
+    uint8_t IVKeyLength(const uint8_t slot) const
+    {
+        return (Admin(slot)->IVLength);
+    }
+    void KeyId(const uint8_t slot, const uint8_t length, const uint8_t buffer[])
+    {
+        Administration* admin = Admin(slot);
+        ASSERT(length <= 16);
+        admin->KeyId[0] = (length <= 16 ? length : 16);
+        if (length != 0) {
+            ::memcpy(&(admin->KeyId[1]), buffer, admin->KeyId[0]);
+        }
+    }
+    const uint8_t* KeyId(const uint8_t slot, uint8_t& length) const
+    {
+        const Administration* admin = Admin(slot);
+        length = admin->KeyId[0];
+        ASSERT(length <= 16);
+        return (length > 0 ? &admin->KeyId[1] : nullptr);
+    }
+
+private:
+    inline Administration* Admin(const uint8_t slot)
+    {
+        return (reinterpret_cast<Administration*>(AdministrationBuffer(slot)));
+    }
+    inline const Administration* Admin(const uint8_t slot) const
+    {
+        return (reinterpret_cast<const Administration*>(AdministrationBuffer(slot)));
+    }
+};
+
 } // namespace OCDM
 
 #endif // __DATAEXCHANGE_H
@@ -139,6 +139,18 @@ struct ISessionExt : virtual public WPEFramework::Core::IUnknown {
     virtual OCDM_RESULT CleanDecryptContext() = 0;
 };
 
+// Offered by a session that, next to the buffer reported by BufferId, created a DataExchangeRing
+// with the (name, slots, slotSize) constructor and consumes its slots. Samples that do not fit in
+// a slot keep going through the buffer reported by BufferId, so both must be served.
+struct ISessionRing : virtual public WPEFramework::Core::IUnknown {
+    enum { ID = WPEFramework::RPC::ID_SESSION_RING };
+
+    virtual ~ISessionRing() {}
+
+    // Report the name of the DataExchangeRing, empty if this session did not create one.
+    virtual std::string RingId() const = 0;
+};
+
 struct IAccessorOCDM : virtual public WPEFramework::Core::IUnknown {
 
     enum { ID = WPEFramework::RPC::ID_ACCESSOROCDM };
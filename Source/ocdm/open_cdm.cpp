@@ -463,6 +463,61 @@ OpenCDMError opencdm_session_decrypt(struct OpenCDMSession* session,
     return (result);
 }
 
+/**
+ * \brief Hands data over for decryption, without waiting for it to be decrypted.
+ * \param session \ref OpenCDMSession instance.
+ * \param encrypted Buffer containing encrypted data, decrypted once the ticket
+ * is completed.
+ * \param encryptedLength Length of encrypted data buffer (in bytes).
+ * \param IV Initial vector (IV) used during decryption.
+ * \param IVLength Length of IV buffer (in bytes).
+ * \param keyID keyID to use for decryption
+ * \param keyIDLength Length of keyID buffer (in bytes).
+ * \param initWithLast15 Whether decryption context needs to be initialized with
+ * last 15 bytes.
+ * \param ticket Receives the ticket to complete the decryption with.
+ * \return Zero on success, non-zero on error.
+ */
+OpenCDMError opencdm_session_decrypt_submit(struct OpenCDMSession* session,
+    uint8_t encrypted[],
+    const uint32_t encryptedLength,
+    const uint8_t* IV, const uint16_t IVLength,
+    const uint8_t* keyId, const uint16_t keyIdLength,
+    uint32_t initWithLast15,
+    uint32_t* ticket)
+{
+    OpenCDMError result(ERROR_INVALID_SESSION);
+
+    if (ticket == nullptr) {
+        result = ERROR_INVALID_ARG;
+    } else if (session != nullptr) {
+        result = static_cast<OpenCDMError>(session->Submit(
+            encrypted, encryptedLength, IV, IVLength, keyId, keyIdLength, initWithLast15, *ticket));
+    }
+
+    return (result);
+}
+
+/**
+ * \brief Waits for data handed over with \ref opencdm_session_decrypt_submit to
+ * be decrypted.
+ * \param session \ref OpenCDMSession instance.
+ * \param ticket Ticket returned by \ref opencdm_session_decrypt_submit.
+ * \return Zero on success, ERROR_INVALID_ARG for a ticket that was not handed
+ * out or is completed already, non-zero on error.
+ */
+OpenCDMError opencdm_session_decrypt_complete(struct OpenCDMSession* session,
+    const uint32_t ticket)
+{
+    OpenCDMError result(ERROR_INVALID_SESSION);
+
+    if (session != nullptr) {
+        result = static_cast<OpenCDMError>(session->Complete(ticket));
+    }
+
+    return (result);
+}
+
 
 bool OpenCDMAccessor::WaitForKey(const uint8_t keyLength, const uint8_t keyId[],
         const uint32_t waitTime,
@@ -484,6 +484,49 @@ EXTERNAL OpenCDMError opencdm_session_decrypt(struct OpenCDMSession* session,
     uint32_t initWithLast15);
 #endif // __cplusplus
 
+/**
+ * \brief Hands data over for decryption, without waiting for it to be decrypted.
+ *
+ * \ref opencdm_session_decrypt waits for every sample, so only one sample per
+ * caller is being decrypted at a time. If the OCDM side offers more slots to
+ * decrypt in, this call returns as soon as the sample is in a slot, so a caller
+ * can have a sample in every slot. If there are no slots, or none is free, the
+ * sample is decrypted before this call returns.
+ * Every ticket must be passed to \ref opencdm_session_decrypt_complete, the
+ * encrypted buffer must stay valid until then. A caller still holding tickets
+ * should not call \ref opencdm_session_decrypt, that waits for a free slot.
+ * \param session \ref OpenCDMSession instance.
+ * \param encrypted Buffer containing encrypted data. Decrypted data is stored
+ * here once \ref opencdm_session_decrypt_complete returns.
+ * \param encryptedLength Length of encrypted data buffer (in bytes).
+ * \param IV Initial vector (IV) used during decryption.
+ * \param IVLength Length of IV buffer (in bytes).
+ * \param keyID keyID to use for decryption
+ * \param keyIDLength Length of keyID buffer (in bytes).
+ * \param initWithLast15 Whether decryption context needs to be initialized with
+ * last 15 bytes. Currently this only applies to PlayReady DRM.
+ * \param ticket Receives the ticket to complete the decryption with.
+ * \return Zero on success, non-zero on error, then there is nothing to complete.
+ */
+EXTERNAL OpenCDMError opencdm_session_decrypt_submit(struct OpenCDMSession* session,
+    uint8_t encrypted[],
+    const uint32_t encryptedLength,
+    const uint8_t* IV, uint16_t IVLength,
+    const uint8_t* keyId, const uint16_t keyIdLength,
+    uint32_t initWithLast15,
+    uint32_t* ticket);
+
+/**
+ * \brief Waits for data handed over with \ref opencdm_session_decrypt_submit to
+ * be decrypted.
+ * \param session \ref OpenCDMSession instance.
+ * \param ticket Ticket returned by \ref opencdm_session_decrypt_submit.
+ * \return Zero on success, ERROR_INVALID_ARG for a ticket that was not handed
+ * out or is completed already, non-zero on error.
+ */
+EXTERNAL OpenCDMError opencdm_session_decrypt_complete(struct OpenCDMSession* session,
+    const uint32_t ticket);
+
 #ifdef __cplusplus
 }
 #endif
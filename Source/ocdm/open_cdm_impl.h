@@ -312,6 +312,9 @@ struct OpenCDMSession {
 private:
     using KeyStatusesMap = std::list<OCDM::KeyId>;
 
+    // The ticket of a submitted sample that was decrypted before Submit returned.
+    static constexpr uint32_t DecryptedTicket = ~0;
+
     class Sink : public OCDM::ISession::ICallback {
     //private:
     public:
@@ -441,6 +444,158 @@ private:
         bool _busy;
     };
 
+    // Used next to the DataExchange if the session offers a ring (OCDM::ISessionRing). Every sample
+    // takes a slot of its own and the round trip does not hold the system lock, so audio and video
+    // samples are decrypted side by side. Decrypt waits for its own sample, so one caller has one
+    // sample in flight; with Submit and Complete a caller can have a sample in every slot.
+    class DataExchangeRing : public OCDM::DataExchangeRing {
+    private:
+        DataExchangeRing() = delete;
+        DataExchangeRing(const DataExchangeRing&) = delete;
+        DataExchangeRing& operator=(DataExchangeRing&) = delete;
+
+        enum state : uint8_t {
+            FREE,
+            QUEUED,
+            COMPLETING
+        };
+
+        struct Pending {
+            uint8_t* Data;
+            uint32_t Length;
+            state State;
+        };
+
+    public:
+        DataExchangeRing(const string& ringName)
+            : OCDM::DataExchangeRing(ringName)
+            , _pending(Slots(), Pending{ nullptr, 0, FREE })
+            , _lock()
+        {
+
+            TRACE_L1("Constructing buffer ring client side: %p - %s (%d slots)", this,
+                ringName.c_str(), Slots());
+        }
+        virtual ~DataExchangeRing()
+        {
+            TRACE_L1("Destructing buffer ring client side: %p - %s", this,
+                OCDM::DataExchangeRing::Name().c_str());
+        }
+
+    public:
+        // Takes the next slot, if it is free within the waitTime, and hands the sample to the
+        // OpenCDMIServer. The data must stay available until Complete is called for the slot.
+        uint32_t Submit(const uint32_t waitTime, uint8_t* encryptedData, uint32_t encryptedDataLength,
+            const uint8_t* ivData, uint16_t ivDataLength,
+            const uint8_t* keyId, uint16_t keyIdLength,
+            uint32_t initWithLast15, uint8_t& slot)
+        {
+            uint32_t result = WPEFramework::Core::ERROR_INVALID_INPUT_LENGTH;
+
+            if (encryptedDataLength <= SlotSize()) {
+
+                result = RequestProduce(waitTime, slot);
+
+                if (result == WPEFramework::Core::ERROR_NONE) {
+
+                    SetIV(slot, static_cast<uint8_t>(ivDataLength), ivData);
+                    SetSubSampleData(slot, 0, nullptr);
+                    KeyId(slot, static_cast<uint8_t>(keyIdLength), keyId);
+                    InitWithLast15(slot, initWithLast15);
+                    Write(slot, encryptedDataLength, encryptedData);
+
+                    _lock.Lock();
+                    _pending[slot].Data = encryptedData;
+                    _pending[slot].Length = encryptedDataLength;
+                    _pending[slot].State = QUEUED;
+                    _lock.Unlock();
+
+                    // This will trigger the OpenCDMIServer to decrypt this slot, after the ones before it..
+                    Produced(slot);
+                }
+            }
+
+            return (result);
+        }
+        // Waits for the sample in the slot to be decrypted, copies it back and frees the slot. A slot
+        // that was not submitted, or is completed already, is reported as ERROR_UNKNOWN_KEY.
+        uint32_t Complete(const uint8_t slot, uint32_t& status)
+        {
+            uint32_t result = WPEFramework::Core::ERROR_UNKNOWN_KEY;
+
+            _lock.Lock();
+
+            if ((slot < _pending.size()) && (_pending[slot].State == QUEUED)) {
+                _pending[slot].State = COMPLETING;
+                result = WPEFramework::Core::ERROR_NONE;
+            }
+
+            _lock.Unlock();
+
+            if (result == WPEFramework::Core::ERROR_NONE) {
+
+                status = WPEFramework::Core::ERROR_GENERAL;
+
+                if (RequestResult(slot, WPEFramework::Core::infinite) == WPEFramework::Core::ERROR_NONE) {
+
+                    Read(slot, _pending[slot].Length, _pending[slot].Data);
+
+                    status = Status(slot);
+                }
+
+                _lock.Lock();
+                _pending[slot].Data = nullptr;
+                _pending[slot].State = FREE;
+                _lock.Unlock();
+
+                // And hand the slot to the next sample..
+                Release(slot);
+            }
+
+            return (result);
+        }
+        // Waits till the samples in the slots are decrypted, without completing them. A sample that
+        // does not go through the ring is decrypted after this, so not before the ones queued here.
+        void Flush()
+        {
+            for (uint8_t slot = 0; slot < _pending.size(); slot++) {
+                bool waiting = true;
+
+                while (waiting == true) {
+                    _lock.Lock();
+                    waiting = (_pending[slot].State != FREE);
+                    _lock.Unlock();
+
+                    // Complete might be picking up the result at the same time, so do not wait for it
+                    // forever. A result picked up here is handed back for Complete.
+                    if ((waiting == true) && (RequestResult(slot, 10) == WPEFramework::Core::ERROR_NONE)) {
+                        Consumed(slot);
+                        waiting = false;
+                    }
+                }
+            }
+        }
+        uint32_t Decrypt(uint8_t* encryptedData, uint32_t encryptedDataLength,
+            const uint8_t* ivData, uint16_t ivDataLength,
+            const uint8_t* keyId, uint16_t keyIdLength,
+            uint32_t initWithLast15 /* = 0 */)
+        {
+            uint8_t slot;
+            uint32_t ret = Submit(WPEFramework::Core::infinite, encryptedData, encryptedDataLength, ivData,
+                ivDataLength, keyId, keyIdLength, initWithLast15, slot);
+
+            if (ret == WPEFramework::Core::ERROR_NONE) {
+                Complete(slot, ret);
+            }
+
+            return (ret);
+        }
+
+    private:
+        std::vector<Pending> _pending;
+        WPEFramework::Core::CriticalSection _lock;
+    };
+
 public:
     OpenCDMSession(const OpenCDMSession&) = delete;
     OpenCDMSession& operator= (const OpenCDMSession&) = delete;
@@ -460,6 +615,7 @@ public:
         void* userData)
         : _sessionId()
         , _decryptSession(nullptr)
+        , _decryptRing(nullptr)
         , _session(nullptr)
         , _sessionExt(nullptr)
         , _refCount(1)
@@ -588,9 +744,69 @@ public:
     {
         uint32_t result = OpenCDMError::ERROR_INVALID_DECRYPT_BUFFER;
         if (_decryptSession != nullptr) {
-            result = _decryptSession->Decrypt(encryptedData, encryptedDataLength, ivData,
-                ivDataLength, keyId, keyIdLength,
-                initWithLast15);
+            // Samples that do not fit in a slot go through the single buffer, after the ones in the slots.
+            if ((_decryptRing != nullptr) && (encryptedDataLength <= _decryptRing->SlotSize())) {
+                result = _decryptRing->Decrypt(encryptedData, encryptedDataLength, ivData,
+                    ivDataLength, keyId, keyIdLength,
+                    initWithLast15);
+            } else {
+                if (_decryptRing != nullptr) {
+                    _decryptRing->Flush();
+                }
+                result = _decryptSession->Decrypt(encryptedData, encryptedDataLength, ivData,
+                    ivDataLength, keyId, keyIdLength,
+                    initWithLast15);
+            }
+            if(result)
+            {
+                TRACE_L1("Decrypt() failed with return code: %x", result);
+                result = OpenCDMError::ERROR_UNKNOWN;
+            }
+        }
+        return (result);
+    }
+    // Without a free slot the sample is decrypted right away, the ticket then has nothing to wait for.
+    // That goes through the single buffer: the slots might all be held by this caller. The samples
+    // still in the slots are decrypted first, a later sample should not overtake them.
+    uint32_t Submit(uint8_t* encryptedData, const uint32_t encryptedDataLength,
+        const uint8_t* ivData, uint16_t ivDataLength,
+        const uint8_t* keyId, const uint16_t keyIdLength,
+        uint32_t initWithLast15, uint32_t& ticket)
+    {
+        uint32_t result = OpenCDMError::ERROR_INVALID_DECRYPT_BUFFER;
+        uint8_t slot;
+
+        ticket = DecryptedTicket;
+
+        if (encryptedDataLength == 0) {
+            result = OpenCDMError::ERROR_NONE;
+        } else if (_decryptSession != nullptr) {
+            if ((_decryptRing != nullptr) && (_decryptRing->Submit(0, encryptedData, encryptedDataLength, ivData, ivDataLength, keyId, keyIdLength, initWithLast15, slot) == WPEFramework::Core::ERROR_NONE)) {
+                ticket = slot;
+                result = OpenCDMError::ERROR_NONE;
+            } else {
+                if (_decryptRing != nullptr) {
+                    _decryptRing->Flush();
+                }
+                result = _decryptSession->Decrypt(encryptedData, encryptedDataLength, ivData,
+                    ivDataLength, keyId, keyIdLength,
+                    initWithLast15);
+                if(result)
+                {
+                    TRACE_L1("Decrypt() failed with return code: %x", result);
+                    result = OpenCDMError::ERROR_UNKNOWN;
+                }
+            }
+        }
+        return (result);
+    }
+    uint32_t Complete(const uint32_t ticket)
+    {
+        uint32_t result = OpenCDMError::ERROR_INVALID_ARG;
+
+        if (ticket == DecryptedTicket) {
+            result = OpenCDMError::ERROR_NONE;
+        } else if ((_decryptRing != nullptr) && (ticket < _decryptRing->Slots()) && (_decryptRing->Complete(static_cast<uint8_t>(ticket), result) == WPEFramework::Core::ERROR_NONE)) {
             if(result)
             {
                 TRACE_L1("Decrypt() failed with return code: %x", result);
@@ -672,8 +888,14 @@ protected:
 
             _session->Release();
 
-            delete _decryptSession;
-            _decryptSession = nullptr;
+            if (_decryptSession != nullptr) {
+                delete _decryptSession;
+                _decryptSession = nullptr;
+            }
+            if (_decryptRing != nullptr) {
+                delete _decryptRing;
+                _decryptRing = nullptr;
+            }
 
             if (_sessionExt != nullptr) {
                 _sessionExt->Release();
@@ -685,10 +907,29 @@ protected:
 
         if (session != nullptr) {
 
-            ASSERT (_decryptSession == nullptr);
+            ASSERT ((_decryptSession == nullptr) && (_decryptRing == nullptr));
 
             _session->AddRef();
+
             _decryptSession = new DataExchange(_session->BufferId());
+
+            // Only a ring the session created itself is used, whatever files are lying around.
+            OCDM::ISessionRing* ring = _session->QueryInterface<OCDM::ISessionRing>();
+
+            if (ring != nullptr) {
+                const string ringId(ring->RingId());
+
+                if (ringId.empty() == false) {
+                    _decryptRing = new DataExchangeRing(ringId);
+
+                    if (_decryptRing->IsValid() == false) {
+                        TRACE_L1("The ring %s of the session is not usable, decrypting through the buffer.", ringId.c_str());
+                        delete _decryptRing;
+                        _decryptRing = nullptr;
+                    }
+                }
+                ring->Release();
+            }
             _sessionExt = _session->QueryInterface<OCDM::ISessionExt>();
         }
     }
@@ -745,6 +986,7 @@ protected:
 private:
     std::string _sessionId;
     DataExchange* _decryptSession;
+    DataExchangeRing* _decryptRing;
     OCDM::ISession* _session;
     OCDM::ISessionExt* _sessionExt;
     uint32_t _refCount;
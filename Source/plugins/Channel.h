@@ -85,8 +85,8 @@ namespace PluginHost {
             {
                 return (_current.IsValid() == false);
             }
-			inline uint16_t Serialize(char* stream, const uint16_t length) const {
-                uint16_t loaded = 0;
+			inline uint32_t Serialize(char* stream, const uint32_t length) const {
+                uint32_t loaded = 0;
 
                 if (_current.IsValid() == false) {
                     _current = Core::ProxyType<const Core::JSON::IElement>(_parent.Element());
@@ -105,7 +105,7 @@ namespace PluginHost {
         private:
             Channel& _parent;
             mutable Core::ProxyType<const Core::JSON::IElement> _current;
-            mutable uint16_t _offset;
+            mutable uint32_t _offset;
         };
         class EXTERNAL DeserializerImpl {
         public:
@@ -128,9 +128,9 @@ namespace PluginHost {
             {
                 return (_current.IsValid() == false);
             }
-            inline uint16_t Deserialize(const char* stream, const uint16_t length)
+            inline uint32_t Deserialize(const char* stream, const uint32_t length)
             {
-			    uint16_t loaded = 0;
+			    uint32_t loaded = 0;
 
                 if (_current.IsValid() == false) {
                     if (_parent.IsOpen() == true) {
@@ -152,7 +152,7 @@ namespace PluginHost {
         private:
             Channel& _parent;
             Core::ProxyType<Core::JSON::IElement> _current;
-            uint16_t _offset;
+            uint32_t _offset;
         };
 
     public:
@@ -276,9 +276,9 @@ namespace PluginHost {
             Binary(state == RAW);
             _state = state | (notification ? 0x8000 : 0x0000);
         }
-        inline uint16_t Serialize(uint8_t* dataFrame, const uint16_t maxSendSize)
+        inline uint32_t Serialize(uint8_t* dataFrame, const uint32_t maxSendSize)
         {
-            uint16_t size = 0;
+            uint32_t size = 0;
 
             if (_sendQueue.size() != 0) {
 
@@ -309,7 +309,7 @@ namespace PluginHost {
                     // Seems we need to send plain strings...
                     _adminLock.Lock();
                     Package& data(_sendQueue.front());
-                    uint16_t neededBytes(static_cast<uint16_t>(data.Text().length() - _offset));
+                    uint32_t neededBytes(static_cast<uint32_t>(data.Text().length() - _offset));
 
                     if (neededBytes <= maxSendSize) {
                         ::memcpy(dataFrame, &(data.Text().c_str()[_offset]), neededBytes);
@@ -319,7 +319,7 @@ namespace PluginHost {
                         // See if there is more to do..
                         _sendQueue.pop_front();
                     } else {
-                        uint16_t addedBytes = maxSendSize - size;
+                        uint32_t addedBytes = maxSendSize - size;
                         ::memcpy(dataFrame, &(data.Text().c_str()[_offset]), addedBytes);
                         _offset += addedBytes;
                         size = addedBytes;
@@ -346,9 +346,9 @@ namespace PluginHost {
 
             return (size);
         }
-        inline uint16_t Deserialize(const uint8_t* dataFrame, const uint16_t receivedSize)
+        inline uint32_t Deserialize(const uint8_t* dataFrame, const uint32_t receivedSize)
         {
-            uint16_t handled = receivedSize;
+            uint32_t handled = receivedSize;
 
             switch (State()) {
             case JSON:
@@ -396,8 +396,8 @@ namespace PluginHost {
 
         // We are in an upgraded mode, we are a websocket. Time to "deserialize and serialize
         // INBOUND and OUTBOUND information.
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) = 0;
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) = 0;
 
         // If it is a WebSocket, protocol TEXT, This is the feeding back virtual
         virtual void Received(const string& text) = 0;
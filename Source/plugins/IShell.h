@@ -289,10 +289,18 @@ namespace Core {
     EXTERNAL /* static */ const EnumerateConversion<PluginHost::IShell::state>*
     EnumerateType<PluginHost::IShell::state>::Table(const uint16_t);
 
+    template <>
+    EXTERNAL /* static */ const EnumerateIndex<PluginHost::IShell::state>&
+    EnumerateType<PluginHost::IShell::state>::Index();
+
     template <>
     EXTERNAL /* static */ const EnumerateConversion<PluginHost::IShell::reason>*
     EnumerateType<PluginHost::IShell::reason>::Table(const uint16_t);
 
+    template <>
+    EXTERNAL /* static */ const EnumerateIndex<PluginHost::IShell::reason>&
+    EnumerateType<PluginHost::IShell::reason>::Index();
+
 } // namespace Core
 } // namespace WPEFramework
 
@@ -62,10 +62,18 @@ namespace Core {
     EXTERNAL /* static */ const EnumerateConversion<PluginHost::IStateControl::command>*
     EnumerateType<PluginHost::IStateControl::command>::Table(const uint16_t);
 
+    template <>
+    EXTERNAL /* static */ const EnumerateIndex<PluginHost::IStateControl::command>&
+    EnumerateType<PluginHost::IStateControl::command>::Index();
+
     template <>
     EXTERNAL /* static */ const EnumerateConversion<PluginHost::IStateControl::state>*
     EnumerateType<PluginHost::IStateControl::state>::Table(const uint16_t);
 
+    template <>
+    EXTERNAL /* static */ const EnumerateIndex<PluginHost::IStateControl::state>&
+    EnumerateType<PluginHost::IStateControl::state>::Index();
+
 } // namespace PluginHost
 } // namespace WPEFramework
 
@@ -199,6 +199,10 @@ namespace Core {
     template <>
     EXTERNAL /* static */ const EnumerateConversion<PluginHost::ISubSystem::subsystem>*
     EnumerateType<PluginHost::ISubSystem::subsystem>::Table(const uint16_t index);
+
+    template <>
+    EXTERNAL /* static */ const EnumerateIndex<PluginHost::ISubSystem::subsystem>&
+    EnumerateType<PluginHost::ISubSystem::subsystem>::Index();
 }
 
 } // namespace WPEFramework
@@ -68,14 +68,14 @@ namespace PluginHost {
         {
             std::vector<uint8_t> versions = { 1 };
 
-            _handlers.emplace_back([&](const uint32_t id, const string& designator, const string& data) { Notify(id, designator, data); }, versions);
+            _handlers.emplace_back([&](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Payload>& data) { Notify(id, designator, data); }, versions);
         }
         JSONRPC(const std::vector<uint8_t> versions)
             : _adminLock()
             , _handlers()
             , _service(nullptr)
         {
-            _handlers.emplace_back([&](const uint32_t id, const string& designator, const string& data) { Notify(id, designator, data); }, versions);
+            _handlers.emplace_back([&](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Payload>& data) { Notify(id, designator, data); }, versions);
         }
         virtual ~JSONRPC()
         {
@@ -111,12 +111,12 @@ namespace PluginHost {
         }
         Core::JSONRPC::Handler& CreateHandler(const std::vector<uint8_t>& versions)
         {
-            _handlers.emplace_back([&](const uint32_t id, const string& designator, const string& data) { Notify(id, designator, data); }, versions);
+            _handlers.emplace_back([&](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Payload>& data) { Notify(id, designator, data); }, versions);
             return (_handlers.back());
         }
         Core::JSONRPC::Handler& CreateHandler(const std::vector<uint8_t>& versions, const Core::JSONRPC::Handler& source)
         {
-            _handlers.emplace_back([&](const uint32_t id, const string& designator, const string& data) { Notify(id, designator, data); }, versions, source);
+            _handlers.emplace_back([&](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Payload>& data) { Notify(id, designator, data); }, versions, source);
             return (_handlers.back());
         }
         Core::JSONRPC::Handler* GetHandler(uint8_t version)
@@ -288,14 +288,11 @@ namespace PluginHost {
                 }
                 break;
             case STATE_CUSTOM:
-                string result;
-                uint32_t code = source->Invoke(Core::JSONRPC::Connection(channelId, inbound.Id.Value()), inbound.FullMethod(), inbound.Parameters.Value(), result);
+                uint32_t code = source->Invoke(Core::JSONRPC::Connection(channelId, inbound.Id.Value()), inbound.FullMethod(), inbound.Parameters, response->Result);
                 if (response.IsValid() == true) {
                     if (code == static_cast<uint32_t>(~0)) {
                         response.Release();
-                    } else if (code == Core::ERROR_NONE) {
-                        response->Result = result;
-                    } else {
+                    } else if (code != Core::ERROR_NONE) {
                         response->Error.Code = code;
                         response->Error.Text = Core::ErrorToString(code);
                     }
@@ -347,18 +344,14 @@ namespace PluginHost {
             }
             return (result);
         }
-        void Notify(const uint32_t id, const string& designator, const string& parameters)
+        void Notify(const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Payload>& parameters)
         {
-            Core::ProxyType<Core::JSONRPC::Message> message(_jsonRPCMessageFactory.Element());
+            Core::ProxyType<Core::JSONRPC::Notification> message(_notificationFactory.Element());
 
             ASSERT(_service != nullptr);
 
-            if (!parameters.empty()) {
-                message->Parameters = parameters;
-            }
-
-            message->Designator = designator;
-            message->JSONRPC = Core::JSONRPC::Message::DefaultVersion;
+            // The parameters are rendered once for all subscribers, only the envelope is per subscriber.
+            message->Set(designator, parameters);
 
             _service->Submit(id, Core::ProxyType<Core::JSON::IElement>(message));
         }
@@ -399,6 +392,7 @@ namespace PluginHost {
         string _callsign;
 
         static Core::ProxyPoolType<Web::JSONBodyType<Core::JSONRPC::Message>> _jsonRPCMessageFactory;
+        static Core::ProxyPoolType<Core::JSONRPC::Notification> _notificationFactory;
     };
 
     class EXTERNAL JSONRPCSupportsEventStatus : public JSONRPC {
@@ -27,6 +27,16 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
 
     ENUM_CONVERSION_END(PluginHost::MetaData::Service::state)
 
+        ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Phase::phase)
+
+            { PluginHost::MetaData::Phase::LOAD, _TXT("load") },
+    { PluginHost::MetaData::Phase::PRECONDITION, _TXT("precondition") },
+    { PluginHost::MetaData::Phase::INITIALIZE, _TXT("initialize") },
+    { PluginHost::MetaData::Phase::LAUNCH, _TXT("launch") },
+    { PluginHost::MetaData::Phase::ACTIVATION, _TXT("activation") },
+
+    ENUM_CONVERSION_END(PluginHost::MetaData::Phase::phase)
+
         ENUM_CONVERSION_BEGIN(PluginHost::ISubSystem::IInternet::network_type)
 
             { PluginHost::ISubSystem::IInternet::UNKNOWN, _TXT("Unknown") },
@@ -90,6 +100,7 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
 #endif
         Add(_T("module"), &Module);
         Add(_T("hash"), &Hash);
+        Add(_T("activationtime"), &ActivationTime);
     }
     MetaData::Service::Service(const MetaData::Service& copy)
         : Plugin::Config(copy)
@@ -103,6 +114,7 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
 #endif
         , Module(copy.Module)
         , Hash(copy.Hash)
+        , ActivationTime(copy.ActivationTime)
     {
         Add(_T("state"), &JSONState);
 #ifdef RUNTIME_STATISTICS
@@ -114,6 +126,7 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
 #endif
         Add(_T("module"), &Module);
         Add(_T("hash"), &Hash);
+        Add(_T("activationtime"), &ActivationTime);
     }
     MetaData::Service::~Service()
     {
@@ -202,6 +215,33 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
     {
     }
 
+    MetaData::Phase::Phase()
+        : Core::JSON::Container()
+    {
+        Add(_T("callsign"), &Callsign);
+        Add(_T("phase"), &Name);
+        Add(_T("start"), &Start);
+        Add(_T("duration"), &Duration);
+        Add(_T("thread"), &Thread);
+    }
+    MetaData::Phase::Phase(const Phase& copy)
+        : Core::JSON::Container()
+        , Callsign(copy.Callsign)
+        , Name(copy.Name)
+        , Start(copy.Start)
+        , Duration(copy.Duration)
+        , Thread(copy.Thread)
+    {
+        Add(_T("callsign"), &Callsign);
+        Add(_T("phase"), &Name);
+        Add(_T("start"), &Start);
+        Add(_T("duration"), &Duration);
+        Add(_T("thread"), &Thread);
+    }
+    MetaData::Phase::~Phase()
+    {
+    }
+
     MetaData::Server::Server()
     {
         Core::JSON::Container::Add(_T("threads"), &ThreadPoolRuns);
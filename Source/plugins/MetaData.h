@@ -69,6 +69,7 @@ namespace PluginHost {
 #endif
             Core::JSON::String Module;
             Core::JSON::String Hash;
+            Core::JSON::DecUInt32 ActivationTime; // Microseconds the last activation took, loading the library included.
         };
 
         class EXTERNAL Channel : public Core::JSON::Container {
@@ -132,6 +133,33 @@ namespace PluginHost {
             Core::JSON::Boolean Secure;
         };
 
+        // One step on the (startup) timeline of a plugin.
+        class EXTERNAL Phase : public Core::JSON::Container {
+        private:
+            Phase& operator=(const Phase&) = delete;
+
+        public:
+            enum phase {
+                LOAD, // Loading the library and instantiating the plugin
+                PRECONDITION, // Waiting for the subsystems the plugin depends on
+                INITIALIZE, // IPlugin::Initialize()
+                LAUNCH, // Spawning an out-of-process part, up to its announcement
+                ACTIVATION // The activation as a whole
+            };
+
+        public:
+            Phase();
+            Phase(const Phase& copy);
+            ~Phase();
+
+        public:
+            Core::JSON::String Callsign;
+            Core::JSON::EnumType<phase> Name;
+            Core::JSON::DecUInt64 Start; // Microseconds since the framework started
+            Core::JSON::DecUInt32 Duration; // Microseconds
+            Core::JSON::DecUInt32 Thread;
+        };
+
         class EXTERNAL Server : public Core::JSON::Container {
         private:
             Server(const Server& copy) = delete;
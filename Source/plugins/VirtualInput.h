@@ -872,6 +872,10 @@ namespace Core {
     EXTERNAL /* static */ const EnumerateConversion<PluginHost::VirtualInput::KeyMap::modifier>*
     EnumerateType<PluginHost::VirtualInput::KeyMap::modifier>::Table(const uint16_t);
 
+    template <>
+    EXTERNAL /* static */ const EnumerateIndex<PluginHost::VirtualInput::KeyMap::modifier>&
+    EnumerateType<PluginHost::VirtualInput::KeyMap::modifier>::Index();
+
 } // namespace Core
 
 } // namespace WPEFramework
@@ -6,6 +6,7 @@
 // ---- Include local include files ----
 #include "ITraceControl.h"
 #include "Module.h"
+#include "TraceRecorder.h"
 #include "TraceUnit.h"
 
 // ---- Referenced classes and types ----
@@ -33,6 +34,48 @@
             &__message__);                                                             \
     }
 
+// Same as TRACE, but if the TraceRecorder is open, the arguments are recorded as they are and
+// formatted once flushed. The format must be a string literal.
+#define TRACE_DEFERRED(CATEGORY, PARAMETERS)                                           \
+    if (WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME>::IsEnabled() == true) { \
+        if (WPEFramework::Trace::TraceRecorder::Instance().IsOpen() == true) {        \
+            WPEFramework::Trace::TraceRecorder::Entry(                                 \
+                __FILE__,                                                              \
+                __LINE__,                                                              \
+                typeid(*this).name(),                                                  \
+                WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME>::ModuleName(), \
+                WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME>::CategoryName()).Record PARAMETERS; \
+        } else {                                                                       \
+            CATEGORY __data__ PARAMETERS;                                              \
+            WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME> __message__(__data__); \
+            WPEFramework::Trace::TraceUnit::Instance().Trace(                          \
+                __FILE__,                                                              \
+                __LINE__,                                                              \
+                typeid(*this).name(),                                                  \
+                &__message__);                                                         \
+        }                                                                              \
+    }
+
+#define TRACE_DEFERRED_GLOBAL(CATEGORY, PARAMETERS)                                    \
+    if (WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME>::IsEnabled() == true) { \
+        if (WPEFramework::Trace::TraceRecorder::Instance().IsOpen() == true) {        \
+            WPEFramework::Trace::TraceRecorder::Entry(                                 \
+                __FILE__,                                                              \
+                __LINE__,                                                              \
+                __FUNCTION__,                                                          \
+                WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME>::ModuleName(), \
+                WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME>::CategoryName()).Record PARAMETERS; \
+        } else {                                                                       \
+            CATEGORY __data__ PARAMETERS;                                              \
+            WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME> __message__(__data__); \
+            WPEFramework::Trace::TraceUnit::Instance().Trace(                          \
+                __FILE__,                                                              \
+                __LINE__,                                                              \
+                __FUNCTION__,                                                          \
+                &__message__);                                                         \
+        }                                                                              \
+    }
+
 // ---- Helper functions ----
 
 // ---- Class Definition ----
@@ -131,6 +174,16 @@ namespace Trace {
             s_TraceControl.Enabled(status);
         }
 
+        inline static const char* CategoryName()
+        {
+            return (s_TraceControl.Category());
+        }
+
+        inline static const char* ModuleName()
+        {
+            return (s_TraceControl.Module());
+        }
+
         virtual const char* Category() const
         {
             return (s_TraceControl.Category());
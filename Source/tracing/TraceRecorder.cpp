@@ -0,0 +1,377 @@
+#include "TraceRecorder.h"
+
+namespace WPEFramework {
+namespace Trace {
+
+    namespace {
+
+        template <typename TYPE>
+        TYPE Get(const uint8_t data[])
+        {
+            TYPE result;
+            ::memcpy(&result, data, sizeof(TYPE));
+            return (result);
+        }
+
+    }
+
+    // Keeps the ring of this thread alive for as long as the thread is and tells the reader once
+    // the thread is gone, so the ring can be removed after it has been flushed.
+    class TraceRecorder::LocalRing {
+    public:
+        LocalRing(const LocalRing&) = delete;
+        LocalRing& operator=(const LocalRing&) = delete;
+
+        LocalRing()
+            : Ring()
+        {
+        }
+        ~LocalRing()
+        {
+            if (Ring.IsValid() == true) {
+                Ring->Close();
+            }
+        }
+
+    public:
+        Core::ProxyType<TraceRecorder::Ring> Ring;
+    };
+
+    /* static */ thread_local TraceRecorder::LocalRing TraceRecorder::_localRing;
+
+    /* static */ void TraceRecorder::Append(string& destination, const string& specification, const uint8_t type, const uint8_t value[], const uint16_t length)
+    {
+        const char conversion = specification[specification.length() - 1];
+        const string prefix(specification, 0, specification.length() - 1);
+        char buffer[128];
+        int size = 0;
+
+        switch (conversion) {
+        case 'd':
+        case 'i':
+            size = ::snprintf(buffer, sizeof(buffer), (prefix + "lld").c_str(), (type == REAL ? static_cast<long long>(Get<double>(value)) : static_cast<long long>(Get<int64_t>(value))));
+            break;
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            size = ::snprintf(buffer, sizeof(buffer), (prefix + "ll" + conversion).c_str(), (type == REAL ? static_cast<unsigned long long>(Get<double>(value)) : static_cast<unsigned long long>(Get<uint64_t>(value))));
+            break;
+        case 'c':
+            size = ::snprintf(buffer, sizeof(buffer), specification.c_str(), static_cast<int>(Get<int64_t>(value)));
+            break;
+        case 'p':
+            size = ::snprintf(buffer, sizeof(buffer), specification.c_str(), reinterpret_cast<void*>(static_cast<uintptr_t>(Get<uint64_t>(value))));
+            break;
+        case 's':
+            if (type == TEXT) {
+                // Width and precision are not applied, the text has been recorded with its length.
+                destination.append(reinterpret_cast<const char*>(value), length);
+            } else {
+                destination += _T("(?)");
+            }
+            break;
+        default:
+            size = ::snprintf(buffer, sizeof(buffer), specification.c_str(), (type == REAL ? Get<double>(value) : (type == SIGNED ? static_cast<double>(Get<int64_t>(value)) : static_cast<double>(Get<uint64_t>(value)))));
+            break;
+        }
+
+        if (size > 0) {
+            destination.append(buffer, (static_cast<uint32_t>(size) < sizeof(buffer) ? size : sizeof(buffer) - 1));
+        }
+    }
+
+    // A printf like format, applied to the arguments as they were recorded: the length modifiers
+    // are replaced by the size the arguments have been recorded with. Arguments that did not fit in
+    // the frame are shown as "(truncated)", a text that was cut is followed by it.
+    /* static */ void TraceRecorder::Format(string& destination, const string& format, const uint8_t arguments[], const uint16_t length)
+    {
+        static const TCHAR Truncated[] = _T("(truncated)");
+        uint16_t offset = 0;
+        string::size_type index = 0;
+        bool truncated = false;
+
+        while (index < format.length()) {
+            const string::size_type marker = format.find('%', index);
+
+            if (marker == string::npos) {
+                destination.append(format, index, string::npos);
+                index = format.length();
+            } else {
+                destination.append(format, index, marker - index);
+                index = marker + 1;
+
+                if ((index < format.length()) && (format[index] == '%')) {
+                    destination += '%';
+                    index++;
+                } else {
+                    string specification(1, '%');
+
+                    while ((index < format.length()) && (::strchr("-+ #0123456789.", format[index]) != nullptr)) {
+                        specification += format[index++];
+                    }
+                    while ((index < format.length()) && (::strchr("hlLqjzt", format[index]) != nullptr)) {
+                        index++;
+                    }
+                    if (index < format.length()) {
+                        specification += format[index++];
+
+                        if (::strchr("diouxXcpseEfFgGaA", specification.back()) == nullptr) {
+                            // Not supported (e.g. a '*' width), show it as is.
+                            destination += specification;
+                        } else if (offset >= length) {
+                            destination += _T("(missing)");
+                        } else if (arguments[offset] == TRUNCATED) {
+                            destination += Truncated;
+                            truncated = true;
+                        } else {
+                            const uint8_t type = arguments[offset];
+                            uint16_t size;
+
+                            if (type == TEXT) {
+                                size = Get<uint16_t>(&(arguments[offset + 1]));
+                                Append(destination, specification, type, &(arguments[offset + 3]), size);
+                                size += 2;
+                            } else {
+                                size = 8;
+                                Append(destination, specification, type, &(arguments[offset + 1]), size);
+                            }
+
+                            offset += (1 + size);
+                        }
+                    }
+                }
+            }
+        }
+
+        if ((truncated == false) && (offset < length) && (arguments[offset] == TRUNCATED)) {
+            destination += ' ';
+            destination += Truncated;
+        }
+    }
+
+    TraceRecorder::Ring::Ring(const uint32_t size, const uint32_t thread)
+        : _buffer(new uint8_t[size])
+        , _mask(size - 1)
+        , _thread(thread)
+        , _head(0)
+        , _tail(0)
+        , _dropped(0)
+        , _closed(false)
+    {
+        ::memset(_cache, 0, sizeof(_cache));
+
+        // The positions run freely, wrapping around the ring requires a power of 2.
+        ASSERT((size & _mask) == 0);
+    }
+
+    TraceRecorder::Ring::~Ring()
+    {
+        delete[] _buffer;
+    }
+
+    bool TraceRecorder::Ring::Write(const uint8_t data[], const uint16_t length)
+    {
+        bool result = false;
+        const uint32_t head = _head.load(std::memory_order_relaxed);
+        const uint32_t tail = _tail.load(std::memory_order_acquire);
+
+        if (((_mask + 1) - (head - tail)) < length) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            const uint32_t offset = (head & _mask);
+            const uint32_t first = std::min(static_cast<uint32_t>(length), (_mask + 1) - offset);
+
+            ::memcpy(&(_buffer[offset]), data, first);
+            ::memcpy(_buffer, &(data[first]), length - first);
+
+            _head.store(head + length, std::memory_order_release);
+            result = true;
+        }
+
+        return (result);
+    }
+
+    uint16_t TraceRecorder::Ring::Read(uint8_t data[], const uint16_t maxLength)
+    {
+        uint16_t length = 0;
+        const uint32_t tail = _tail.load(std::memory_order_relaxed);
+        const uint32_t head = _head.load(std::memory_order_acquire);
+
+        if (head != tail) {
+            const uint32_t offset = (tail & _mask);
+
+            data[0] = _buffer[offset];
+            data[1] = _buffer[(offset + 1) & _mask];
+            length = Get<uint16_t>(data);
+
+            ASSERT(length <= maxLength);
+
+            const uint32_t first = std::min(static_cast<uint32_t>(length), (_mask + 1) - offset);
+
+            ::memcpy(data, &(_buffer[offset]), first);
+            ::memcpy(&(data[first]), _buffer, length - first);
+
+            _tail.store(tail + length, std::memory_order_release);
+        }
+
+        return (length);
+    }
+
+    void TraceRecorder::Frame::AppendText(const char text[], const size_t length)
+    {
+        if ((_truncated == false) && ((_length + sizeof(uint8_t) + sizeof(uint16_t)) < sizeof(_data))) {
+            // Whatever part of the text fits is kept, the marker tells it was cut.
+            const uint16_t size = static_cast<uint16_t>(std::min(length, sizeof(_data) - (_length + 1 + 2 + 1)));
+
+            _data[_length] = TEXT;
+            ::memcpy(&(_data[_length + 1]), &size, 2);
+            ::memcpy(&(_data[_length + 3]), text, size);
+            _length += (1 + 2 + size);
+
+            _truncated = (size < length);
+        } else {
+            _truncated = true;
+        }
+    }
+
+    TraceRecorder::TraceRecorder()
+        : _adminLock()
+        , _open(false)
+        , _bufferSize(DefaultBufferSize)
+        , _rings()
+        , _threads(0)
+        , _identifiers()
+        , _texts()
+        , _dropped(0)
+    {
+        // Identifier 0 is handed out once there is no room for more texts.
+        _texts.push_back(_T("?"));
+    }
+
+    /* virtual */ TraceRecorder::~TraceRecorder()
+    {
+    }
+
+    /* static */ TraceRecorder& TraceRecorder::Instance()
+    {
+        return (Core::SingletonType<TraceRecorder>::Instance());
+    }
+
+    uint32_t TraceRecorder::Open(const uint32_t bufferSize)
+    {
+        uint32_t size = 1;
+
+        while ((size < bufferSize) && (size < 0x80000000)) {
+            size <<= 1;
+        }
+
+        _adminLock.Lock();
+
+        _bufferSize = std::max(size, static_cast<uint32_t>(TRACINGBUFFERSIZE));
+        _open.store(true, std::memory_order_relaxed);
+
+        _adminLock.Unlock();
+
+        return (Core::ERROR_NONE);
+    }
+
+    uint32_t TraceRecorder::Close()
+    {
+        _open.store(false, std::memory_order_relaxed);
+
+        return (Core::ERROR_NONE);
+    }
+
+    TraceRecorder::Ring& TraceRecorder::Current()
+    {
+        if (_localRing.Ring.IsValid() == false) {
+            _adminLock.Lock();
+
+            // Thread identifiers are reused, so hand out a sequence number of our own.
+            _localRing.Ring = Core::ProxyType<Ring>::Create(_bufferSize, ++_threads);
+            _rings.push_back(_localRing.Ring);
+
+            _adminLock.Unlock();
+        }
+
+        return (*(_localRing.Ring));
+    }
+
+    uint16_t TraceRecorder::Intern(const char text[])
+    {
+        uint16_t result = 0;
+
+        _adminLock.Lock();
+
+        std::unordered_map<const char*, uint16_t>::const_iterator index(_identifiers.find(text));
+
+        if (index != _identifiers.end()) {
+            result = index->second;
+        } else if (_texts.size() <= 0xFFFF) {
+            result = static_cast<uint16_t>(_texts.size());
+            _texts.push_back(text);
+            _identifiers.emplace(text, result);
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    uint32_t TraceRecorder::Flush(IConsumer& consumer)
+    {
+        uint32_t count = 0;
+        uint8_t data[TRACINGBUFFERSIZE];
+        string message;
+
+        _adminLock.Lock();
+
+        std::list<Core::ProxyType<Ring>>::iterator index(_rings.begin());
+
+        while (index != _rings.end()) {
+            // Once closed, nothing is added anymore, so after this read it can go.
+            const bool closed = (*index)->IsClosed();
+            uint16_t length;
+
+            while ((length = (*index)->Read(data, sizeof(data))) != 0) {
+                message.clear();
+
+                Format(message, _texts[Get<uint16_t>(&(data[22]))], &(data[HeaderSize]), length - HeaderSize);
+
+                consumer.Trace(Get<uint64_t>(&(data[2])), (*index)->Thread(),
+                    _texts[Get<uint16_t>(&(data[14]))].c_str(), Get<uint32_t>(&(data[10])),
+                    _texts[Get<uint16_t>(&(data[16]))].c_str(), _texts[Get<uint16_t>(&(data[18]))].c_str(),
+                    _texts[Get<uint16_t>(&(data[20]))].c_str(), message);
+                count++;
+            }
+
+            if (closed == true) {
+                _dropped += (*index)->Dropped();
+                index = _rings.erase(index);
+            } else {
+                index++;
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return (count);
+    }
+
+    uint32_t TraceRecorder::Dropped() const
+    {
+        _adminLock.Lock();
+
+        uint32_t result = _dropped;
+
+        for (const Core::ProxyType<Ring>& ring : _rings) {
+            result += ring->Dropped();
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+}
+} // namespace WPEFramework::Trace
@@ -0,0 +1,332 @@
+#ifndef __TRACERECORDER_H
+#define __TRACERECORDER_H
+
+// ---- Include system wide include files ----
+#include <atomic>
+#include <type_traits>
+#include <unordered_map>
+
+// ---- Include local include files ----
+#include "ITraceControl.h"
+#include "Module.h"
+
+// ---- Helper types and constants ----
+
+// ---- Helper functions ----
+namespace WPEFramework {
+namespace Trace {
+
+    // ---- Class Definition ----
+
+    // Binary trace path. Every thread records into a ring of its own, without taking a lock. The
+    // file, class, module, category and format are recorded as identifiers of interned strings, the
+    // arguments as their raw values. Formatting is deferred to the moment the records are flushed.
+    // Interning is done on the address of the text, so these texts must be string literals or live
+    // as long as the process does (__FILE__, typeid().name(), the category names).
+    class EXTERNAL TraceRecorder {
+    public:
+        static constexpr uint32_t DefaultBufferSize = (16 * 1024);
+
+        struct IConsumer {
+            virtual ~IConsumer() {}
+
+            virtual void Trace(const uint64_t time, const uint32_t thread, const char file[], const uint32_t lineNumber, const char className[], const char module[], const char category[], const string& message) = 0;
+        };
+
+    private:
+        enum argument : uint8_t {
+            SIGNED,
+            UNSIGNED,
+            REAL,
+            TEXT,
+            POINTER,
+            TRUNCATED // The arguments from here on did not fit in the frame.
+        };
+
+        // Written by its thread only, read by whoever flushes. Records are never overwritten, if
+        // there is no room, the record is dropped and counted.
+        class Ring {
+        public:
+            Ring() = delete;
+            Ring(const Ring&) = delete;
+            Ring& operator=(const Ring&) = delete;
+
+            Ring(const uint32_t size, const uint32_t thread);
+            ~Ring();
+
+        public:
+            inline uint32_t Thread() const
+            {
+                return (_thread);
+            }
+            inline uint32_t Dropped() const
+            {
+                return (_dropped.load(std::memory_order_relaxed));
+            }
+            inline bool IsClosed() const
+            {
+                return (_closed.load(std::memory_order_acquire));
+            }
+            inline void Close()
+            {
+                _closed.store(true, std::memory_order_release);
+            }
+            // Open addressed on the address of the text. Only when it is full, the texts that did not
+            // fit take the lock of the shared table on every trace.
+            inline uint16_t Identifier(const char text[])
+            {
+                uint16_t result;
+                uint16_t index = static_cast<uint16_t>((reinterpret_cast<uintptr_t>(text) >> 3) & (CacheSize - 1));
+                uint16_t probes = CacheSize;
+
+                while ((_cache[index].Text != text) && (_cache[index].Text != nullptr) && (--probes != 0)) {
+                    index = (index + 1) & (CacheSize - 1);
+                }
+
+                if (_cache[index].Text == text) {
+                    result = _cache[index].Identifier;
+                } else {
+                    result = TraceRecorder::Instance().Intern(text);
+
+                    if (_cache[index].Text == nullptr) {
+                        _cache[index].Text = text;
+                        _cache[index].Identifier = result;
+                    }
+                }
+
+                return (result);
+            }
+
+            bool Write(const uint8_t data[], const uint16_t length);
+            uint16_t Read(uint8_t data[], const uint16_t maxLength);
+
+        private:
+            static constexpr uint16_t CacheSize = 512;
+
+            struct Interned {
+                const char* Text;
+                uint16_t Identifier;
+            };
+
+            uint8_t* _buffer;
+            const uint32_t _mask;
+            const uint32_t _thread;
+            std::atomic<uint32_t> _head;
+            std::atomic<uint32_t> _tail;
+            std::atomic<uint32_t> _dropped;
+            std::atomic<bool> _closed;
+            Interned _cache[CacheSize];
+        };
+
+        // length(2) - clock ticks (8) - line number (4) - file/class/module/category/format (5 x 2)
+        static constexpr uint16_t HeaderSize = 2 + 8 + 4 + (5 * 2);
+
+        class Frame {
+        public:
+            Frame() = delete;
+            Frame(const Frame&) = delete;
+            Frame& operator=(const Frame&) = delete;
+
+            Frame(const uint16_t offset)
+                : _length(offset)
+                , _truncated(false)
+            {
+            }
+            ~Frame()
+            {
+            }
+
+        public:
+            inline uint8_t* Data()
+            {
+                return (_data);
+            }
+            inline uint16_t Length() const
+            {
+                return (_length);
+            }
+            template <typename TYPE>
+            inline void Set(const uint16_t offset, const TYPE value)
+            {
+                ::memcpy(&(_data[offset]), &value, sizeof(TYPE));
+            }
+            inline void Push()
+            {
+            }
+            template <typename FIRST, typename... REST>
+            inline void Push(const FIRST& first, const REST&... rest)
+            {
+                Add(first);
+                Push(rest...);
+            }
+            // The last byte is kept for this marker, so an overflow always shows up in the formatted trace.
+            inline void Complete()
+            {
+                if (_truncated == true) {
+                    _data[_length++] = TRUNCATED;
+                }
+            }
+
+        private:
+            template <typename TYPE>
+            inline typename std::enable_if<std::is_integral<TYPE>::value && std::is_signed<TYPE>::value>::type
+            Add(const TYPE value)
+            {
+                Append(SIGNED, static_cast<int64_t>(value));
+            }
+            template <typename TYPE>
+            inline typename std::enable_if<std::is_integral<TYPE>::value && !std::is_signed<TYPE>::value>::type
+            Add(const TYPE value)
+            {
+                Append(UNSIGNED, static_cast<uint64_t>(value));
+            }
+            template <typename TYPE>
+            inline typename std::enable_if<std::is_enum<TYPE>::value>::type
+            Add(const TYPE value)
+            {
+                Append(SIGNED, static_cast<int64_t>(value));
+            }
+            template <typename TYPE>
+            inline typename std::enable_if<std::is_floating_point<TYPE>::value>::type
+            Add(const TYPE value)
+            {
+                Append(REAL, static_cast<double>(value));
+            }
+            template <typename TYPE>
+            inline void Add(const TYPE* value)
+            {
+                Append(POINTER, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+            }
+            inline void Add(const char* value)
+            {
+                AppendText(value == nullptr ? "(null)" : value, (value == nullptr ? 6 : ::strlen(value)));
+            }
+            inline void Add(char* value)
+            {
+                Add(static_cast<const char*>(value));
+            }
+            inline void Add(const string& value)
+            {
+                AppendText(value.c_str(), value.length());
+            }
+            template <typename TYPE>
+            inline void Append(const argument type, const TYPE value)
+            {
+                if ((_truncated == false) && ((_length + 1 + sizeof(TYPE)) < sizeof(_data))) {
+                    _data[_length] = type;
+                    ::memcpy(&(_data[_length + 1]), &value, sizeof(TYPE));
+                    _length += (1 + sizeof(TYPE));
+                } else {
+                    _truncated = true;
+                }
+            }
+            void AppendText(const char text[], const size_t length);
+
+        private:
+            uint16_t _length;
+            bool _truncated;
+            uint8_t _data[TRACINGBUFFERSIZE];
+        };
+
+    public:
+        // Keeps the location of a trace, so the arguments of the TRACE_DEFERRED macro can follow it.
+        class Entry {
+        public:
+            Entry() = delete;
+            Entry(const Entry&) = delete;
+            Entry& operator=(const Entry&) = delete;
+
+            Entry(const char file[], const uint32_t lineNumber, const char className[], const char module[], const char category[])
+                : _file(file)
+                , _lineNumber(lineNumber)
+                , _className(className)
+                , _module(module)
+                , _category(category)
+            {
+            }
+            ~Entry()
+            {
+            }
+
+        public:
+            template <typename... ARGUMENTS>
+            void Record(const char format[], const ARGUMENTS&... arguments)
+            {
+                Ring& ring(TraceRecorder::Instance().Current());
+                Frame frame(HeaderSize);
+
+                frame.Push(arguments...);
+                frame.Complete();
+
+                frame.Set<uint16_t>(0, frame.Length());
+                frame.Set<uint64_t>(2, Core::Time::Now().Ticks());
+                frame.Set<uint32_t>(10, _lineNumber);
+                frame.Set<uint16_t>(14, ring.Identifier(_file));
+                frame.Set<uint16_t>(16, ring.Identifier(_className));
+                frame.Set<uint16_t>(18, ring.Identifier(_module));
+                frame.Set<uint16_t>(20, ring.Identifier(_category));
+                frame.Set<uint16_t>(22, ring.Identifier(format));
+
+                ring.Write(frame.Data(), frame.Length());
+            }
+
+        private:
+            const char* _file;
+            const uint32_t _lineNumber;
+            const char* _className;
+            const char* _module;
+            const char* _category;
+        };
+
+    private:
+        TraceRecorder(const TraceRecorder&) = delete;
+        TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    protected:
+        TraceRecorder();
+
+    public:
+        virtual ~TraceRecorder();
+
+    public:
+        static TraceRecorder& Instance();
+
+        // The size of the ring of a thread, takes effect for the threads that record their first
+        // trace after opening.
+        uint32_t Open(const uint32_t bufferSize = DefaultBufferSize);
+        uint32_t Close();
+
+        inline bool IsOpen() const
+        {
+            return (_open.load(std::memory_order_relaxed));
+        }
+
+        // Formats and hands out all recorded traces, per thread in the order they were recorded.
+        uint32_t Flush(IConsumer& consumer);
+        uint32_t Dropped() const;
+
+    private:
+        class LocalRing;
+
+        Ring& Current();
+        uint16_t Intern(const char text[]);
+
+        static void Format(string& destination, const string& format, const uint8_t arguments[], const uint16_t length);
+        static void Append(string& destination, const string& specification, const uint8_t type, const uint8_t value[], const uint16_t length);
+
+    private:
+        mutable Core::CriticalSection _adminLock;
+        std::atomic<bool> _open;
+        uint32_t _bufferSize;
+        std::list<Core::ProxyType<Ring>> _rings;
+        uint32_t _threads;
+        std::unordered_map<const char*, uint16_t> _identifiers;
+        std::vector<string> _texts;
+        uint32_t _dropped;
+
+        static thread_local LocalRing _localRing;
+    };
+}
+} // namespace Trace
+
+#endif // __TRACERECORDER_H
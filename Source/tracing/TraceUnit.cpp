@@ -1,5 +1,6 @@
 #include "TraceUnit.h"
 #include "TraceCategories.h"
+#include "TraceRecorder.h"
 #include "Logging.h"
 
 #define TRACE_CYCLIC_BUFFER_FILENAME _T("TRACE_FILENAME")
@@ -359,20 +360,58 @@ namespace Trace {
 
     void TraceUnit::Trace(const char file[], const uint32_t lineNumber, const char className[], const ITrace* const information)
     {
-        const char* fileName(Core::FileNameOnly(file));
+        m_Admin.Lock();
+
+        if ((m_OutputChannel != nullptr) || (m_DirectOut == true)) {
+            Write(Core::Time::Now().Ticks(), Core::FileNameOnly(file), lineNumber, className, information->Module(), information->Category(), information->Data(), information->Length());
+        }
+
+        m_Admin.Unlock();
+    }
+
+    uint32_t TraceUnit::Flush()
+    {
+        class Consumer : public TraceRecorder::IConsumer {
+        public:
+            Consumer() = delete;
+            Consumer(const Consumer&) = delete;
+            Consumer& operator=(const Consumer&) = delete;
+
+            Consumer(TraceUnit& parent)
+                : _parent(parent)
+            {
+            }
+            ~Consumer() override
+            {
+            }
+
+        public:
+            void Trace(const uint64_t time, const uint32_t, const char file[], const uint32_t lineNumber, const char className[], const char module[], const char category[], const string& message) override
+            {
+                _parent.Write(time, Core::FileNameOnly(file), lineNumber, className, module, category, message.c_str(), static_cast<uint16_t>(message.length()));
+            }
+
+        private:
+            TraceUnit& _parent;
+        } consumer(*this);
 
         m_Admin.Lock();
 
+        uint32_t result = TraceRecorder::Instance().Flush(consumer);
+
+        m_Admin.Unlock();
+
+        return (result);
+    }
+
+    void TraceUnit::Write(const uint64_t current, const char fileName[], const uint32_t lineNumber, const char className[], const char module[], const char category[], const char data[], const uint16_t informationLength)
+    {
         if (m_OutputChannel != nullptr) {
 
-            const char* category(information->Category());
-            const char* module(information->Module());
-            const uint64_t current = Core::Time::Now().Ticks();
             const uint16_t fileNameLength = static_cast<uint16_t>(strlen(fileName) + 1); // File name.
             const uint16_t moduleLength = static_cast<uint16_t>(strlen(module) + 1); // Module.
             const uint16_t categoryLength = static_cast<uint16_t>(strlen(category) + 1); // Cateogory.
             const uint16_t classNameLength = static_cast<uint16_t>(strlen(className) + 1); // Class name.
-            const uint16_t informationLength = information->Length(); // Actual data (no '\0' needed).
 
             // Trace entry has been simplified: 16 bit size followed by fields:
             // length(2 bytes) - clock ticks (8 bytes) - line number (4 bytes) - file/module/category/className
@@ -395,25 +434,23 @@ namespace Trace {
 
                 if (actualLength >= fullLength) {
                     // We can write the whole information.
-                    m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(information->Data()), informationLength);
+                    m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(data), informationLength);
                 } else {
                     // Can only write information partially
                     const uint16_t dropLength = actualLength - headerLength;
 
-                    m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(information->Data()), dropLength);
+                    m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(data), dropLength);
                 }
             }
         }
 
         if (m_DirectOut == true) {
-            string time(Core::Time::Now().ToRFC1123(true));
+            string time(Core::Time(current).ToRFC1123(true));
             Core::TextFragment cleanClassName(Core::ClassNameOnly(className));
 
-            fprintf(stdout, "[%s]:[%s:%d]:[%s] %s: %s\n", time.c_str(), fileName, lineNumber, cleanClassName.Data(), information->Category(), information->Data());
+            fprintf(stdout, "[%s]:[%s:%d]:[%s] %s: %.*s\n", time.c_str(), fileName, lineNumber, cleanClassName.Data(), category, static_cast<int>(informationLength), data);
             fflush(stdout);
         }
-
-        m_Admin.Unlock();
     }
 }
 } // namespace WPEFramework::Trace
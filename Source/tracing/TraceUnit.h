@@ -193,6 +193,9 @@ namespace Trace {
 
         void Trace(const char fileName[], const uint32_t lineNumber, const char className[], const ITrace* const information);
 
+        // Formats the traces kept by the TraceRecorder and writes them out as any other trace.
+        uint32_t Flush();
+
         inline Core::CyclicBuffer* CyclicBuffer()
         {
             return (m_OutputChannel);
@@ -234,6 +237,7 @@ namespace Trace {
             return (m_OutputChannel->IsValid() ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
         }
         void UpdateEnabledCategories(const Core::JSON::ArrayType<Setting::JSON>& info);
+        void Write(const uint64_t current, const char fileName[], const uint32_t lineNumber, const char className[], const char module[], const char category[], const char data[], const uint16_t informationLength);
 
         TraceControlList m_Categories;
         Core::CriticalSection m_Admin;
@@ -6,6 +6,7 @@
 #include "TraceCategories.h"
 #include "TraceControl.h"
 #include "TraceMedia.h"
+#include "TraceRecorder.h"
 #include "TraceUnit.h"
 
 #ifdef __WINDOWS__
@@ -54,6 +54,10 @@ namespace JSONRPC {
                     {
                         return (!operator==(rhs));
                     }
+                    const LinkType<INTERFACE>* Key() const
+                    {
+                        return (_client);
+                    }
     
                 public:
                     uint64_t Timed(const uint64_t scheduledTime) {
@@ -101,7 +105,7 @@ namespace JSONRPC {
     
             private:
                 Core::ProxyPoolType<Core::JSONRPC::Message> _jsonRPCFactory;
-                Core::TimerType<WatchDog> _watchDog;
+                Core::TimerWheelType<WatchDog> _watchDog;
             };
     
             class ChannelImpl : public Core::StreamJSONType<Web::WebSocketClientType<Core::SocketStream>, FactoryImpl&, INTERFACE> {
@@ -1127,8 +1131,8 @@ namespace JSONRPC {
                     // Looks like this is an event.
                     ASSERT(inbound->Id.IsSet() == false);
 
-                    string response;
-                    _handler.Invoke(Core::JSONRPC::Connection(~0, ~0), inbound->FullMethod(), inbound->Parameters.Value(), response);
+                    Core::JSON::String response(false);
+                    _handler.Invoke(Core::JSONRPC::Connection(~0, ~0), inbound->FullMethod(), inbound->Parameters, response);
                 }
             }
 
@@ -204,13 +204,13 @@ namespace Web {
                 return (*this);
             }
             // Methods to extract and insert data into the socket buffers
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
             {
                 _activity = true;
                 return (_parent.SendData(_parent, dataFrame, maxSendSize));
             }
 
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+            virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
             {
                 _activity = true;
                 return (_parent.ReceiveData(_parent, dataFrame, receivedSize));
@@ -392,31 +392,31 @@ namespace Web {
         typedef hasTransform<TRANSFORM, uint16_t (TRANSFORM::*)(BaseSerializer&, uint8_t* data, const uint16_t maxSize)> TraitSerializer;
 
         template <typename CLASSNAME>
-        inline typename Core::TypeTraits::enable_if<CLASSNAME::TraitDeserializer::value, uint16_t>::type
-        ReceiveData(const CLASSNAME&, uint8_t* dataFrame, const uint16_t receivedSize)
+        inline typename Core::TypeTraits::enable_if<CLASSNAME::TraitDeserializer::value, uint32_t>::type
+        ReceiveData(const CLASSNAME&, uint8_t* dataFrame, const uint32_t receivedSize)
         {
-            return (_transformer.Transform(_deserialiserImpl, dataFrame, receivedSize));
+            return (_transformer.Transform(_deserialiserImpl, dataFrame, static_cast<uint16_t>(receivedSize > 0xFFFF ? 0xFFFF : receivedSize)));
         }
 
         template <typename CLASSNAME>
-        inline typename Core::TypeTraits::enable_if<!CLASSNAME::TraitDeserializer::value, uint16_t>::type
-        ReceiveData(const CLASSNAME&, uint8_t* dataFrame, const uint16_t receivedSize)
+        inline typename Core::TypeTraits::enable_if<!CLASSNAME::TraitDeserializer::value, uint32_t>::type
+        ReceiveData(const CLASSNAME&, uint8_t* dataFrame, const uint32_t receivedSize)
         {
-            return (_deserialiserImpl.Deserialize(dataFrame, receivedSize));
+            return (_deserialiserImpl.Deserialize(dataFrame, static_cast<uint16_t>(receivedSize > 0xFFFF ? 0xFFFF : receivedSize)));
         }
 
         template <typename CLASSNAME>
-        inline typename Core::TypeTraits::enable_if<CLASSNAME::TraitSerializer::value, uint16_t>::type
-        SendData(const CLASSNAME&, uint8_t* dataFrame, const uint16_t receivedSize)
+        inline typename Core::TypeTraits::enable_if<CLASSNAME::TraitSerializer::value, uint32_t>::type
+        SendData(const CLASSNAME&, uint8_t* dataFrame, const uint32_t receivedSize)
         {
-            return (_transformer.Transform(_serializerImpl, dataFrame, receivedSize));
+            return (_transformer.Transform(_serializerImpl, dataFrame, static_cast<uint16_t>(receivedSize > 0xFFFF ? 0xFFFF : receivedSize)));
         }
 
         template <typename CLASSNAME>
-        inline typename Core::TypeTraits::enable_if<!CLASSNAME::TraitSerializer::value, uint16_t>::type
-        SendData(const CLASSNAME&, uint8_t* dataFrame, const uint16_t receivedSize)
+        inline typename Core::TypeTraits::enable_if<!CLASSNAME::TraitSerializer::value, uint32_t>::type
+        SendData(const CLASSNAME&, uint8_t* dataFrame, const uint32_t receivedSize)
         {
-            return (_serializerImpl.Serialize(dataFrame, receivedSize));
+            return (_serializerImpl.Serialize(dataFrame, static_cast<uint16_t>(receivedSize > 0xFFFF ? 0xFFFF : receivedSize)));
         }
 
     private:
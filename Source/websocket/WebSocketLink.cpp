@@ -1,5 +1,11 @@
 #include "WebSocketLink.h"
 
+#if defined(__GNUC__) && defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace WPEFramework {
 namespace Web {
     namespace WebSocket {
@@ -23,6 +29,103 @@ namespace Web {
         static const uint8_t CONTROL_FRAME = 0x08;
         static const uint8_t HandShakeKey[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
 
+        // All block variants work from the end to the front, every block is loaded before it is
+        // stored, so a destination after the source is never overwritten before it is read. They
+        // return the number of bytes at the front that did not fill a block.
+#if defined(__GNUC__) && defined(__SSE2__)
+        static uint32_t MaskSSE2(uint8_t destination[], const uint8_t source[], uint32_t length, const uint32_t mask)
+        {
+            const uint32_t head = (length & 0xF);
+            const __m128i pattern = _mm_set1_epi32(static_cast<int>(mask));
+
+            while (length > head) {
+                length -= 16;
+                const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[length]));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&destination[length]), _mm_xor_si128(value, pattern));
+            }
+
+            return (head);
+        }
+
+        __attribute__((target("avx2"))) static uint32_t MaskAVX2(uint8_t destination[], const uint8_t source[], uint32_t length, const uint32_t mask)
+        {
+            const uint32_t head = (length & 0x1F);
+            const __m256i pattern = _mm256_set1_epi32(static_cast<int>(mask));
+
+            while (length > head) {
+                length -= 32;
+                const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&source[length]));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&destination[length]), _mm256_xor_si256(value, pattern));
+            }
+
+            _mm256_zeroupper();
+
+            return (head);
+        }
+
+        static bool HasAVX2()
+        {
+            static const bool supported = (__builtin_cpu_supports("avx2") != 0);
+
+            return (supported);
+        }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        static uint32_t MaskNEON(uint8_t destination[], const uint8_t source[], uint32_t length, const uint32_t mask)
+        {
+            const uint32_t head = (length & 0xF);
+            const uint8x16_t pattern = vreinterpretq_u8_u32(vdupq_n_u32(mask));
+
+            while (length > head) {
+                length -= 16;
+                vst1q_u8(&destination[length], veorq_u8(vld1q_u8(&source[length]), pattern));
+            }
+
+            return (head);
+        }
+#else
+        static uint32_t MaskWords(uint8_t destination[], const uint8_t source[], uint32_t length, const uint32_t mask)
+        {
+            const uint32_t head = (length & 0x3);
+
+            while (length > head) {
+                uint32_t value;
+
+                length -= 4;
+                ::memcpy(&value, &source[length], 4);
+                value ^= mask;
+                ::memcpy(&destination[length], &value, 4);
+            }
+
+            return (head);
+        }
+#endif
+
+        /* static */ void Protocol::Mask(uint8_t destination[], const uint8_t source[], const uint32_t length, const uint8_t key[4], const uint8_t offset)
+        {
+            // Blocks are a multiple of 4 bytes, so all blocks start at the same position in the key,
+            // the one of the first byte after the bytes that are left over at the front.
+            const uint8_t start = static_cast<uint8_t>(offset + length);
+            const uint8_t pattern[4] = { key[start & 0x3], key[(start + 1) & 0x3], key[(start + 2) & 0x3], key[(start + 3) & 0x3] };
+            uint32_t mask;
+            uint32_t head;
+
+            ::memcpy(&mask, pattern, 4);
+
+#if defined(__GNUC__) && defined(__SSE2__)
+            head = (HasAVX2() == true ? MaskAVX2(destination, source, length, mask) : MaskSSE2(destination, source, length, mask));
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+            head = MaskNEON(destination, source, length, mask);
+#else
+            head = MaskWords(destination, source, length, mask);
+#endif
+
+            // The bytes left over at the front, again from back to front.
+            while (head != 0) {
+                head--;
+                destination[head] = (source[head] ^ key[(offset + head) & 0x3]);
+            }
+        }
+
         std::string Protocol::RequestKey() const
         {
             string baseEncodedKey;
@@ -82,15 +185,7 @@ namespace Web {
                     maskKey[3] = (value >> 24) & 0xFF;
 
                     // Mask and insert the bytes on the right spots
-                    uint8_t* source = &dataFrame[usedSize - 1 + 4];
-                    uint8_t* destination = &dataFrame[usedSize - 1 + 4 + result];
-                    uint32_t bytesToMove = usedSize;
-
-                    while (bytesToMove != 0) {
-                        bytesToMove--;
-                        *destination-- = (*source ^ maskKey[(bytesToMove & 0x3)]);
-                        source--;
-                    }
+                    Mask(&dataFrame[4 + result], &dataFrame[4], usedSize, maskKey, 0);
 
                     // Now there is space again, write down the encryption key.
                     ::memcpy(&dataFrame[result], &maskKey, 4);
@@ -150,18 +245,14 @@ namespace Web {
                 // Just unscramble, what is left...
                 if ((_progressInfo & 0x20) == 0x20) {
                     // looks like we need to unscramble..
-                    uint8_t* source = dataFrame;
-
                     if (_pendingReceiveBytes < receivedSize) {
                         receivedSize = _pendingReceiveBytes;
                     }
 
-                    while (_pendingReceiveBytes != 0) {
-                        *source = (*source ^ _scrambleKey[(_progressInfo & 0x3)]);
-                        source++;
-                        _progressInfo = ((_progressInfo + 1) & 0x03) | (_progressInfo & 0xFC);
-                        _pendingReceiveBytes--;
-                    }
+                    Mask(dataFrame, dataFrame, receivedSize, _scrambleKey, (_progressInfo & 0x3));
+
+                    _progressInfo = ((_progressInfo + receivedSize) & 0x03) | (_progressInfo & 0xFC);
+                    _pendingReceiveBytes -= receivedSize;
                 } else {
                     if (_pendingReceiveBytes > receivedSize) {
                         _pendingReceiveBytes -= receivedSize;
@@ -241,14 +332,9 @@ namespace Web {
                             _progressInfo |= 0x20;
                             _progressInfo &= (~0x03);
 
-                            uint8_t* source = &dataFrame[actualHeader];
+                            Mask(&dataFrame[actualHeader], &dataFrame[actualHeader], bytesToMove, _scrambleKey, 0);
 
-                            while (bytesToMove != 0) {
-                                *source = (*source ^ _scrambleKey[(_progressInfo & 0x3)]);
-                                source++;
-                                bytesToMove--;
-                                _progressInfo = ((_progressInfo + 1) & 0xF3);
-                            }
+                            _progressInfo |= (bytesToMove & 0x03);
                         }
                     }
                 }
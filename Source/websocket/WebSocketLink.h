@@ -103,6 +103,11 @@ namespace Web {
             uint16_t Encoder(uint8_t* dataFrame, const uint16_t maxSendSize, const uint16_t usedSize);
             uint16_t Decoder(uint8_t* dataFrame, uint16_t& receivedSize);
 
+            // XOR's length bytes with the mask, the first byte with key[offset & 0x3]. The destination
+            // may be the source (unmasking in place) or lie after it (masking and moving the payload
+            // behind the header in one go), not before it.
+            static void Mask(uint8_t destination[], const uint8_t source[], const uint32_t length, const uint8_t key[4], const uint8_t offset);
+
         private:
             uint8_t _setFlags;
             uint8_t _progressInfo;
@@ -722,9 +727,9 @@ namespace Web {
             }
 
             // Methods to extract and insert data into the socket buffers
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
             {
-                uint16_t result = 0;
+                uint32_t result = 0;
 
                 _adminLock.Lock();
 
@@ -732,12 +737,15 @@ namespace Web {
 
                 if ((_state & WEBSOCKET) != 0) {
                     if (maxSendSize > 4) {
-                        result = _parent.SendData(&(dataFrame[4]), (maxSendSize - 4));
+                        // The framing uses at most a 16 bits payload length, larger buffers go out as continuation frames.
+                        const uint16_t payload = static_cast<uint16_t>((maxSendSize - 4) > 0xFFFF ? 0xFFFF : (maxSendSize - 4));
 
-                        result = _handler.Encoder(dataFrame, (maxSendSize - 4), result);
+                        result = _parent.SendData(&(dataFrame[4]), payload);
+
+                        result = _handler.Encoder(dataFrame, payload, static_cast<uint16_t>(result));
                     }
                 } else {
-                    result = _serializerImpl.Serialize(dataFrame, maxSendSize);
+                    result = _serializerImpl.Serialize(dataFrame, static_cast<uint16_t>(maxSendSize > 0xFFFF ? 0xFFFF : maxSendSize));
                 }
 
                 _adminLock.Unlock();
@@ -748,9 +756,9 @@ namespace Web {
 
                 return (result);
             }
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+            virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
             {
-                uint16_t result = 0;
+                uint32_t result = 0;
 
                 _adminLock.Lock();
 
@@ -761,7 +769,7 @@ namespace Web {
 
                     // check for multiple messages if available...
                     while ((result < receivedSize) && (tooSmall == false)) {
-                        uint16_t actualDataSize = receivedSize - result;
+                        uint16_t actualDataSize = static_cast<uint16_t>((receivedSize - result) > 0xFFFF ? 0xFFFF : (receivedSize - result));
                         uint16_t headerSize = _handler.Decoder(const_cast<uint8_t*>(&dataFrame[result]), actualDataSize);
 
                         tooSmall = ((headerSize == 0) && (actualDataSize == 0));
@@ -815,7 +823,7 @@ namespace Web {
                         }
                     }
                 } else {
-                    result = _deserialiserImpl.Deserialize(dataFrame, receivedSize);
+                    result = _deserialiserImpl.Deserialize(dataFrame, static_cast<uint16_t>(receivedSize > 0xFFFF ? 0xFFFF : receivedSize));
                 }
 
                 _adminLock.Unlock();
@@ -1259,8 +1267,8 @@ namespace Web {
         virtual void LinkBody(Core::ProxyType<INBOUND>& element) = 0;
         virtual void Received(Core::ProxyType<INBOUND>& element) = 0;
         virtual void Send(const Core::ProxyType<OUTBOUND>& element) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) = 0;
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) = 0;
         virtual void StateChange() = 0;
         virtual bool IsIdle() const = 0;
 
@@ -1367,11 +1375,11 @@ namespace Web {
             }
 
         public:
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
             {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+            virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -1545,8 +1553,8 @@ namespace Web {
 
         virtual bool IsIdle() const = 0;
         virtual void StateChange() = 0;
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) = 0;
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) = 0;
 
     private:
         Handler<LINK> _channel;
@@ -1619,11 +1627,11 @@ namespace Web {
             }
 
         public:
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
             {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+            virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -1783,8 +1791,8 @@ namespace Web {
 
         virtual bool IsIdle() const = 0;
         virtual void StateChange() = 0;
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) = 0;
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) = 0;
 
     private:
         Handler<LINK> _channel;
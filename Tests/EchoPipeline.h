@@ -0,0 +1,154 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <atomic>
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // Parameter: the value to echo in the lower 16 bits, the time (ms) the server works on it in the upper 16 bits.
+    typedef Core::IPCMessageType<10, Core::IPC::ScalarType<uint32_t>, Core::IPC::ScalarType<uint32_t>> EchoMessage;
+
+    class EchoJob : public Core::IDispatch {
+    public:
+        EchoJob() = delete;
+        EchoJob(const EchoJob&) = delete;
+        EchoJob& operator=(const EchoJob&) = delete;
+
+        EchoJob(Core::IPCChannel* channel, const Core::ProxyType<Core::IIPC>* message)
+            : _channel(*channel)
+            , _message(*message)
+        {
+        }
+        ~EchoJob() override
+        {
+        }
+
+    public:
+        void Dispatch() override
+        {
+            Core::ProxyType<EchoMessage> echo(_message);
+            uint32_t value = echo->Parameters().Value();
+
+            // Pretend the out-of-process plugin is doing some work.
+            SleepMs(value >> 16);
+
+            echo->Response() = (value & 0xFFFF) + 1;
+            _channel->ReportResponse(_message);
+        }
+
+    private:
+        Core::ProxyType<Core::IPCChannel> _channel;
+        Core::ProxyType<Core::IIPC> _message;
+    };
+
+    class EchoServer : public Core::IIPCServer {
+    public:
+        EchoServer() = delete;
+        EchoServer(const EchoServer&) = delete;
+        EchoServer& operator=(const EchoServer&) = delete;
+
+        EchoServer(Core::WorkerPool* pool)
+            : _pool(*pool)
+        {
+        }
+        ~EchoServer() override
+        {
+        }
+
+    public:
+        void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& message) override
+        {
+            _pool.Submit(Core::ProxyType<Core::IDispatch>(Core::ProxyType<EchoJob>::Create(&source, &message)));
+        }
+
+    private:
+        Core::WorkerPool& _pool;
+    };
+
+    class PipelineSetup {
+    public:
+        PipelineSetup(const PipelineSetup&) = delete;
+        PipelineSetup& operator=(const PipelineSetup&) = delete;
+
+        PipelineSetup(const TCHAR connector[])
+            : _pool(0)
+            , _node(connector)
+            , _serverFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create())
+            , _clientFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create())
+            , _server(_node, 512, _serverFactory)
+            , _client(_node, 512, _clientFactory)
+        {
+            _pool.Run();
+            _serverFactory->CreateFactory<EchoMessage>(8);
+            _clientFactory->CreateFactory<EchoMessage>(8);
+            _server.Register(EchoMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<EchoServer>::Create(&_pool)));
+
+            EXPECT_EQ(_server.Open(1000), Core::ERROR_NONE);
+            EXPECT_EQ(_client.Source().Open(1000), Core::ERROR_NONE);
+        }
+        ~PipelineSetup()
+        {
+            EXPECT_EQ(_client.Close(1000), Core::ERROR_NONE);
+            _server.Cleanup();
+            _server.Unregister(EchoMessage::Id());
+            EXPECT_EQ(_server.Close(1000), Core::ERROR_NONE);
+            _pool.Stop();
+
+            _clientFactory->DestroyFactories();
+            _serverFactory->DestroyFactories();
+
+            // The next test, or a process forked by it, should not run into the reactor threads of this one.
+            Core::Singleton::Dispose();
+        }
+
+    public:
+        Core::IPCChannel& Client()
+        {
+            return (_client);
+        }
+        bool Call(const uint16_t value, const uint16_t delay)
+        {
+            Core::ProxyType<EchoMessage> message(Core::ProxyType<EchoMessage>::Create());
+
+            message->Parameters() = (static_cast<uint32_t>(delay) << 16) | value;
+
+            return ((_client.Invoke(message, 5000) == Core::ERROR_NONE) && (message->Response().Value() == static_cast<uint32_t>(value + 1)));
+        }
+
+        // Returns the number of calls that were answered correctly.
+        uint32_t Concurrent(const uint8_t callers, const uint32_t calls)
+        {
+            std::atomic<uint32_t> succeeded(0);
+            std::vector<std::thread> threads;
+
+            for (uint8_t index = 0; index < callers; index++) {
+                threads.emplace_back([this, index, calls, &succeeded]() {
+                    for (uint32_t call = 0; call < calls; call++) {
+                        if (Call(static_cast<uint16_t>((index << 8) | (call & 0xFF)), 1) == true) {
+                            succeeded++;
+                        }
+                    }
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+
+            return (succeeded.load());
+        }
+
+    private:
+        Core::WorkerPoolType<9> _pool;
+        Core::NodeId _node;
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> _serverFactory;
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> _clientFactory;
+        Core::IPCChannelServerType<Core::Void, false> _server;
+        Core::IPCChannelClientType<Core::Void, false, false> _client;
+    };
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <core/core.h>
+#include <com/com.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // The server side of a COM-RPC link, every request for the INTERFACE gets an IMPLEMENTATION of its own.
+    template <typename INTERFACE, typename IMPLEMENTATION>
+    class ExternalAccess : public RPC::Communicator {
+    private:
+        ExternalAccess() = delete;
+        ExternalAccess(const ExternalAccess&) = delete;
+        ExternalAccess& operator=(const ExternalAccess&) = delete;
+
+    public:
+        ExternalAccess(const Core::NodeId& source)
+            : RPC::Communicator(source, _T(""))
+        {
+            Open(Core::infinite);
+        }
+        ExternalAccess(const Core::NodeId& source, const Core::ProxyType<Core::IIPCServer>& handler)
+            : RPC::Communicator(source, _T(""), handler)
+        {
+            Open(Core::infinite);
+        }
+        ~ExternalAccess()
+        {
+            Close(Core::infinite);
+        }
+
+    private:
+        void* Aquire(const string& className VARIABLE_IS_NOT_USED, const uint32_t interfaceId, const uint32_t versionId VARIABLE_IS_NOT_USED) override
+        {
+            void* result = nullptr;
+
+            if (interfaceId == INTERFACE::ID) {
+                result = Core::Service<IMPLEMENTATION>::template Create<INTERFACE>();
+            }
+
+            return (result);
+        }
+    };
+
+    // The client side of a COM-RPC link, with an invoke server of its own for the calls that come back.
+    inline Core::ProxyType<RPC::CommunicatorClient> ExternalClient(const Core::NodeId& remoteNode)
+    {
+        Core::ProxyType<RPC::InvokeServerType<4, 1>> engine(Core::ProxyType<RPC::InvokeServerType<4, 1>>::Create(Core::Thread::DefaultStackSize()));
+        Core::ProxyType<RPC::CommunicatorClient> client(Core::ProxyType<RPC::CommunicatorClient>::Create(remoteNode, Core::ProxyType<Core::IIPCServer>(engine)));
+
+        // The client holds on to the engine, it handles the announcements on it.
+        engine->Announcements(client->Announcement());
+
+        return (client);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <atomic>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint8_t g_poolThreads = 4;
+    const uint32_t g_stormJobs = 20000;
+    const TCHAR g_jsonrpcRequest[] = _T("{\"jsonrpc\":\"2.0\",\"id\":42,\"method\":\"Controller.1.activate\",\"params\":{\"callsign\":\"WebKitBrowser\"}}");
+
+    // Mimics a JSON-RPC invoke (parse a request) and a COM-RPC invoke (a job that schedules a follow-up
+    // job from within the pool, like a stub calling back into a proxy).
+    class StormJob : public Core::IDispatch {
+    public:
+        typedef std::function<void(const Core::ProxyType<Core::IDispatch>&)> Submitter;
+
+        StormJob() = delete;
+        StormJob(const StormJob&) = delete;
+        StormJob& operator=(const StormJob&) = delete;
+
+        StormJob(std::atomic<uint32_t>* counter, const Submitter& submitter, const uint8_t depth)
+            : _counter(*counter)
+            , _submitter(submitter)
+            , _depth(depth)
+        {
+        }
+        ~StormJob() override
+        {
+        }
+
+    public:
+        void Dispatch() override
+        {
+            if (_depth == 0) {
+                Core::JSONRPC::Message message;
+                message.FromString(string(g_jsonrpcRequest));
+                EXPECT_EQ(message.Id.Value(), 42u);
+            } else {
+                _submitter(Core::ProxyType<Core::IDispatch>(Core::ProxyType<StormJob>::Create(&_counter, _submitter, _depth - 1)));
+            }
+            _counter++;
+        }
+
+    private:
+        std::atomic<uint32_t>& _counter;
+        Submitter _submitter;
+        uint8_t _depth;
+    };
+
+    static inline bool WaitFor(const std::atomic<uint32_t>& counter, const uint32_t expected)
+    {
+        uint32_t timeout = 30000;
+        while ((counter.load() < expected) && (timeout != 0)) {
+            SleepMs(1);
+            timeout--;
+        }
+        return (counter.load() == expected);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <core/core.h>
+
+#include <atomic>
+#include <sys/socket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint32_t g_streamMessages = 20000;
+    const uint8_t g_streamMessageSize = 40;
+
+    // Both ends of a socketpair, one queues fixed size messages, the other one checks their order.
+    class StreamEnd : public Core::SocketStream {
+    public:
+        StreamEnd() = delete;
+        StreamEnd(const StreamEnd&) = delete;
+        StreamEnd& operator=(const StreamEnd&) = delete;
+
+        StreamEnd(const SOCKET connector, const uint32_t sendBufferSize, const uint32_t receiveBufferSize)
+            : Core::SocketStream(false, connector, Core::NodeId(_T("/tmp/streamend")), sendBufferSize, receiveBufferSize)
+            , _lock()
+            , _queued(0)
+            , _sent(0)
+            , _received(0)
+            , _sendCalls(0)
+            , _outOfOrder(false)
+            , _closeWhenIdle(false)
+        {
+        }
+        ~StreamEnd() override
+        {
+            Close(Core::infinite);
+        }
+
+    public:
+        void Queue(const uint32_t messages)
+        {
+            _lock.Lock();
+            _queued += messages;
+            _lock.Unlock();
+
+            Trigger();
+        }
+        uint32_t Received() const
+        {
+            return (_received.load());
+        }
+        uint32_t SendCalls() const
+        {
+            return (_sendCalls.load());
+        }
+        bool OutOfOrder() const
+        {
+            return (_outOfOrder.load());
+        }
+        // Like a websocket, close the link from within SendData() once all messages are handed out.
+        void CloseWhenIdle()
+        {
+            _closeWhenIdle = true;
+        }
+
+        uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
+        {
+            uint32_t result = 0;
+
+            _lock.Lock();
+
+            if ((_sent < _queued) && (maxSendSize >= g_streamMessageSize)) {
+                // A message is only handed out as a whole, "<sequence>" padded with spaces.
+                ::memset(dataFrame, ' ', g_streamMessageSize);
+                string sequence(Core::NumberType<uint32_t>(_sent).Text());
+                ::memcpy(dataFrame, sequence.c_str(), sequence.length());
+                result = g_streamMessageSize;
+                _sent++;
+                _sendCalls++;
+            }
+
+            bool close = ((result == 0) && (_closeWhenIdle == true) && (_sent == _queued));
+
+            _lock.Unlock();
+
+            if (close == true) {
+                Close(0);
+            }
+
+            return (result);
+        }
+        uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override
+        {
+            uint32_t handled = 0;
+
+            // Leave partial messages in the socket buffer, they are completed by the next read.
+            while ((receivedSize - handled) >= g_streamMessageSize) {
+                string text(reinterpret_cast<const char*>(&dataFrame[handled]), g_streamMessageSize);
+                uint32_t sequence = Core::NumberType<uint32_t>(Core::TextFragment(text, 0, static_cast<uint32_t>(text.find(' ')))).Value();
+
+                if (sequence != _received.load()) {
+                    _outOfOrder = true;
+                }
+                _received++;
+                handled += g_streamMessageSize;
+            }
+
+            return (handled);
+        }
+        void StateChange() override
+        {
+        }
+
+    private:
+        Core::CriticalSection _lock;
+        uint32_t _queued;
+        uint32_t _sent;
+        std::atomic<uint32_t> _received;
+        std::atomic<uint32_t> _sendCalls;
+        std::atomic<bool> _outOfOrder;
+        std::atomic<bool> _closeWhenIdle;
+    };
+
+} // Tests
+} // WPEFramework
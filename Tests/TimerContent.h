@@ -0,0 +1,85 @@
+#pragma once
+
+#include <core/core.h>
+
+#include <atomic>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint32_t g_timerEntries = 10000;
+
+    struct TimerRecord {
+        TimerRecord()
+            : fired(0)
+            , early(false)
+            , repeat(0)
+        {
+        }
+
+        std::atomic<uint32_t> fired;
+        std::atomic<bool> early;
+        uint8_t repeat;
+    };
+
+    // Counts how often it fired, and remembers if it ever fired before it was due. It reschedules itself
+    // "repeat" times.
+    class TimerContent {
+    public:
+        TimerContent()
+            : _record(nullptr)
+        {
+        }
+        TimerContent(TimerRecord* record)
+            : _record(record)
+        {
+        }
+        TimerContent(const TimerContent& copy)
+            : _record(copy._record)
+        {
+        }
+        ~TimerContent()
+        {
+        }
+
+        TimerContent& operator=(const TimerContent& RHS)
+        {
+            _record = RHS._record;
+
+            return (*this);
+        }
+
+    public:
+        bool operator==(const TimerContent& RHS) const
+        {
+            return (_record == RHS._record);
+        }
+        bool operator!=(const TimerContent& RHS) const
+        {
+            return (!operator==(RHS));
+        }
+        const TimerRecord* Key() const
+        {
+            return (_record);
+        }
+        uint64_t Timed(const uint64_t scheduledTime)
+        {
+            uint64_t result = 0;
+            uint64_t now = Core::Time::Now().Ticks();
+
+            if (now < scheduledTime) {
+                _record->early = true;
+            }
+            if (_record->fired.fetch_add(1) < _record->repeat) {
+                result = now + (2 * Core::Time::TicksPerMillisecond);
+            }
+
+            return (result);
+        }
+
+    private:
+        TimerRecord* _record;
+    };
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint32_t g_crcBufferSize = 4096;
+    const uint32_t g_crcRounds = 2000;
+
+    TEST(Benchmark_DataElement, CRC32)
+    {
+        uint32_t table[256];
+        uint8_t buffer[g_crcBufferSize];
+        uint32_t bytewise = 0;
+        uint32_t current = 0;
+
+        for (uint32_t index = 0; index < sizeof(buffer); index++) {
+            buffer[index] = static_cast<uint8_t>(index * 31);
+        }
+
+        for (uint32_t index = 0; index < 256; index++) {
+            table[index] = (index << 24);
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                table[index] = (table[index] << 1) ^ ((table[index] & 0x80000000) != 0 ? 0x04C11DB7 : 0);
+            }
+        }
+
+        Core::DataElement element(sizeof(buffer), buffer);
+
+        // The loop CRC32() had, one table lookup per byte.
+        uint64_t start = Core::Time::Now().Ticks();
+        for (uint32_t round = 0; round < g_crcRounds; round++) {
+            uint32_t crc = 0xFFFFFFFF;
+            for (uint32_t index = 0; index < sizeof(buffer); index++) {
+                crc = (crc << 8) ^ table[((crc >> 24) ^ buffer[index]) & 0xff];
+            }
+            bytewise ^= crc;
+        }
+        const uint64_t reference = Core::Time::Now().Ticks() - start;
+
+        start = Core::Time::Now().Ticks();
+        for (uint32_t round = 0; round < g_crcRounds; round++) {
+            current ^= element.CRC32(0, sizeof(buffer));
+        }
+        const uint64_t optimized = Core::Time::Now().Ticks() - start;
+
+        EXPECT_EQ(current, bytewise);
+
+        const uint64_t bytes = static_cast<uint64_t>(g_crcRounds) * sizeof(buffer);
+        printf("CRC32 over %d x %d bytes: table per byte %d MB/s, CRC32() %d MB/s\n", g_crcRounds, g_crcBufferSize,
+            static_cast<uint32_t>(bytes / (reference == 0 ? 1 : reference)), static_cast<uint32_t>(bytes / (optimized == 0 ? 1 : optimized)));
+    }
+
+} // Tests
+} // WPEFramework
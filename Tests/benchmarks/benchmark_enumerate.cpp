@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint32_t g_enumerateLookups = 200000;
+
+    // The request header keywords as the web serializer knows them.
+    enum class BenchmarkHeader {
+        HOST,
+        UPGRADE,
+        ORIGIN,
+        CONNECTION,
+        ACCEPT,
+        ACCEPT_ENCODING,
+        USERAGENT,
+        CONTENT_TYPE,
+        CONTENT_ENCODING,
+        CONTENT_LENGTH,
+        CONTENT_SIGNATURE,
+        TRANSFER_ENCODING,
+        LANGUAGE,
+        ACCESS_CONTROL_REQUEST_METHOD,
+        ACCESS_CONTROL_REQUEST_HEADERS,
+        WEBSOCKET_KEY,
+        WEBSOCKET_PROTOCOL,
+        WEBSOCKET_VERSION,
+        MAN,
+        M_X,
+        S_T,
+        AUTHORIZATION,
+        ALIAS
+    };
+
+    // What EnumerateType did before it had an index: a scan through the table.
+    static const Core::EnumerateConversion<BenchmarkHeader>* Scan(const TCHAR value[], const bool caseSensitive)
+    {
+        uint16_t index = 0;
+        const Core::EnumerateConversion<BenchmarkHeader>* runner = Core::EnumerateType<BenchmarkHeader>::Entry(index);
+
+        while ((runner != nullptr) && ((caseSensitive ? _tcscmp(runner->name, value) : _tcsicmp(runner->name, value)) != 0)) {
+            runner = Core::EnumerateType<BenchmarkHeader>::Entry(++index);
+        }
+
+        return (runner);
+    }
+
+    TEST(Benchmark_Enumerate, ScanVersusIndex)
+    {
+        const TCHAR* headers[] = {
+            _T("host:"), _T("user-agent:"), _T("accept:"), _T("accept-encoding:"), _T("connection:"),
+            _T("content-type:"), _T("content-length:"), _T("authorization:"), _T("sec-websocket-key:"), _T("x-unknown:")
+        };
+        const uint32_t count = sizeof(headers) / sizeof(headers[0]);
+        uint32_t found = 0;
+
+        uint64_t start = Core::Time::Now().Ticks();
+        for (uint32_t index = 0; index < g_enumerateLookups; index++) {
+            found += (Scan(headers[index % count], false) != nullptr ? 1 : 0);
+        }
+        uint64_t scanned = Core::Time::Now().Ticks() - start;
+
+        start = Core::Time::Now().Ticks();
+        for (uint32_t index = 0; index < g_enumerateLookups; index++) {
+            found += (Core::EnumerateType<BenchmarkHeader>(headers[index % count], false).IsSet() ? 1 : 0);
+        }
+        uint64_t hashed = Core::Time::Now().Ticks() - start;
+
+        EXPECT_EQ(found, 2 * (g_enumerateLookups - (g_enumerateLookups / count)));
+
+        start = Core::Time::Now().Ticks();
+        for (uint32_t index = 0; index < g_enumerateLookups; index++) {
+            found += (Core::EnumerateType<BenchmarkHeader>(static_cast<BenchmarkHeader>(index % 22)).Data()[0] != '\0' ? 1 : 0);
+        }
+        uint64_t names = Core::Time::Now().Ticks() - start;
+
+        printf("Resolve %d header names: table scan %d us, hash index %d us; %d enum to name: %d us\n", g_enumerateLookups,
+            static_cast<uint32_t>(scanned), static_cast<uint32_t>(hashed), g_enumerateLookups, static_cast<uint32_t>(names));
+    }
+
+} // Tests
+
+ENUM_CONVERSION_BEGIN(Tests::BenchmarkHeader)
+
+    { Tests::BenchmarkHeader::HOST, _TXT("HOST:") },
+    { Tests::BenchmarkHeader::UPGRADE, _TXT("UPGRADE:") },
+    { Tests::BenchmarkHeader::ORIGIN, _TXT("ORIGIN:") },
+    { Tests::BenchmarkHeader::CONNECTION, _TXT("CONNECTION:") },
+    { Tests::BenchmarkHeader::ACCEPT, _TXT("ACCEPT:") },
+    { Tests::BenchmarkHeader::ACCEPT_ENCODING, _TXT("ACCEPT-ENCODING:") },
+    { Tests::BenchmarkHeader::USERAGENT, _TXT("USER-AGENT:") },
+    { Tests::BenchmarkHeader::CONTENT_TYPE, _TXT("CONTENT-TYPE:") },
+    { Tests::BenchmarkHeader::CONTENT_ENCODING, _TXT("CONTENT-ENCODING:") },
+    { Tests::BenchmarkHeader::CONTENT_LENGTH, _TXT("CONTENT-LENGTH:") },
+    { Tests::BenchmarkHeader::CONTENT_SIGNATURE, _TXT("CONTENT-HMAC:") },
+    { Tests::BenchmarkHeader::TRANSFER_ENCODING, _TXT("TRANSFER-ENCODING:") },
+    { Tests::BenchmarkHeader::LANGUAGE, _TXT("ACCEPT-LANGUAGE:") },
+    { Tests::BenchmarkHeader::ACCESS_CONTROL_REQUEST_METHOD, _TXT("ACCESS-CONTROL-REQUEST-METHOD:") },
+    { Tests::BenchmarkHeader::ACCESS_CONTROL_REQUEST_HEADERS, _TXT("ACCESS-CONTROL-REQUEST-HEADERS:") },
+    { Tests::BenchmarkHeader::WEBSOCKET_KEY, _TXT("SEC-WEBSOCKET-KEY:") },
+    { Tests::BenchmarkHeader::WEBSOCKET_PROTOCOL, _TXT("SEC-WEBSOCKET-PROTOCOL:") },
+    { Tests::BenchmarkHeader::WEBSOCKET_VERSION, _TXT("SEC-WEBSOCKET-VERSION:") },
+    { Tests::BenchmarkHeader::MAN, _TXT("MAN:") },
+    { Tests::BenchmarkHeader::M_X, _TXT("MX:") },
+    { Tests::BenchmarkHeader::S_T, _TXT("ST:") },
+    { Tests::BenchmarkHeader::AUTHORIZATION, _TXT("AUTHORIZATION:") },
+    { Tests::BenchmarkHeader::LANGUAGE, _TXT("LANGUAGE:") },
+    { Tests::BenchmarkHeader::ALIAS, _TXT("ACCEPT:") },
+
+ENUM_CONVERSION_END(Tests::BenchmarkHeader)
+
+} // WPEFramework
@@ -0,0 +1,31 @@
+#include "../EchoPipeline.h"
+
+namespace WPEFramework {
+namespace Tests {
+
+    const TCHAR g_pipelineConnector[] = _T("/tmp/benchmarkpipeline");
+    const uint32_t g_pipelineCalls = 200;
+
+    // Returns the calls per second all callers together reach.
+    static uint32_t Throughput(PipelineSetup& setup, const uint8_t callers)
+    {
+        uint64_t start = Core::Time::Now().Ticks();
+
+        EXPECT_EQ(setup.Concurrent(callers, g_pipelineCalls / callers), (g_pipelineCalls / callers) * callers);
+
+        uint64_t duration = Core::Time::Now().Ticks() - start;
+
+        return (static_cast<uint32_t>((static_cast<uint64_t>((g_pipelineCalls / callers) * callers) * Core::Time::TicksPerMillisecond * 1000) / (duration != 0 ? duration : 1)));
+    }
+
+    TEST(Benchmark_IPC, PipelinedThroughput)
+    {
+        PipelineSetup setup(g_pipelineConnector);
+
+        for (uint8_t callers = 1; callers <= 8; callers <<= 1) {
+            printf("COM-RPC over one channel, %d caller thread(s): %d calls/s\n", callers, Throughput(setup, callers));
+        }
+    }
+
+} // Tests
+} // WPEFramework
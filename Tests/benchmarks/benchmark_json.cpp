@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // A configuration/JSON-RPC payload like object with many members.
+    class WideJson : public Core::JSON::Container {
+    public:
+        WideJson(const WideJson&) = delete;
+        WideJson& operator=(const WideJson&) = delete;
+
+        WideJson(const uint8_t fields)
+            : Core::JSON::Container()
+            , _labels()
+            , _values(fields)
+        {
+            for (uint8_t index = 0; index < fields; index++) {
+                _labels.emplace_back(Label(index));
+            }
+            for (uint8_t index = 0; index < fields; index++) {
+                Add(_labels[index].c_str(), &(_values[index]));
+            }
+        }
+        ~WideJson() override
+        {
+        }
+
+    public:
+        static string Label(const uint8_t index)
+        {
+            // Shared prefixes, like real world member names.
+            return (_T("configuration") + Core::NumberType<uint8_t>(index).Text());
+        }
+        static string Serialized(const uint8_t fields)
+        {
+            string result(_T("{"));
+
+            // Reversed, so a linear lookup gets no help from the order.
+            for (uint8_t index = fields; index > 0; index--) {
+                result += '\"' + Label(index - 1) + _T("\":") + Core::NumberType<uint8_t>(index - 1).Text() + (index > 1 ? _T(",") : _T(""));
+            }
+
+            return (result + '}');
+        }
+        const Core::JSON::DecUInt32& Value(const uint8_t index) const
+        {
+            return (_values[index]);
+        }
+        void Drop(const uint8_t index)
+        {
+            Remove(_labels[index].c_str());
+        }
+
+    private:
+        std::vector<string> _labels;
+        std::vector<Core::JSON::DecUInt32> _values;
+    };
+
+    TEST(Benchmark_JSON, WideObject)
+    {
+        const uint32_t parses = 200;
+
+        for (uint16_t fields = 8; fields <= 128; fields <<= 1) {
+            WideJson object(static_cast<uint8_t>(fields));
+            const string serialized(WideJson::Serialized(static_cast<uint8_t>(fields)));
+            uint64_t start = Core::Time::Now().Ticks();
+
+            for (uint32_t loop = 0; loop < parses; loop++) {
+                object.Clear();
+                object.FromString(serialized);
+            }
+
+            uint64_t duration = Core::Time::Now().Ticks() - start;
+
+            printf("Parse an object with %3d fields: %d ns per field\n", fields,
+                static_cast<uint32_t>((duration * 1000) / (static_cast<uint64_t>(parses) * fields)));
+        }
+    }
+
+    TEST(Benchmark_JSON, LargeDocument)
+    {
+        const string entry(1000, 'a');
+
+        for (uint32_t entries = 1024; entries <= 4096; entries <<= 1) {
+            Core::JSON::ArrayType<Core::JSON::String> source;
+            Core::JSON::ArrayType<Core::JSON::String> target;
+            string serialized;
+
+            for (uint32_t index = 0; index < entries; index++) {
+                source.Add() = entry;
+            }
+
+            uint64_t start = Core::Time::Now().Ticks();
+            EXPECT_TRUE(source.ToString(serialized));
+            uint64_t serialize = Core::Time::Now().Ticks() - start;
+
+            start = Core::Time::Now().Ticks();
+            EXPECT_TRUE(target.FromString(serialized));
+            uint64_t deserialize = Core::Time::Now().Ticks() - start;
+
+            EXPECT_EQ(target.Length(), entries);
+            EXPECT_EQ(target[entries - 1].Value(), entry);
+
+            printf("Document of %d KB: serialize %d us, deserialize %d us\n", static_cast<uint32_t>(serialized.length() / 1024),
+                static_cast<uint32_t>(serialize), static_cast<uint32_t>(deserialize));
+        }
+    }
+
+} // Tests
+} // WPEFramework
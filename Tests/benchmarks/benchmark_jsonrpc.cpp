@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint32_t g_dispatchCalls = 20000;
+
+    class EchoParameters : public Core::JSON::Container {
+    public:
+        EchoParameters(const EchoParameters&) = delete;
+        EchoParameters& operator=(const EchoParameters&) = delete;
+
+        EchoParameters()
+            : Core::JSON::Container()
+            , Name()
+            , Count(0)
+        {
+            Add(_T("name"), &Name);
+            Add(_T("count"), &Count);
+        }
+        ~EchoParameters() override
+        {
+        }
+
+    public:
+        Core::JSON::String Name;
+        Core::JSON::DecUInt32 Count;
+    };
+
+    static uint32_t Echo(const EchoParameters& inbound, EchoParameters& outbound)
+    {
+        outbound.Name = inbound.Name.Value();
+        outbound.Count = inbound.Count.Value() + 1;
+
+        return (Core::ERROR_NONE);
+    }
+
+    TEST(Benchmark_JSONRPC, Dispatch)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, { 1 });
+        Core::JSONRPC::Message request;
+        Core::JSONRPC::Message response;
+        string parameters(_T("{\"name\":\""));
+
+        handler.Register<EchoParameters, EchoParameters>(_T("echo"), &Echo);
+
+        parameters += string(2048, 'x') + _T("\",\"count\":1}");
+        request.FromString(_T("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"Test.1.echo\",\"params\":") + parameters + _T("}"));
+
+        uint64_t start = Core::Time::Now().Ticks();
+        for (uint32_t index = 0; index < g_dispatchCalls; index++) {
+            // The string interface: parameters copied out of the message, the result copied into it.
+            string result;
+            handler.Invoke(Core::JSONRPC::Connection(1, 1), request.FullMethod(), request.Parameters.Value(), result);
+            response.Result = result;
+        }
+        uint64_t copied = Core::Time::Now().Ticks() - start;
+
+        start = Core::Time::Now().Ticks();
+        for (uint32_t index = 0; index < g_dispatchCalls; index++) {
+            handler.Invoke(Core::JSONRPC::Connection(1, 1), request.FullMethod(), request.Parameters, response.Result);
+        }
+        uint64_t direct = Core::Time::Now().Ticks() - start;
+
+        EXPECT_EQ(response.Result.Value().length(), parameters.length());
+
+        printf("Dispatch %d JSON-RPC calls of %d bytes: via strings %d us, from the message %d us\n", g_dispatchCalls,
+            static_cast<uint32_t>(parameters.length()), static_cast<uint32_t>(copied), static_cast<uint32_t>(direct));
+    }
+
+} // Tests
+} // WPEFramework
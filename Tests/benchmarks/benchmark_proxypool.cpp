@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint8_t g_poolThreads = 4;
+    const uint32_t g_poolRounds = 200000;
+
+    class BenchmarkElement {
+    public:
+        BenchmarkElement(const BenchmarkElement&) = delete;
+        BenchmarkElement& operator=(const BenchmarkElement&) = delete;
+
+        BenchmarkElement()
+            : Value(0)
+        {
+        }
+        ~BenchmarkElement()
+        {
+        }
+
+    public:
+        void Clear()
+        {
+            Value = 0;
+        }
+
+    public:
+        uint32_t Value;
+    };
+
+    // What ProxyPoolType did before it had magazines: every element taken and returned under the lock of the pool.
+    class LockedPool {
+    private:
+        class Pooled : public Core::ProxyObject<BenchmarkElement> {
+        public:
+            Pooled() = delete;
+            Pooled(const Pooled&) = delete;
+            Pooled& operator=(const Pooled&) = delete;
+
+            Pooled(LockedPool& pool)
+                : Core::ProxyObject<BenchmarkElement>()
+                , _pool(pool)
+            {
+            }
+            ~Pooled()
+            {
+            }
+
+        public:
+            uint32_t Release() const override
+            {
+                uint32_t result = Core::ERROR_NONE;
+
+                if (Core::InterlockedDecrement(m_RefCount) == 0) {
+                    Pooled* element(const_cast<Pooled*>(this));
+
+                    element->Clear();
+
+                    Core::ProxyType<Pooled> returned(static_cast<Core::IReferenceCounted*>(element), element);
+                    _pool.Return(returned);
+
+                    result = Core::ERROR_DESTRUCTION_SUCCEEDED;
+                }
+
+                return (result);
+            }
+
+        private:
+            LockedPool& _pool;
+        };
+
+    public:
+        LockedPool(const LockedPool&) = delete;
+        LockedPool& operator=(const LockedPool&) = delete;
+
+        LockedPool()
+            : _queue(2)
+            , _lock()
+        {
+        }
+        ~LockedPool()
+        {
+        }
+
+    public:
+        Core::ProxyType<BenchmarkElement> Element()
+        {
+            Core::ProxyType<BenchmarkElement> result;
+
+            _lock.Lock();
+
+            if (_queue.Count() == 0) {
+                _lock.Unlock();
+
+                Pooled* element(new (0) Pooled(*this));
+                result = Core::ProxyType<BenchmarkElement>(static_cast<Core::IReferenceCounted*>(element), element);
+            } else {
+                Core::ProxyType<Pooled> element;
+
+                _queue.Remove(0, element);
+
+                _lock.Unlock();
+
+                result = Core::proxy_cast<BenchmarkElement>(element);
+            }
+
+            return (result);
+        }
+
+    private:
+        void Return(Core::ProxyType<Pooled>& element)
+        {
+            _lock.Lock();
+            _queue.Add(element);
+            _lock.Unlock();
+        }
+
+    private:
+        Core::ProxyList<Pooled> _queue;
+        Core::CriticalSection _lock;
+    };
+
+    // Every thread keeps the last three elements it took, and returns the oldest one.
+    template <typename ACTION>
+    static uint64_t Threaded(ACTION action)
+    {
+        std::vector<std::thread> workers;
+
+        const uint64_t start = Core::Time::Now().Ticks();
+
+        for (uint8_t thread = 0; thread < g_poolThreads; thread++) {
+            workers.emplace_back(action);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        return (Core::Time::Now().Ticks() - start);
+    }
+
+    TEST(Benchmark_ProxyPool, LockedVersusMagazines)
+    {
+        LockedPool locked;
+        Core::ProxyPoolType<BenchmarkElement> pool(2);
+
+        const uint64_t queued = Threaded([&locked]() {
+            std::list<Core::ProxyType<BenchmarkElement>> elements;
+
+            for (uint32_t round = 0; round < g_poolRounds; round++) {
+                elements.push_back(locked.Element());
+
+                if (elements.size() > 3) {
+                    elements.pop_front();
+                }
+            }
+        });
+
+        const uint64_t cached = Threaded([&pool]() {
+            std::list<Core::ProxyType<BenchmarkElement>> elements;
+
+            for (uint32_t round = 0; round < g_poolRounds; round++) {
+                elements.push_back(pool.Element());
+
+                if (elements.size() > 3) {
+                    elements.pop_front();
+                }
+            }
+        });
+
+        EXPECT_EQ(pool.Hits() + pool.Misses(), static_cast<uint32_t>(g_poolThreads * g_poolRounds));
+
+        printf("ProxyPool %d threads x %d elements: locked queue %d us, magazines %d us (created %d, hits %d, misses %d, contended %d)\n",
+            g_poolThreads, g_poolRounds, static_cast<uint32_t>(queued), static_cast<uint32_t>(cached),
+            pool.CreatedElements(), pool.Hits(), pool.Misses(), pool.Contention());
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,719 @@
+// Measures the cost of COM-RPC calls between two processes: the latency (p50/p99) and the number
+// of calls per second for null calls, text and buffer payloads of increasing size, interfaces
+// returned from a call, also with many proxies alive, a number of threads calling at the same time
+// and one-way calls, that are not waited for.
+// The results are printed as a table and, if requested, written as JSON to track them over time.
+
+#include "../ExternalAccess.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+
+namespace WPEFramework {
+namespace Exchange {
+    struct IBenchmark : virtual public Core::IUnknown {
+        enum { ID = 0x80000002 };
+        virtual void Null() = 0;
+        virtual uint32_t Text(const string& text) = 0;
+        virtual uint32_t Buffer(const uint16_t length, const uint8_t data[] /* @length:length */) = 0;
+        virtual uint32_t Large(const uint32_t length, const uint8_t data[] /* @length:length @blob */) = 0;
+        virtual IBenchmark* Child(const uint32_t index) = 0;
+        // @oneway
+        virtual void Notify(const uint32_t value) = 0;
+    };
+}
+}
+
+using namespace WPEFramework;
+
+class Benchmark : public Exchange::IBenchmark {
+public:
+    Benchmark()
+        : _adminLock()
+        , _children()
+    {
+    }
+    ~Benchmark()
+    {
+        for (Exchange::IBenchmark* child : _children) {
+            child->Release();
+        }
+    }
+
+    void Null() override
+    {
+    }
+    uint32_t Text(const string& text) override
+    {
+        return (static_cast<uint32_t>(text.length()));
+    }
+    uint32_t Buffer(const uint16_t length, const uint8_t data[] VARIABLE_IS_NOT_USED) override
+    {
+        return (length);
+    }
+    uint32_t Large(const uint32_t length, const uint8_t data[] VARIABLE_IS_NOT_USED) override
+    {
+        return (length);
+    }
+    Exchange::IBenchmark* Child(const uint32_t index) override
+    {
+        _adminLock.Lock();
+
+        while (_children.size() <= index) {
+            _children.push_back(Core::Service<Benchmark>::Create<Exchange::IBenchmark>());
+        }
+
+        Exchange::IBenchmark* result = _children[index];
+        result->AddRef();
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+    void Notify(const uint32_t value VARIABLE_IS_NOT_USED) override
+    {
+    }
+
+    BEGIN_INTERFACE_MAP(Benchmark)
+        INTERFACE_ENTRY(Exchange::IBenchmark)
+    END_INTERFACE_MAP
+
+private:
+    Core::CriticalSection _adminLock;
+    std::vector<Exchange::IBenchmark*> _children;
+};
+
+// Proxystubs.
+namespace WPEFramework {
+    using namespace Exchange;
+
+    // -----------------------------------------------------------------
+    // STUB
+    // -----------------------------------------------------------------
+
+    //
+    // IBenchmark interface stub definitions
+    //
+    // Methods:
+    //  (0) virtual void Null() = 0
+    //  (1) virtual uint32_t Text(const string&) = 0
+    //  (2) virtual uint32_t Buffer(const uint16_t, const uint8_t*) = 0
+    //  (3) virtual uint32_t Large(const uint32_t, const uint8_t*) = 0
+    //  (4) virtual IBenchmark* Child(const uint32_t) = 0
+    //  (5) virtual void Notify(const uint32_t) = 0 (one-way)
+    //
+
+    ProxyStub::MethodHandler BenchmarkStubMethods[] = {
+        // virtual void Null() = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // call implementation
+            IBenchmark* implementation = input.Implementation<IBenchmark>();
+            ASSERT((implementation != nullptr) && "Null IBenchmark implementation pointer");
+            implementation->Null();
+        },
+
+        // virtual uint32_t Text(const string&) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const string param0 = reader.Text();
+
+            // call implementation
+            IBenchmark* implementation = input.Implementation<IBenchmark>();
+            ASSERT((implementation != nullptr) && "Null IBenchmark implementation pointer");
+            const uint32_t output = implementation->Text(param0);
+
+            // write return value
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<const uint32_t>(output);
+        },
+
+        // virtual uint32_t Buffer(const uint16_t, const uint8_t*) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint8_t* param1 = nullptr;
+            uint16_t param1_length = reader.LockBuffer<uint16_t>(param1);
+            reader.UnlockBuffer(param1_length);
+
+            // call implementation
+            IBenchmark* implementation = input.Implementation<IBenchmark>();
+            ASSERT((implementation != nullptr) && "Null IBenchmark implementation pointer");
+            const uint32_t output = implementation->Buffer(param1_length, param1);
+
+            // write return value
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<const uint32_t>(output);
+        },
+
+        // virtual uint32_t Large(const uint32_t, const uint8_t*) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            RPC::Data::Blob param1_blob(*channel, reader.Number<uint32_t>());
+            const uint8_t* param1 = param1_blob.Buffer();
+            uint32_t param1_length = static_cast<uint32_t>(param1_blob.Length());
+
+            // call implementation
+            IBenchmark* implementation = input.Implementation<IBenchmark>();
+            ASSERT((implementation != nullptr) && "Null IBenchmark implementation pointer");
+            const uint32_t output = implementation->Large(param1_length, param1);
+
+            // write return value
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<const uint32_t>(output);
+        },
+
+        // virtual IBenchmark* Child(const uint32_t) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint32_t param0 = reader.Number<uint32_t>();
+
+            // call implementation
+            IBenchmark* implementation = input.Implementation<IBenchmark>();
+            ASSERT((implementation != nullptr) && "Null IBenchmark implementation pointer");
+            IBenchmark* output = implementation->Child(param0);
+
+            // write return value
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<IBenchmark*>(output);
+            RPC::Administrator::Instance().RegisterInterface(channel, output);
+        },
+
+        // virtual void Notify(const uint32_t) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint32_t param0 = reader.Number<uint32_t>();
+
+            // call implementation
+            IBenchmark* implementation = input.Implementation<IBenchmark>();
+            ASSERT((implementation != nullptr) && "Null IBenchmark implementation pointer");
+            implementation->Notify(param0);
+        },
+
+        nullptr
+    }; // BenchmarkStubMethods[]
+
+    // -----------------------------------------------------------------
+    // PROXY
+    // -----------------------------------------------------------------
+
+    //
+    // IBenchmark interface proxy definitions
+    //
+    // Methods:
+    //  (0) virtual void Null() = 0
+    //  (1) virtual uint32_t Text(const string&) = 0
+    //  (2) virtual uint32_t Buffer(const uint16_t, const uint8_t*) = 0
+    //  (3) virtual uint32_t Large(const uint32_t, const uint8_t*) = 0
+    //  (4) virtual IBenchmark* Child(const uint32_t) = 0
+    //  (5) virtual void Notify(const uint32_t) = 0 (one-way)
+    //
+
+    class BenchmarkProxy final : public ProxyStub::UnknownProxyType<IBenchmark> {
+    public:
+        BenchmarkProxy(const Core::ProxyType<Core::IPCChannel>& channel, void* implementation, const bool otherSideInformed)
+            : BaseClass(channel, implementation, otherSideInformed)
+        {
+        }
+
+        void Null() override
+        {
+            IPCMessage newMessage(BaseClass::Message(0));
+
+            // invoke the method handler
+            Invoke(newMessage);
+        }
+
+        uint32_t Text(const string& param0) override
+        {
+            IPCMessage newMessage(BaseClass::Message(1));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Text(param0);
+
+            // invoke the method handler
+            uint32_t output{};
+            if ((output = Invoke(newMessage)) == Core::ERROR_NONE) {
+                // read return value
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output = reader.Number<uint32_t>();
+            }
+
+            return output;
+        }
+
+        uint32_t Buffer(const uint16_t param0, const uint8_t* param1) override
+        {
+            IPCMessage newMessage(BaseClass::Message(2));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Buffer<uint16_t>(param0, param1);
+
+            // invoke the method handler
+            uint32_t output{};
+            if ((output = Invoke(newMessage)) == Core::ERROR_NONE) {
+                // read return value
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output = reader.Number<uint32_t>();
+            }
+
+            return output;
+        }
+
+        uint32_t Large(const uint32_t param0, const uint8_t* param1) override
+        {
+            IPCMessage newMessage(BaseClass::Message(3));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Number<uint32_t>(BaseClass::Blob(param0, param1));
+
+            // invoke the method handler
+            uint32_t output{};
+            if ((output = Invoke(newMessage)) == Core::ERROR_NONE) {
+                // read return value
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output = reader.Number<uint32_t>();
+            }
+
+            return output;
+        }
+
+        IBenchmark* Child(const uint32_t param0) override
+        {
+            IPCMessage newMessage(BaseClass::Message(4));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Number<const uint32_t>(param0);
+
+            // invoke the method handler
+            IBenchmark* output_proxy{};
+            if (Invoke(newMessage) == Core::ERROR_NONE) {
+                // read return value
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output_proxy = reinterpret_cast<IBenchmark*>(Interface(reader.Number<void*>(), IBenchmark::ID));
+            }
+
+            return output_proxy;
+        }
+
+        void Notify(const uint32_t param0) override
+        {
+            IPCMessage newMessage(BaseClass::Message(5));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Number<const uint32_t>(param0);
+
+            // invoke the method handler
+            Post(newMessage);
+        }
+    }; // class BenchmarkProxy
+
+    // -----------------------------------------------------------------
+    // REGISTRATION
+    // -----------------------------------------------------------------
+
+    namespace {
+
+        typedef ProxyStub::UnknownStubType<IBenchmark, BenchmarkStubMethods> BenchmarkStub;
+
+        static class Instantiation {
+        public:
+            Instantiation()
+            {
+                RPC::Administrator::Instance().Announce<IBenchmark, BenchmarkProxy, BenchmarkStub>();
+            }
+        } ProxyStubRegistration;
+
+    } // namespace
+}
+
+namespace {
+
+class ConsoleOptions : public Core::Options {
+public:
+    ConsoleOptions(int argumentCount, TCHAR* arguments[])
+        : Core::Options(argumentCount, arguments, _T("hc:t:o:n:"))
+        , Calls(10000)
+        , Threads(8)
+        , Output(nullptr)
+        , Connector(_T("/tmp/benchmarkrpc"))
+    {
+        Parse();
+    }
+    ~ConsoleOptions()
+    {
+    }
+
+public:
+    uint32_t Calls;
+    uint32_t Threads;
+    const TCHAR* Output;
+    const TCHAR* Connector;
+
+private:
+    virtual void Option(const TCHAR option, const TCHAR* argument)
+    {
+        switch (option) {
+        case 'c':
+            Calls = Core::NumberType<uint32_t>(Core::TextFragment(argument)).Value();
+            break;
+        case 't':
+            Threads = Core::NumberType<uint32_t>(Core::TextFragment(argument)).Value();
+            break;
+        case 'o':
+            Output = argument;
+            break;
+        case 'n':
+            Connector = argument;
+            break;
+        case 'h':
+        default:
+            RequestUsage(true);
+            break;
+        }
+    }
+};
+
+class Result : public Core::JSON::Container {
+public:
+    Result()
+        : Core::JSON::Container()
+        , Name()
+        , Size(0)
+        , Threads(0)
+        , Calls(0)
+        , P50(0)
+        , P99(0)
+        , Rate(0)
+    {
+        Init();
+    }
+    Result(const Result& copy)
+        : Core::JSON::Container()
+        , Name(copy.Name)
+        , Size(copy.Size)
+        , Threads(copy.Threads)
+        , Calls(copy.Calls)
+        , P50(copy.P50)
+        , P99(copy.P99)
+        , Rate(copy.Rate)
+    {
+        Init();
+    }
+    ~Result() override
+    {
+    }
+
+    Result& operator=(const Result& rhs)
+    {
+        Name = rhs.Name;
+        Size = rhs.Size;
+        Threads = rhs.Threads;
+        Calls = rhs.Calls;
+        P50 = rhs.P50;
+        P99 = rhs.P99;
+        Rate = rhs.Rate;
+
+        return (*this);
+    }
+
+private:
+    void Init()
+    {
+        Add(_T("name"), &Name);
+        Add(_T("size"), &Size);
+        Add(_T("threads"), &Threads);
+        Add(_T("calls"), &Calls);
+        Add(_T("p50"), &P50);
+        Add(_T("p99"), &P99);
+        Add(_T("rate"), &Rate);
+    }
+
+public:
+    Core::JSON::String Name;
+    Core::JSON::DecUInt32 Size; // Bytes of payload per call.
+    Core::JSON::DecUInt32 Threads;
+    Core::JSON::DecUInt32 Calls;
+    Core::JSON::DecUInt64 P50; // Nanoseconds.
+    Core::JSON::DecUInt64 P99; // Nanoseconds.
+    Core::JSON::DecUInt64 Rate; // Calls per second, over all threads.
+};
+
+class Results : public Core::JSON::Container {
+public:
+    Results(const Results&) = delete;
+    Results& operator=(const Results&) = delete;
+
+    Results()
+        : Core::JSON::Container()
+        , Benchmarks()
+    {
+        Add(_T("benchmarks"), &Benchmarks);
+    }
+    ~Results() override
+    {
+    }
+
+public:
+    Core::JSON::ArrayType<Result> Benchmarks;
+};
+
+typedef Tests::ExternalAccess<Exchange::IBenchmark, Benchmark> BenchmarkAccess;
+
+static inline uint64_t Nanoseconds()
+{
+    struct timespec now;
+
+    ::clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((static_cast<uint64_t>(now.tv_sec) * 1000000000) + now.tv_nsec);
+}
+
+// Runs the call the given number of times on every thread, after a few rounds to warm up, and
+// adds the latencies of all calls and the rate they were done at to the results.
+template <typename CALL>
+static void Measure(Results& results, const string& name, const uint32_t size, const uint32_t threads, const uint32_t calls, CALL call)
+{
+    std::vector<std::vector<uint64_t>> latencies(threads);
+    std::vector<std::thread> callers;
+
+    for (uint32_t index = 0; index < std::min(calls, 100u); index++) {
+        call();
+    }
+
+    const uint64_t start = Nanoseconds();
+
+    for (uint32_t thread = 0; thread < threads; thread++) {
+        callers.emplace_back([&latencies, thread, calls, &call]() {
+            std::vector<uint64_t>& measured(latencies[thread]);
+
+            measured.reserve(calls);
+
+            for (uint32_t index = 0; index < calls; index++) {
+                const uint64_t begin = Nanoseconds();
+                call();
+                measured.push_back(Nanoseconds() - begin);
+            }
+        });
+    }
+    for (std::thread& caller : callers) {
+        caller.join();
+    }
+
+    const uint64_t duration = Nanoseconds() - start;
+
+    std::vector<uint64_t> all;
+    for (const std::vector<uint64_t>& measured : latencies) {
+        all.insert(all.end(), measured.begin(), measured.end());
+    }
+    std::sort(all.begin(), all.end());
+
+    Result& result(results.Benchmarks.Add());
+
+    result.Name = name;
+    result.Size = size;
+    result.Threads = threads;
+    result.Calls = static_cast<uint32_t>(all.size());
+    result.P50 = all[all.size() / 2];
+    result.P99 = all[std::min(all.size() - 1, (all.size() * 99) / 100)];
+    result.Rate = (static_cast<uint64_t>(all.size()) * 1000000000) / (duration + 1);
+
+    printf("%-20s %9d %7d %9d %10llu %10llu %10llu\n", name.c_str(), size, threads, result.Calls.Value(),
+        static_cast<unsigned long long>(result.P50.Value()), static_cast<unsigned long long>(result.P99.Value()), static_cast<unsigned long long>(result.Rate.Value()));
+    fflush(stdout);
+}
+
+static void Server(const Core::NodeId& node, int ready, int done)
+{
+    {
+        Core::ProxyType<RPC::InvokeServerType<64, 8>> engine(Core::ProxyType<RPC::InvokeServerType<64, 8>>::Create(Core::Thread::DefaultStackSize()));
+        BenchmarkAccess communicator(node, Core::ProxyType<Core::IIPCServer>(engine));
+        engine->Announcements(communicator.Announcement());
+
+        char signal = 1;
+        if (::write(ready, &signal, 1) == 1) {
+            // Until the client is done and closes its end, the monitor of the sockets might interrupt the wait.
+            int result;
+            while (((result = ::read(done, &signal, 1)) > 0) || ((result == -1) && (errno == EINTR))) {
+            }
+        }
+
+        communicator.Close(Core::infinite);
+    }
+
+    // The singletons were created before the fork, their threads only run in the parent, so they
+    // are not disposed here.
+}
+
+static void Client(const Core::NodeId& node, const ConsoleOptions& options, Results& results)
+{
+    Core::ProxyType<RPC::CommunicatorClient> client(Tests::ExternalClient(node));
+
+    Exchange::IBenchmark* benchmark = client->Open<Exchange::IBenchmark>(_T("Benchmark"));
+
+    if (benchmark == nullptr) {
+        fprintf(stderr, "Could not reach the benchmark server on %s.\n", options.Connector);
+    } else {
+        const uint32_t calls = options.Calls;
+        std::vector<uint8_t> data(4 * 1024 * 1024);
+
+        for (uint32_t index = 0; index < data.size(); index++) {
+            data[index] = static_cast<uint8_t>(index);
+        }
+
+        printf("%-20s %9s %7s %9s %10s %10s %10s\n", "benchmark", "size", "threads", "calls", "p50 [ns]", "p99 [ns]", "calls/s");
+
+        Measure(results, _T("null"), 0, 1, calls, [benchmark]() { benchmark->Null(); });
+
+        for (uint32_t size : { 16, 256, 4096, 16384 }) {
+            const string text(size, 'x');
+            Measure(results, _T("text"), size, 1, calls, [benchmark, &text]() { benchmark->Text(text); });
+        }
+
+        // Beyond the threshold of the frame pool, these do not travel through the socket.
+        for (uint32_t size : { 16, 256, 4096, 16384, 60000 }) {
+            Measure(results, _T("buffer"), size, 1, calls, [benchmark, &data, size]() { benchmark->Buffer(static_cast<uint16_t>(size), data.data()); });
+        }
+
+        // Too large for a frame, these travel as sealed memory files next to the invoke.
+        for (uint32_t size : { 65536, 1024 * 1024, 4 * 1024 * 1024 }) {
+            Measure(results, _T("blob"), size, 1, std::max(calls / (size / 4096), 10u), [benchmark, &data, size]() { benchmark->Large(size, data.data()); });
+        }
+
+        // Every call creates a proxy for the returned interface and releases it again.
+        Measure(results, _T("interface"), 0, 1, calls, [benchmark]() { benchmark->Child(0)->Release(); });
+
+        // With a proxy kept alive, the interface returned is found among the existing proxies.
+        Exchange::IBenchmark* child = benchmark->Child(0);
+        Measure(results, _T("interface-cached"), 0, 1, calls, [benchmark]() { benchmark->Child(0)->Release(); });
+        child->Release();
+
+        // The same, with many more proxies alive to look the interface up in.
+        std::vector<Exchange::IBenchmark*> children;
+        for (uint32_t index = 0; index < 512; index++) {
+            children.push_back(benchmark->Child(index));
+        }
+        uint32_t next = 0;
+        Measure(results, _T("interface-cached-512"), 0, 1, calls, [benchmark, &next]() { benchmark->Child(next++ % 512)->Release(); });
+        for (Exchange::IBenchmark* entry : children) {
+            entry->Release();
+        }
+
+        for (uint32_t threads = 2; threads <= options.Threads; threads *= 2) {
+            Measure(results, _T("null"), 0, threads, calls, [benchmark]() { benchmark->Null(); });
+        }
+
+        // Only the posting is measured, the other side handles them after it. Last, so the backlog
+        // does not end up in the other measurements.
+        uint32_t value = 0;
+        Measure(results, _T("one-way"), 0, 1, calls, [benchmark, &value]() { benchmark->Notify(value++); });
+
+        // Queued behind the one-way calls, once this returns they are all sent.
+        benchmark->Null();
+
+        benchmark->Release();
+    }
+
+    client->Close(Core::infinite);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    ConsoleOptions options(argc, argv);
+
+    if (options.RequestUsage() == true) {
+        printf("benchmark_rpc [-h]\n");
+        printf("              [-c <calls per benchmark and thread>]\n");
+        printf("              [-t <maximum number of calling threads>]\n");
+        printf("              [-n <connector>]\n");
+        printf("              [-o <JSON file with the results>]\n");
+        return (0);
+    }
+
+    const Core::NodeId node(options.Connector);
+    int ready[2];
+    int done[2];
+
+    if ((::pipe(ready) != 0) || (::pipe(done) != 0)) {
+        fprintf(stderr, "Could not create the pipes to synchronize with the server.\n");
+        return (1);
+    }
+
+    // The server runs in its own process, before any connection is made in this one.
+    pid_t server = ::fork();
+
+    if (server == 0) {
+        ::close(ready[0]);
+        ::close(done[1]);
+        Server(node, ready[1], done[0]);
+        ::_exit(0);
+    }
+
+    ::close(ready[1]);
+    ::close(done[0]);
+
+    Results results;
+    char signal;
+    int result = 1;
+
+    if ((server != -1) && (::read(ready[0], &signal, 1) == 1)) {
+        Client(node, options, results);
+
+        if (options.Output != nullptr) {
+            Core::File file(string(options.Output), false);
+
+            if (file.Create() == true) {
+                results.IElement::ToFile(file);
+                result = 0;
+            } else {
+                fprintf(stderr, "Could not create %s.\n", options.Output);
+            }
+        } else {
+            result = 0;
+        }
+    } else {
+        fprintf(stderr, "Could not start the benchmark server.\n");
+    }
+
+    ::close(done[1]);
+    ::close(ready[0]);
+
+    if (server != -1) {
+        ::waitpid(server, nullptr, 0);
+    }
+
+    Core::Singleton::Dispose();
+
+    return (result);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint16_t g_exchangeAdministrationSize = 64;
+    const char g_exchangeBufferName[] = "benchmarkbuffer01";
+    const char g_exchangeRingName[] = "benchmarkring01";
+    const uint8_t g_exchangeSlots = 8;
+    const uint32_t g_exchangeSampleSize = 4 * 1024;
+    const uint32_t g_exchangeSamples = 20000;
+
+    static void CleanUpExchange()
+    {
+        Core::File(string(g_exchangeBufferName)).Destroy();
+        Core::File(string(g_exchangeBufferName) + _T(".admin")).Destroy();
+        Core::File(string(g_exchangeRingName)).Destroy();
+        Core::File(string(g_exchangeRingName) + _T(".ring")).Destroy();
+    }
+
+    static uint32_t SamplesPerSecond(const uint64_t duration)
+    {
+        return (static_cast<uint32_t>((static_cast<uint64_t>(g_exchangeSamples) * Core::Time::TicksPerMillisecond * 1000) / (duration == 0 ? 1 : duration)));
+    }
+
+    // Stands in for the decryption: every byte of the slot is flipped, the status is the sample number.
+    static void ConsumeSlots(Core::SharedBufferRing& ring, const uint32_t samples)
+    {
+        uint8_t slot;
+
+        for (uint32_t index = 0; index < samples; index++) {
+            if (ring.RequestConsume(Core::infinite, slot) == Core::ERROR_NONE) {
+                uint8_t* buffer = ring.Buffer(slot);
+                const uint32_t length = ring.BytesWritten(slot);
+
+                for (uint32_t position = 0; position < length; position++) {
+                    buffer[position] ^= 0xFF;
+                }
+                ::memcpy(ring.AdministrationBuffer(slot), &index, sizeof(index));
+
+                ring.Consumed(slot);
+            }
+        }
+    }
+
+    TEST(Benchmark_SharedBuffer, SingleSlotVersusRing)
+    {
+        uint8_t sample[g_exchangeSampleSize];
+        uint8_t result[g_exchangeSampleSize];
+
+        ::memset(sample, 0x5A, sizeof(sample));
+
+        CleanUpExchange();
+
+        // One slot, the round trip of every sample is waited for before the next one is produced.
+        uint64_t single;
+        {
+            Core::SharedBuffer producer(g_exchangeBufferName,
+                Core::File::USER_READ | Core::File::USER_WRITE | Core::File::GROUP_READ | Core::File::GROUP_WRITE,
+                g_exchangeSampleSize,
+                g_exchangeAdministrationSize);
+            Core::SharedBuffer consumer(g_exchangeBufferName);
+
+            std::thread worker([&consumer]() {
+                for (uint32_t index = 0; index < g_exchangeSamples; index++) {
+                    if (consumer.RequestConsume(Core::infinite) == Core::ERROR_NONE) {
+                        uint8_t* buffer = consumer.Buffer();
+
+                        for (uint32_t position = 0; position < g_exchangeSampleSize; position++) {
+                            buffer[position] ^= 0xFF;
+                        }
+                        consumer.Consumed();
+                    }
+                }
+            });
+
+            const uint64_t start = Core::Time::Now().Ticks();
+
+            for (uint32_t index = 0; index < g_exchangeSamples; index++) {
+                if (producer.RequestProduce(Core::infinite) == Core::ERROR_NONE) {
+                    ::memcpy(producer.Buffer(), sample, sizeof(sample));
+                    producer.Produced();
+
+                    if (producer.RequestProduce(Core::infinite) == Core::ERROR_NONE) {
+                        ::memcpy(result, producer.Buffer(), sizeof(result));
+                        producer.Consumed();
+                    }
+                }
+            }
+
+            single = Core::Time::Now().Ticks() - start;
+            worker.join();
+
+            EXPECT_EQ(result[0], 0xA5);
+        }
+
+        // All slots in flight, a sample is produced before the result of an earlier one is read.
+        uint64_t ring;
+        {
+            Core::SharedBufferRing producer(g_exchangeRingName,
+                Core::File::USER_READ | Core::File::USER_WRITE | Core::File::GROUP_READ | Core::File::GROUP_WRITE,
+                g_exchangeSlots,
+                g_exchangeSampleSize,
+                g_exchangeAdministrationSize);
+            Core::SharedBufferRing consumer(g_exchangeRingName);
+
+            std::thread worker(ConsumeSlots, std::ref(consumer), g_exchangeSamples);
+
+            uint8_t slots[g_exchangeSlots];
+
+            const uint64_t start = Core::Time::Now().Ticks();
+
+            for (uint32_t index = 0; index < (g_exchangeSamples + g_exchangeSlots); index++) {
+                if (index >= g_exchangeSlots) {
+                    const uint8_t slot = slots[index % g_exchangeSlots];
+
+                    if (producer.RequestResult(slot, Core::infinite) == Core::ERROR_NONE) {
+                        ::memcpy(result, producer.Buffer(slot), producer.BytesWritten(slot));
+                    }
+                    producer.Release(slot);
+                }
+                if ((index < g_exchangeSamples) && (producer.RequestProduce(Core::infinite, slots[index % g_exchangeSlots]) == Core::ERROR_NONE)) {
+                    const uint8_t slot = slots[index % g_exchangeSlots];
+
+                    ::memcpy(producer.Buffer(slot), sample, sizeof(sample));
+                    producer.BytesWritten(slot, sizeof(sample));
+                    producer.Produced(slot);
+                }
+            }
+
+            ring = Core::Time::Now().Ticks() - start;
+            worker.join();
+
+            EXPECT_EQ(result[0], 0xA5);
+        }
+
+        CleanUpExchange();
+
+        printf("Decrypt %d samples of %d bytes: single slot %d samples/s, %d slots %d samples/s\n", g_exchangeSamples, g_exchangeSampleSize,
+            SamplesPerSecond(single), g_exchangeSlots, SamplesPerSecond(ring));
+    }
+
+} // Tests
+} // WPEFramework
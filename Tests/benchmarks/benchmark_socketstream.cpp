@@ -0,0 +1,41 @@
+#include "../StreamEnd.h"
+
+#include <gtest/gtest.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    TEST(Benchmark_SocketStream, Gather)
+    {
+        int pair[2];
+
+        ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+
+        {
+            StreamEnd sender(pair[0], 4096, 512);
+            StreamEnd receiver(pair[1], 512, 1000);
+
+            EXPECT_EQ(sender.Open(0), Core::ERROR_NONE);
+            EXPECT_EQ(receiver.Open(0), Core::ERROR_NONE);
+
+            uint64_t start = Core::Time::Now().Ticks();
+
+            for (uint32_t batch = 0; batch < (g_streamMessages / 100); batch++) {
+                sender.Queue(100);
+            }
+
+            uint32_t timeout = 10000;
+            while ((receiver.Received() < g_streamMessages) && (--timeout != 0)) {
+                SleepMs(1);
+            }
+
+            uint64_t duration = Core::Time::Now().Ticks() - start;
+
+            EXPECT_EQ(receiver.Received(), g_streamMessages);
+
+            printf("Stream of %d messages of %d bytes: %d us\n", g_streamMessages, g_streamMessageSize, static_cast<uint32_t>(duration));
+        }
+    }
+
+} // Tests
+} // WPEFramework
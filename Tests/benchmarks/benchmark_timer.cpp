@@ -0,0 +1,43 @@
+#include "../TimerContent.h"
+
+#include <gtest/gtest.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    template <typename TIMER>
+    static uint64_t ArmAndRevoke(TimerRecord records[])
+    {
+        TIMER timer(Core::Thread::DefaultStackSize(), _T("TestTimerLoad"));
+        uint64_t now = Core::Time::Now().Ticks();
+        uint64_t start = now;
+
+        // Request deadlines spread over a minute, all revoked before they expire.
+        for (uint32_t index = 0; index < g_timerEntries; index++) {
+            uint64_t delay = 10000 + ((index * 7919) % 60000);
+            timer.Schedule(now + (delay * Core::Time::TicksPerMillisecond), TimerContent(&records[index]));
+        }
+        for (uint32_t index = 0; index < g_timerEntries; index++) {
+            timer.Revoke(TimerContent(&records[index]));
+        }
+
+        EXPECT_EQ(timer.Pending(), 0u);
+
+        return (Core::Time::Now().Ticks() - start);
+    }
+
+    TEST(Benchmark_TimerWheel, ArmAndRevoke)
+    {
+        TimerRecord* records = new TimerRecord[g_timerEntries];
+
+        uint64_t list = ArmAndRevoke<Core::TimerType<TimerContent>>(records);
+        uint64_t wheel = ArmAndRevoke<Core::TimerWheelType<TimerContent>>(records);
+
+        printf("Arm and revoke %d timers: sorted list %d us, timing wheel %d us\n", g_timerEntries,
+            static_cast<uint32_t>(list), static_cast<uint32_t>(wheel));
+
+        delete[] records;
+    }
+
+} // Tests
+} // WPEFramework
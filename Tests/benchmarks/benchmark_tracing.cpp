@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <tracing/tracing.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint32_t g_traceRecords = 50000;
+    const uint8_t g_traceThreads = 4;
+
+    static const char* g_traceModule = _T("BenchmarkTracing");
+
+    class TraceCounter : public Trace::TraceRecorder::IConsumer {
+    public:
+        TraceCounter(const TraceCounter&) = delete;
+        TraceCounter& operator=(const TraceCounter&) = delete;
+
+        TraceCounter()
+            : Records(0)
+        {
+        }
+        ~TraceCounter() override
+        {
+        }
+
+    public:
+        void Trace(const uint64_t, const uint32_t, const char[], const uint32_t, const char[], const char[], const char[], const string&) override
+        {
+            Records++;
+        }
+
+    public:
+        uint32_t Records;
+    };
+
+    typedef Trace::TraceType<Trace::Information, &g_traceModule> BenchmarkTraceType;
+
+    static void RecordDeferred(const uint32_t count)
+    {
+        for (uint32_t index = 0; index < count; index++) {
+            Trace::TraceRecorder::Entry(__FILE__, __LINE__, _T("BenchmarkClass"), BenchmarkTraceType::ModuleName(), BenchmarkTraceType::CategoryName()).Record(_T("%u"), index);
+        }
+    }
+
+    static void RecordFormatted(const uint32_t count)
+    {
+        for (uint32_t index = 0; index < count; index++) {
+            Trace::Information data(_T("%u"), index);
+            BenchmarkTraceType message(data);
+            Trace::TraceUnit::Instance().Trace(__FILE__, __LINE__, _T("BenchmarkClass"), &message);
+        }
+    }
+
+    template <typename FUNCTION>
+    static uint64_t RecordConcurrently(FUNCTION function, const uint8_t threads, const uint32_t count)
+    {
+        std::vector<std::thread> workers;
+        uint64_t start = Core::Time::Now().Ticks();
+
+        for (uint8_t index = 0; index < threads; index++) {
+            workers.emplace_back(function, count);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        return (Core::Time::Now().Ticks() - start);
+    }
+
+    static uint32_t RecordsPerSecond(const uint32_t records, const uint64_t duration)
+    {
+        return (static_cast<uint32_t>((static_cast<uint64_t>(records) * Core::Time::TicksPerMillisecond * 1000) / (duration == 0 ? 1 : duration)));
+    }
+
+    TEST(Benchmark_TraceRecorder, FormattedVersusDeferred)
+    {
+        Trace::TraceRecorder& recorder(Trace::TraceRecorder::Instance());
+        TraceCounter counter;
+
+        // Large enough to keep all records of a thread, nothing is flushed while recording.
+        EXPECT_EQ(recorder.Open(g_traceRecords * 64), Core::ERROR_NONE);
+
+        BenchmarkTraceType::Enable(true);
+
+        uint64_t formatted = RecordConcurrently(RecordFormatted, 1, g_traceRecords);
+        uint64_t deferred = RecordConcurrently(RecordDeferred, 1, g_traceRecords);
+
+        printf("Trace %d records on 1 thread: formatted %d records/s, deferred %d records/s\n", g_traceRecords,
+            RecordsPerSecond(g_traceRecords, formatted), RecordsPerSecond(g_traceRecords, deferred));
+
+        formatted = RecordConcurrently(RecordFormatted, g_traceThreads, g_traceRecords);
+        deferred = RecordConcurrently(RecordDeferred, g_traceThreads, g_traceRecords);
+
+        printf("Trace %d records on %d threads: formatted %d records/s, deferred %d records/s\n", g_traceRecords * g_traceThreads, g_traceThreads,
+            RecordsPerSecond(g_traceRecords * g_traceThreads, formatted), RecordsPerSecond(g_traceRecords * g_traceThreads, deferred));
+
+        BenchmarkTraceType::Enable(false);
+
+        EXPECT_EQ(recorder.Flush(counter), g_traceRecords * (1 + g_traceThreads));
+
+        recorder.Close();
+    }
+
+} // Tests
+} // WPEFramework
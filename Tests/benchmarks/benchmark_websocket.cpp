@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint32_t g_maskRounds = 2000;
+
+    // What the encoder and decoder did before, one byte at a time, back to front.
+    static void MaskBytes(uint8_t destination[], const uint8_t source[], uint32_t length, const uint8_t key[4], const uint8_t offset)
+    {
+        while (length != 0) {
+            length--;
+            destination[length] = (source[length] ^ key[(offset + length) & 0x3]);
+        }
+    }
+
+    TEST(Benchmark_WebSocket, Mask)
+    {
+        const uint8_t key[4] = { 0x12, 0x34, 0x56, 0x78 };
+        std::vector<uint8_t> data((64 * 1024) + 8);
+
+        for (uint32_t length : { 1024, 4096, 16384, 65536 }) {
+            const uint32_t rounds = g_maskRounds * (65536 / length);
+
+            uint64_t start = Core::Time::Now().Ticks();
+            for (uint32_t round = 0; round < rounds; round++) {
+                MaskBytes(&data[4], data.data(), length, key, 0);
+            }
+            uint64_t bytes = Core::Time::Now().Ticks() - start;
+
+            start = Core::Time::Now().Ticks();
+            for (uint32_t round = 0; round < rounds; round++) {
+                Web::WebSocket::Protocol::Mask(&data[4], data.data(), length, key, 0);
+            }
+            uint64_t vector = Core::Time::Now().Ticks() - start;
+
+            printf("Mask %d x %d bytes: per byte %d MB/s, vectorised %d MB/s\n", rounds, length,
+                static_cast<uint32_t>((static_cast<uint64_t>(rounds) * length) / (bytes + 1)),
+                static_cast<uint32_t>((static_cast<uint64_t>(rounds) * length) / (vector + 1)));
+        }
+    }
+
+} // Tests
+} // WPEFramework
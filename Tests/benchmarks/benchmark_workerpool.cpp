@@ -0,0 +1,112 @@
+#include "../StormJob.h"
+
+namespace WPEFramework {
+namespace Tests {
+
+    // The design the WorkerPool had before it got per thread queues: every thread on one locked queue.
+    class SharedQueuePool {
+    private:
+        class Minion : public Core::Thread {
+        public:
+            Minion(Core::QueueType<Core::ProxyType<Core::IDispatch>>& queue)
+                : Core::Thread(Core::Thread::DefaultStackSize(), nullptr)
+                , _queue(queue)
+            {
+            }
+            ~Minion() override
+            {
+                Stop();
+                Wait(Core::Thread::STOPPED, Core::infinite);
+            }
+
+        private:
+            uint32_t Worker() override
+            {
+                Core::ProxyType<Core::IDispatch> job;
+                while (_queue.Extract(job, Core::infinite) == true) {
+                    job->Dispatch();
+                    job.Release();
+                }
+                Block();
+                return (Core::infinite);
+            }
+
+        private:
+            Core::QueueType<Core::ProxyType<Core::IDispatch>>& _queue;
+        };
+
+    public:
+        SharedQueuePool(const uint8_t threads)
+            : _queue(g_stormJobs * 8)
+            , _minions()
+        {
+            for (uint8_t index = 0; index < threads; index++) {
+                _minions.emplace_back(new Minion(_queue));
+                _minions.back()->Run();
+            }
+        }
+        ~SharedQueuePool()
+        {
+            _queue.Disable();
+            for (Minion* minion : _minions) {
+                delete minion;
+            }
+        }
+
+        void Submit(const Core::ProxyType<Core::IDispatch>& job)
+        {
+            _queue.Insert(job, Core::infinite);
+        }
+
+    private:
+        Core::QueueType<Core::ProxyType<Core::IDispatch>> _queue;
+        std::list<Minion*> _minions;
+    };
+
+    static uint64_t Storm(const StormJob::Submitter& submitter, std::atomic<uint32_t>& counter, const uint8_t depth)
+    {
+        const uint32_t expected = g_stormJobs * (depth + 1);
+        const uint64_t start = Core::Time::Now().Ticks();
+
+        for (uint32_t index = 0; index < g_stormJobs; index++) {
+            submitter(Core::ProxyType<Core::IDispatch>(Core::ProxyType<StormJob>::Create(&counter, submitter, depth)));
+        }
+
+        EXPECT_TRUE(WaitFor(counter, expected));
+
+        return (Core::Time::Now().Ticks() - start);
+    }
+
+    static void Compare(const char name[], const uint8_t depth)
+    {
+        std::atomic<uint32_t> sharedCounter(0);
+        std::atomic<uint32_t> stealingCounter(0);
+        uint64_t shared, stealing;
+
+        {
+            SharedQueuePool pool(g_poolThreads);
+            shared = Storm([&pool](const Core::ProxyType<Core::IDispatch>& job) { pool.Submit(job); }, sharedCounter, depth);
+        }
+        {
+            Core::WorkerPoolType<g_poolThreads + 1> pool(0);
+            pool.Run();
+            stealing = Storm([&pool](const Core::ProxyType<Core::IDispatch>& job) { pool.Submit(job); }, stealingCounter, depth);
+            pool.Stop();
+        }
+
+        printf("%s storm of %d jobs: shared queue %d us, work stealing %d us\n", name, sharedCounter.load(),
+            static_cast<uint32_t>(shared), static_cast<uint32_t>(stealing));
+    }
+
+    TEST(Benchmark_WorkerPool, JSONRPCStorm)
+    {
+        Compare("JSON-RPC", 0);
+    }
+
+    TEST(Benchmark_WorkerPool, COMRPCStorm)
+    {
+        Compare("COM-RPC", 3);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include <broadcast/TableStore.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const TCHAR g_storeName[] = _T("/tmp/tablestore.test");
+
+    // Same layout as the TableStore writes it.
+    const uint32_t g_headerSize = 16;
+    const uint32_t g_recordSize = 16;
+
+    static void Fill(uint8_t buffer[], const uint32_t length, const uint8_t seed)
+    {
+        for (uint32_t index = 0; index < length; index++) {
+            buffer[index] = static_cast<uint8_t>(seed + index);
+        }
+    }
+
+    static uint32_t Loaded(const Broadcast::TableStore& store, const uint8_t tableId, const uint16_t extension, uint8_t& version, uint8_t& first, uint32_t& length)
+    {
+        uint32_t count = 0;
+
+        store.Load(tableId, [&](const Broadcast::TableStore::Key& key, const uint8_t tableVersion, const Core::DataElement& table) {
+            if (key.Extension() == extension) {
+                version = tableVersion;
+                first = (table.Size() > 0 ? table[0] : 0);
+                length = static_cast<uint32_t>(table.Size());
+            }
+            count++;
+        });
+
+        return (count);
+    }
+
+    TEST(Broadcast_TableStore, Reload)
+    {
+        Core::File(string(g_storeName)).Destroy();
+
+        uint8_t buffer[200];
+
+        {
+            Broadcast::TableStore store(g_storeName);
+            ASSERT_TRUE(store.IsValid());
+            EXPECT_EQ(store.Tables(), 0u);
+
+            for (uint16_t extension = 0; extension < 10; extension++) {
+                Fill(buffer, sizeof(buffer), static_cast<uint8_t>(extension));
+                EXPECT_TRUE(store.Update(Broadcast::TableStore::Key(0x42, extension, 1, extension), 3, Core::DataElement(sizeof(buffer), buffer)));
+            }
+            EXPECT_TRUE(store.Update(Broadcast::TableStore::Key(0x46, 7, 1, 7), 5, Core::DataElement(sizeof(buffer), buffer)));
+
+            // Storing the same version again is not needed.
+            EXPECT_FALSE(store.Update(Broadcast::TableStore::Key(0x46, 7, 1, 7), 5, Core::DataElement(sizeof(buffer), buffer)));
+            EXPECT_EQ(store.Tables(), 11u);
+        }
+
+        Broadcast::TableStore store(g_storeName);
+        ASSERT_TRUE(store.IsValid());
+        EXPECT_EQ(store.Tables(), 11u);
+        EXPECT_TRUE(store.IsCurrent(Broadcast::TableStore::Key(0x42, 4, 1, 4), 3));
+        EXPECT_TRUE(store.IsCurrent(Broadcast::TableStore::Key(0x46, 7, 1, 7), 5));
+        EXPECT_FALSE(store.IsCurrent(Broadcast::TableStore::Key(0x46, 7, 1, 7), 6));
+        EXPECT_FALSE(store.IsCurrent(Broadcast::TableStore::Key(0x46, 8, 1, 8), 5));
+
+        uint8_t version = 0, first = 0;
+        uint32_t length = 0;
+        EXPECT_EQ(Loaded(store, 0x42, 4, version, first, length), 10u);
+        EXPECT_EQ(version, 3);
+        EXPECT_EQ(first, 4);
+        EXPECT_EQ(length, sizeof(buffer));
+
+        Core::File(string(g_storeName)).Destroy();
+    }
+
+    TEST(Broadcast_TableStore, VersionUpdate)
+    {
+        Core::File(string(g_storeName)).Destroy();
+
+        uint8_t buffer[100];
+        const Broadcast::TableStore::Key key(0x42, 1, 1, 1);
+
+        {
+            Broadcast::TableStore store(g_storeName);
+            ASSERT_TRUE(store.IsValid());
+
+            Fill(buffer, sizeof(buffer), 10);
+            EXPECT_TRUE(store.Update(key, 1, Core::DataElement(sizeof(buffer), buffer)));
+            Fill(buffer, sizeof(buffer), 20);
+            EXPECT_TRUE(store.Update(key, 2, Core::DataElement(sizeof(buffer) / 2, buffer)));
+
+            EXPECT_EQ(store.Tables(), 1u);
+            EXPECT_FALSE(store.IsCurrent(key, 1));
+            EXPECT_TRUE(store.IsCurrent(key, 2));
+        }
+
+        Broadcast::TableStore store(g_storeName);
+        EXPECT_EQ(store.Tables(), 1u);
+        EXPECT_TRUE(store.IsCurrent(key, 2));
+
+        uint8_t version = 0, first = 0;
+        uint32_t length = 0;
+        EXPECT_EQ(Loaded(store, 0x42, 1, version, first, length), 1u);
+        EXPECT_EQ(version, 2);
+        EXPECT_EQ(first, 20);
+        EXPECT_EQ(length, sizeof(buffer) / 2);
+
+        Core::File(string(g_storeName)).Destroy();
+    }
+
+    TEST(Broadcast_TableStore, Compaction)
+    {
+        Core::File(string(g_storeName)).Destroy();
+
+        uint8_t buffer[1000];
+        const Broadcast::TableStore::Key key(0x50, 1, 1, 1);
+        const Broadcast::TableStore::Key other(0x50, 2, 1, 2);
+        uint64_t initialSize = 0;
+
+        {
+            Broadcast::TableStore store(g_storeName);
+            ASSERT_TRUE(store.IsValid());
+            initialSize = Core::File(string(g_storeName)).Size();
+
+            Fill(buffer, sizeof(buffer), 99);
+            EXPECT_TRUE(store.Update(other, 9, Core::DataElement(sizeof(buffer), buffer)));
+
+            // Many times the size of the file, only possible if the superseded versions are dropped.
+            for (uint32_t round = 0; round < 500; round++) {
+                Fill(buffer, sizeof(buffer), static_cast<uint8_t>(round));
+                EXPECT_TRUE(store.Update(key, static_cast<uint8_t>(round % 32), Core::DataElement(sizeof(buffer), buffer)));
+            }
+
+            EXPECT_EQ(store.Tables(), 2u);
+        }
+
+        EXPECT_EQ(Core::File(string(g_storeName)).Size(), initialSize);
+        EXPECT_FALSE(Core::File(string(g_storeName) + _T(".compact")).Exists());
+
+        Broadcast::TableStore store(g_storeName);
+        EXPECT_EQ(store.Tables(), 2u);
+        EXPECT_TRUE(store.IsCurrent(key, 499 % 32));
+        EXPECT_TRUE(store.IsCurrent(other, 9));
+
+        uint8_t version = 0, first = 0;
+        uint32_t length = 0;
+        Loaded(store, 0x50, 1, version, first, length);
+        EXPECT_EQ(first, static_cast<uint8_t>(499));
+        Loaded(store, 0x50, 2, version, first, length);
+        EXPECT_EQ(first, 99);
+
+        Core::File(string(g_storeName)).Destroy();
+    }
+
+    TEST(Broadcast_TableStore, Growth)
+    {
+        Core::File(string(g_storeName)).Destroy();
+
+        uint8_t buffer[1000];
+        uint64_t initialSize = 0;
+
+        {
+            Broadcast::TableStore store(g_storeName);
+            ASSERT_TRUE(store.IsValid());
+            initialSize = Core::File(string(g_storeName)).Size();
+
+            // Three times the initial size, nothing superseded, so the file has to grow.
+            const uint16_t tables = static_cast<uint16_t>((3 * initialSize) / sizeof(buffer));
+
+            for (uint16_t extension = 0; extension < tables; extension++) {
+                Fill(buffer, sizeof(buffer), static_cast<uint8_t>(extension));
+                EXPECT_TRUE(store.Update(Broadcast::TableStore::Key(0x60, extension, 1, extension), 1, Core::DataElement(sizeof(buffer), buffer)));
+            }
+
+            EXPECT_EQ(store.Tables(), tables);
+        }
+
+        // Doubled twice, not grown table by table to just what is used. The mapping adds a page at most.
+        EXPECT_GE(Core::File(string(g_storeName)).Size(), 4 * initialSize);
+        EXPECT_LT(Core::File(string(g_storeName)).Size(), 5 * initialSize);
+
+        Broadcast::TableStore store(g_storeName);
+        EXPECT_EQ(store.Tables(), static_cast<uint32_t>((3 * initialSize) / sizeof(buffer)));
+
+        Core::File(string(g_storeName)).Destroy();
+    }
+
+    TEST(Broadcast_TableStore, CorruptTail)
+    {
+        Core::File(string(g_storeName)).Destroy();
+
+        uint8_t buffer[64];
+        uint32_t lastRecord = 0;
+
+        {
+            Broadcast::TableStore store(g_storeName);
+            ASSERT_TRUE(store.IsValid());
+
+            for (uint16_t extension = 0; extension < 3; extension++) {
+                Fill(buffer, sizeof(buffer), static_cast<uint8_t>(extension));
+                EXPECT_TRUE(store.Update(Broadcast::TableStore::Key(0x42, extension, 1, extension), 1, Core::DataElement(sizeof(buffer), buffer)));
+            }
+            lastRecord = g_headerSize + (2 * (g_recordSize + sizeof(buffer)));
+        }
+
+        {
+            // A record that was only partially written: its size runs past what is in use.
+            Core::DataElementFile file(g_storeName, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE);
+            ASSERT_TRUE(file.IsValid());
+            file.SetNumber<uint32_t, Core::ENDIAN_LITTLE>(lastRecord, 0x10000);
+        }
+
+        {
+            Broadcast::TableStore store(g_storeName);
+            ASSERT_TRUE(store.IsValid());
+            EXPECT_EQ(store.Tables(), 2u);
+            EXPECT_TRUE(store.IsCurrent(Broadcast::TableStore::Key(0x42, 1, 1, 1), 1));
+            EXPECT_FALSE(store.IsCurrent(Broadcast::TableStore::Key(0x42, 2, 1, 2), 1));
+
+            // The space of the cut off record is used again.
+            EXPECT_TRUE(store.Update(Broadcast::TableStore::Key(0x42, 2, 1, 2), 1, Core::DataElement(sizeof(buffer), buffer)));
+            EXPECT_EQ(store.Tables(), 3u);
+        }
+
+        {
+            Core::DataElementFile file(g_storeName, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE);
+            ASSERT_TRUE(file.IsValid());
+            file.SetNumber<uint32_t, Core::ENDIAN_LITTLE>(0, 0xDEADBEEF);
+        }
+
+        // Not a store at all, start over.
+        Broadcast::TableStore store(g_storeName);
+        ASSERT_TRUE(store.IsValid());
+        EXPECT_EQ(store.Tables(), 0u);
+        EXPECT_TRUE(store.Update(Broadcast::TableStore::Key(0x42, 0, 1, 0), 1, Core::DataElement(sizeof(buffer), buffer)));
+
+        Core::File(string(g_storeName)).Destroy();
+    }
+
+} // Tests
+} // WPEFramework
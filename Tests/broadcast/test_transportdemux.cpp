@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+#include <broadcast/TransportDemux.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // A PAT as it was recorded from a multiplex: transport stream 1, program 1 on PID 0x20.
+    const uint8_t g_pat[] = {
+        0x47, 0x40, 0x00, 0x10, 0x00,
+        0x00, 0xB0, 0x0D, 0x00, 0x01, 0xC1, 0x00, 0x00,
+        0x00, 0x01, 0xE0, 0x20,
+        0xA2, 0xC3, 0x29, 0x41
+    };
+
+    const uint16_t g_sectionPid = 0x0100;
+    const uint8_t g_sectionTable = 0x42;
+    const uint16_t g_sectionLength = 300;
+
+    class Collector : public Broadcast::ISection {
+    public:
+        Collector(const Collector&) = delete;
+        Collector& operator=(const Collector&) = delete;
+
+        Collector()
+            : Sections(0)
+            , Extension(0)
+            , Length(0)
+        {
+        }
+        ~Collector() override
+        {
+        }
+
+    public:
+        void Handle(const Broadcast::MPEG::Section& section) override
+        {
+            Sections++;
+            Extension = section.Extension();
+            Length = section.Length();
+        }
+
+    public:
+        uint32_t Sections;
+        uint16_t Extension;
+        uint16_t Length;
+    };
+
+    // Pads what was recorded of a packet with stuffing.
+    static void Recorded(uint8_t packet[], const uint8_t data[], const uint8_t length, const uint8_t continuity)
+    {
+        ::memset(packet, 0xFF, Broadcast::TransportDemux::PacketSize);
+        ::memcpy(packet, data, length);
+        packet[3] = (packet[3] & 0xF0) | (continuity & 0x0F);
+    }
+
+    // A section with section syntax and a valid CRC, too long for one packet, cut in two packets.
+    static void Section(uint8_t packets[2][Broadcast::TransportDemux::PacketSize], const uint16_t extension, const uint8_t continuity)
+    {
+        uint8_t section[g_sectionLength];
+        const uint16_t length = g_sectionLength - 3;
+
+        section[0] = g_sectionTable;
+        section[1] = 0xB0 | ((length >> 8) & 0x0F);
+        section[2] = (length & 0xFF);
+        section[3] = (extension >> 8);
+        section[4] = (extension & 0xFF);
+        section[5] = 0xC1;
+        section[6] = 0x00;
+        section[7] = 0x00;
+        for (uint16_t index = 8; index < (g_sectionLength - 4); index++) {
+            section[index] = static_cast<uint8_t>(index);
+        }
+
+        const uint32_t crc = Core::DataElement(g_sectionLength - 4, section).CRC32(0, g_sectionLength - 4);
+        section[g_sectionLength - 4] = (crc >> 24);
+        section[g_sectionLength - 3] = (crc >> 16) & 0xFF;
+        section[g_sectionLength - 2] = (crc >> 8) & 0xFF;
+        section[g_sectionLength - 1] = crc & 0xFF;
+
+        // Payload unit start and a pointer field in the first, the continuation in the second.
+        const uint8_t first = Broadcast::TransportDemux::PacketSize - 5;
+
+        ::memset(packets, 0xFF, 2 * Broadcast::TransportDemux::PacketSize);
+        packets[0][0] = 0x47;
+        packets[0][1] = 0x40 | (g_sectionPid >> 8);
+        packets[0][2] = (g_sectionPid & 0xFF);
+        packets[0][3] = 0x10 | (continuity & 0x0F);
+        packets[0][4] = 0x00;
+        ::memcpy(&(packets[0][5]), section, first);
+
+        packets[1][0] = 0x47;
+        packets[1][1] = (g_sectionPid >> 8);
+        packets[1][2] = (g_sectionPid & 0xFF);
+        packets[1][3] = 0x10 | ((continuity + 1) & 0x0F);
+        ::memcpy(&(packets[1][4]), &(section[first]), g_sectionLength - first);
+    }
+
+    TEST(Broadcast_TransportDemux, Chunks)
+    {
+        Broadcast::TransportDemux demux;
+        Collector collector;
+        uint8_t stream[3 * Broadcast::TransportDemux::PacketSize];
+
+        EXPECT_EQ(demux.Filter(0x0000, 0x00, &collector), Core::ERROR_NONE);
+        EXPECT_TRUE(demux.HasFilters());
+
+        for (uint8_t index = 0; index < 3; index++) {
+            Recorded(&(stream[index * Broadcast::TransportDemux::PacketSize]), g_pat, sizeof(g_pat), index);
+        }
+
+        // Chunks that do not end on a packet, and some garbage before the first sync byte.
+        const uint8_t garbage[] = { 0x00, 0x12, 0x34 };
+        EXPECT_EQ(demux.Process(garbage, sizeof(garbage)), 0u);
+        EXPECT_EQ(demux.Process(stream, 100), 0u);
+        EXPECT_EQ(demux.Process(&(stream[100]), 200), 1u);
+        EXPECT_EQ(demux.Process(&(stream[300]), sizeof(stream) - 300), 2u);
+
+        EXPECT_EQ(demux.Packets(), 3u);
+        EXPECT_EQ(collector.Sections, 3u);
+        EXPECT_EQ(demux.Sections(), 3u);
+        EXPECT_EQ(demux.Dropped(), 0u);
+        EXPECT_EQ(collector.Extension, 1);
+        EXPECT_EQ(collector.Length, 16);
+
+        // A repeated packet carries nothing new.
+        EXPECT_EQ(demux.Process(&(stream[2 * Broadcast::TransportDemux::PacketSize]), Broadcast::TransportDemux::PacketSize), 1u);
+        EXPECT_EQ(collector.Sections, 3u);
+
+        // Packets of a PID nobody filters are skipped.
+        EXPECT_EQ(demux.Filter(0x0000, 0x00, nullptr), Core::ERROR_NONE);
+        EXPECT_FALSE(demux.HasFilters());
+        EXPECT_EQ(demux.Process(stream, Broadcast::TransportDemux::PacketSize), 1u);
+        EXPECT_EQ(collector.Sections, 3u);
+    }
+
+    TEST(Broadcast_TransportDemux, ContinuityError)
+    {
+        Broadcast::TransportDemux demux;
+        Collector collector;
+        uint8_t packets[2][Broadcast::TransportDemux::PacketSize];
+
+        EXPECT_EQ(demux.Filter(g_sectionPid, g_sectionTable, &collector), Core::ERROR_NONE);
+
+        Section(packets, 7, 0);
+        EXPECT_EQ(demux.Process(packets[0], sizeof(packets)), 2u);
+        EXPECT_EQ(collector.Sections, 1u);
+        EXPECT_EQ(collector.Extension, 7);
+        EXPECT_EQ(collector.Length, g_sectionLength);
+
+        // The continuation went missing, the next section starts before the one in progress is complete.
+        Section(packets, 8, 2);
+        EXPECT_EQ(demux.Process(packets[0], Broadcast::TransportDemux::PacketSize), 1u);
+        Section(packets, 9, 4);
+        EXPECT_EQ(demux.Process(packets[0], sizeof(packets)), 2u);
+
+        EXPECT_EQ(collector.Sections, 2u);
+        EXPECT_EQ(collector.Extension, 9);
+        EXPECT_EQ(demux.Dropped(), 1u);
+
+        // A continuation that does not follow the start, its section is dropped.
+        Section(packets, 10, 6);
+        packets[1][3] = 0x10 | 8;
+        EXPECT_EQ(demux.Process(packets[0], sizeof(packets)), 2u);
+
+        EXPECT_EQ(collector.Sections, 2u);
+        EXPECT_EQ(demux.Dropped(), 2u);
+
+        // A corrupted section does not pass the CRC.
+        Section(packets, 11, 9);
+        packets[1][10] ^= 0xFF;
+        EXPECT_EQ(demux.Process(packets[0], sizeof(packets)), 2u);
+
+        EXPECT_EQ(collector.Sections, 2u);
+        EXPECT_EQ(demux.Dropped(), 3u);
+        EXPECT_EQ(demux.Sections(), 2u);
+    }
+
+    TEST(Broadcast_TransportDemux, Reset)
+    {
+        Broadcast::TransportDemux demux;
+        Collector collector;
+        uint8_t packets[2][Broadcast::TransportDemux::PacketSize];
+
+        EXPECT_EQ(demux.Filter(g_sectionPid, g_sectionTable, &collector), Core::ERROR_NONE);
+
+        // Half a packet and half a section are pending, e.g. before tuning to another transport stream.
+        Section(packets, 3, 0);
+        EXPECT_EQ(demux.Process(packets[0], Broadcast::TransportDemux::PacketSize + 50), 1u);
+        demux.Reset();
+
+        // The stream continues at a packet, the half that was pending does not complete it, and the
+        // continuation in it is not added to the half section.
+        EXPECT_EQ(demux.Process(packets[1], Broadcast::TransportDemux::PacketSize), 1u);
+        EXPECT_EQ(collector.Sections, 0u);
+        EXPECT_EQ(demux.Dropped(), 0u);
+
+        // Any continuity counter is fine after a reset.
+        Section(packets, 4, 11);
+        EXPECT_EQ(demux.Process(packets[0], sizeof(packets)), 2u);
+        EXPECT_EQ(collector.Sections, 1u);
+        EXPECT_EQ(collector.Extension, 4);
+        EXPECT_EQ(demux.Dropped(), 0u);
+    }
+
+    TEST(Broadcast_TransportDemux, Filters)
+    {
+        Broadcast::TransportDemux demux;
+        Collector first;
+        Collector second;
+        uint8_t packets[2][Broadcast::TransportDemux::PacketSize];
+
+        EXPECT_EQ(demux.Tables(g_sectionPid), 0);
+        EXPECT_EQ(demux.Filter(g_sectionPid, g_sectionTable, nullptr), Core::ERROR_UNAVAILABLE);
+
+        EXPECT_EQ(demux.Filter(g_sectionPid, g_sectionTable, &first), Core::ERROR_NONE);
+        EXPECT_EQ(demux.Filter(g_sectionPid, g_sectionTable + 1, &first), Core::ERROR_NONE);
+        EXPECT_EQ(demux.Tables(g_sectionPid), 2);
+
+        // Another callback for the same table replaces the first one, it is not another table.
+        EXPECT_EQ(demux.Filter(g_sectionPid, g_sectionTable, &second), Core::ERROR_NONE);
+        EXPECT_EQ(demux.Tables(g_sectionPid), 2);
+
+        Section(packets, 5, 0);
+        EXPECT_EQ(demux.Process(packets[0], sizeof(packets)), 2u);
+        EXPECT_EQ(first.Sections, 0u);
+        EXPECT_EQ(second.Sections, 1u);
+
+        EXPECT_EQ(demux.Filter(g_sectionPid, g_sectionTable, nullptr), Core::ERROR_NONE);
+        EXPECT_EQ(demux.Tables(g_sectionPid), 1);
+        EXPECT_EQ(demux.Filter(g_sectionPid, g_sectionTable + 1, nullptr), Core::ERROR_NONE);
+        EXPECT_EQ(demux.Tables(g_sectionPid), 0);
+        EXPECT_FALSE(demux.HasFilters());
+    }
+
+} // Tests
+} // WPEFramework
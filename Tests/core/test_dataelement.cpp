@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint32_t g_crcBufferSize = 4096;
+
+    // The MPEG-2 CRC, one bit at a time.
+    static uint32_t ReferenceCRC32(const uint8_t data[], const uint32_t length)
+    {
+        uint32_t crc = 0xFFFFFFFF;
+
+        for (uint32_t index = 0; index < length; index++) {
+            crc ^= (static_cast<uint32_t>(data[index]) << 24);
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                crc = (crc << 1) ^ ((crc & 0x80000000) != 0 ? 0x04C11DB7 : 0);
+            }
+        }
+
+        return (crc);
+    }
+
+    TEST(Core_DataElement, CRC32)
+    {
+        uint8_t buffer[g_crcBufferSize];
+
+        for (uint32_t index = 0; index < sizeof(buffer); index++) {
+            buffer[index] = static_cast<uint8_t>((index * 7919) ^ (index >> 5));
+        }
+
+        Core::DataElement element(sizeof(buffer), buffer);
+
+        const char check[] = "123456789";
+        Core::DataElement text(9, reinterpret_cast<uint8_t*>(const_cast<char*>(check)));
+        EXPECT_EQ(text.CRC32(0, 9), 0x0376E6E7u);
+
+        EXPECT_EQ(element.CRC32(0, 0), 0xFFFFFFFFu);
+
+        // All lengths around the block sizes of the table and the folding, from aligned and unaligned offsets.
+        for (uint32_t offset = 0; offset < 9; offset++) {
+            for (uint32_t length = 1; length < 300; length++) {
+                EXPECT_EQ(element.CRC32(offset, length), ReferenceCRC32(&(buffer[offset]), length)) << "offset " << offset << " length " << length;
+            }
+        }
+
+        EXPECT_EQ(element.CRC32(0, sizeof(buffer)), ReferenceCRC32(buffer, sizeof(buffer)));
+
+        // A section with its CRC appended validates to 0.
+        const uint32_t crc = element.CRC32(0, 1020);
+        buffer[1020] = static_cast<uint8_t>(crc >> 24);
+        buffer[1021] = static_cast<uint8_t>(crc >> 16);
+        buffer[1022] = static_cast<uint8_t>(crc >> 8);
+        buffer[1023] = static_cast<uint8_t>(crc);
+        EXPECT_EQ(element.CRC32(0, 1024), 0u);
+    }
+
+} // Tests
+} // WPEFramework
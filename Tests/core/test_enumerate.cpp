@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // The request header keywords as the web serializer knows them.
+    enum class TestHeader {
+        HOST,
+        UPGRADE,
+        ORIGIN,
+        CONNECTION,
+        ACCEPT,
+        ACCEPT_ENCODING,
+        USERAGENT,
+        CONTENT_TYPE,
+        CONTENT_ENCODING,
+        CONTENT_LENGTH,
+        CONTENT_SIGNATURE,
+        TRANSFER_ENCODING,
+        LANGUAGE,
+        ACCESS_CONTROL_REQUEST_METHOD,
+        ACCESS_CONTROL_REQUEST_HEADERS,
+        WEBSOCKET_KEY,
+        WEBSOCKET_PROTOCOL,
+        WEBSOCKET_VERSION,
+        MAN,
+        M_X,
+        S_T,
+        AUTHORIZATION,
+        ALIAS
+    };
+
+    // What EnumerateType did before it had an index: a scan through the table.
+    static const Core::EnumerateConversion<TestHeader>* Scan(const TCHAR value[], const bool caseSensitive)
+    {
+        uint16_t index = 0;
+        const Core::EnumerateConversion<TestHeader>* runner = Core::EnumerateType<TestHeader>::Entry(index);
+
+        while ((runner != nullptr) && ((caseSensitive ? _tcscmp(runner->name, value) : _tcsicmp(runner->name, value)) != 0)) {
+            runner = Core::EnumerateType<TestHeader>::Entry(++index);
+        }
+
+        return (runner);
+    }
+
+    static const Core::EnumerateConversion<TestHeader>* Scan(const TestHeader value)
+    {
+        uint16_t index = 0;
+        const Core::EnumerateConversion<TestHeader>* runner = Core::EnumerateType<TestHeader>::Entry(index);
+
+        while ((runner != nullptr) && (runner->value != value)) {
+            runner = Core::EnumerateType<TestHeader>::Entry(++index);
+        }
+
+        return (runner);
+    }
+
+    TEST(Core_Enumerate, Lookup)
+    {
+        uint16_t index = 0;
+        const Core::EnumerateConversion<TestHeader>* entry;
+
+        // Every entry resolves, both ways, to what a scan through the table finds.
+        while ((entry = Core::EnumerateType<TestHeader>::Entry(index++)) != nullptr) {
+            Core::EnumerateType<TestHeader> byName(entry->name, true);
+            Core::EnumerateType<TestHeader> byValue(entry->value);
+
+            EXPECT_TRUE(byName.IsSet());
+            EXPECT_EQ(byName.Value(), Scan(entry->name, true)->value);
+            EXPECT_STREQ(byValue.Data(), Scan(entry->value)->name);
+        }
+
+        EXPECT_EQ(Core::EnumerateIndex<TestHeader>::Hash(_T("Sec-WebSocket-Key:"), 18, false), Core::EnumerateIndex<TestHeader>::Hash(_T("SEC-WEBSOCKET-KEY:"), 18, false));
+        EXPECT_NE(Core::EnumerateIndex<TestHeader>::Hash(_T("Sec-WebSocket-Key:"), 18, true), Core::EnumerateIndex<TestHeader>::Hash(_T("SEC-WEBSOCKET-KEY:"), 18, true));
+
+        // Case insensitive, also on a fragment of a larger text.
+        EXPECT_EQ(Core::EnumerateType<TestHeader>(_T("content-length:"), false).Value(), TestHeader::CONTENT_LENGTH);
+        EXPECT_FALSE(Core::EnumerateType<TestHeader>(_T("content-length:"), true).IsSet());
+        EXPECT_EQ(Core::EnumerateType<TestHeader>(Core::TextFragment(_T("xxSec-WebSocket-Key:xx"), 2, 18), false).Value(), TestHeader::WEBSOCKET_KEY);
+        EXPECT_EQ(Core::EnumerateType<TestHeader>(Core::TextFragment(_T("xxSEC-WEBSOCKET-KEY:xx"), 2, 18), true).Value(), TestHeader::WEBSOCKET_KEY);
+        EXPECT_FALSE(Core::EnumerateType<TestHeader>(Core::TextFragment(_T("xxSEC-WEBSOCKET-KEY:xx"), 2, 17), true).IsSet());
+
+        // Unknown names and values.
+        EXPECT_FALSE(Core::EnumerateType<TestHeader>(_T("X-UNKNOWN:"), false).IsSet());
+        EXPECT_FALSE(Core::EnumerateType<TestHeader>(_T(""), false).IsSet());
+        EXPECT_STREQ(Core::EnumerateType<TestHeader>(static_cast<uint32_t>(0x1234)).Data(), _T(""));
+
+        // Aliases: the first name of a value is the name of that value, the first value of a name its value.
+        EXPECT_EQ(Core::EnumerateType<TestHeader>(_T("ACCEPT-LANGUAGE:"), true).Value(), TestHeader::LANGUAGE);
+        EXPECT_EQ(Core::EnumerateType<TestHeader>(_T("LANGUAGE:"), true).Value(), TestHeader::LANGUAGE);
+        EXPECT_STREQ(Core::EnumerateType<TestHeader>(TestHeader::LANGUAGE).Data(), _T("ACCEPT-LANGUAGE:"));
+        EXPECT_EQ(Core::EnumerateType<TestHeader>(_T("ACCEPT:"), true).Value(), TestHeader::ACCEPT);
+    }
+
+} // Tests
+
+ENUM_CONVERSION_BEGIN(Tests::TestHeader)
+
+    { Tests::TestHeader::HOST, _TXT("HOST:") },
+    { Tests::TestHeader::UPGRADE, _TXT("UPGRADE:") },
+    { Tests::TestHeader::ORIGIN, _TXT("ORIGIN:") },
+    { Tests::TestHeader::CONNECTION, _TXT("CONNECTION:") },
+    { Tests::TestHeader::ACCEPT, _TXT("ACCEPT:") },
+    { Tests::TestHeader::ACCEPT_ENCODING, _TXT("ACCEPT-ENCODING:") },
+    { Tests::TestHeader::USERAGENT, _TXT("USER-AGENT:") },
+    { Tests::TestHeader::CONTENT_TYPE, _TXT("CONTENT-TYPE:") },
+    { Tests::TestHeader::CONTENT_ENCODING, _TXT("CONTENT-ENCODING:") },
+    { Tests::TestHeader::CONTENT_LENGTH, _TXT("CONTENT-LENGTH:") },
+    { Tests::TestHeader::CONTENT_SIGNATURE, _TXT("CONTENT-HMAC:") },
+    { Tests::TestHeader::TRANSFER_ENCODING, _TXT("TRANSFER-ENCODING:") },
+    { Tests::TestHeader::LANGUAGE, _TXT("ACCEPT-LANGUAGE:") },
+    { Tests::TestHeader::ACCESS_CONTROL_REQUEST_METHOD, _TXT("ACCESS-CONTROL-REQUEST-METHOD:") },
+    { Tests::TestHeader::ACCESS_CONTROL_REQUEST_HEADERS, _TXT("ACCESS-CONTROL-REQUEST-HEADERS:") },
+    { Tests::TestHeader::WEBSOCKET_KEY, _TXT("SEC-WEBSOCKET-KEY:") },
+    { Tests::TestHeader::WEBSOCKET_PROTOCOL, _TXT("SEC-WEBSOCKET-PROTOCOL:") },
+    { Tests::TestHeader::WEBSOCKET_VERSION, _TXT("SEC-WEBSOCKET-VERSION:") },
+    { Tests::TestHeader::MAN, _TXT("MAN:") },
+    { Tests::TestHeader::M_X, _TXT("MX:") },
+    { Tests::TestHeader::S_T, _TXT("ST:") },
+    { Tests::TestHeader::AUTHORIZATION, _TXT("AUTHORIZATION:") },
+    { Tests::TestHeader::LANGUAGE, _TXT("LANGUAGE:") },
+    { Tests::TestHeader::ALIAS, _TXT("ACCEPT:") },
+
+ENUM_CONVERSION_END(Tests::TestHeader)
+
+} // WPEFramework
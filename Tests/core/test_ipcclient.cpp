@@ -48,5 +48,30 @@ namespace Tests {
         }
         testAdmin.Sync("done testing");
     }
+
+    TEST(Core_IPC, LargeBuffer)
+    {
+        // More than fits in 16 bits, transferred in chunks like the IPC channel does.
+        std::vector<uint8_t> data(200000);
+        for (uint32_t index = 0; index < data.size(); index++) {
+            data[index] = static_cast<uint8_t>(index * 7);
+        }
+
+        Core::IPC::BufferType<1024> source(static_cast<uint32_t>(data.size()), data.data());
+        Core::IPC::BufferType<1024> destination;
+        uint8_t chunk[0xFFFF];
+        uint32_t offset = 0;
+
+        EXPECT_EQ(source.Length(), data.size());
+
+        while (offset < source.Length()) {
+            uint16_t loaded = source.Serialize(chunk, sizeof(chunk), offset);
+            EXPECT_EQ(destination.Deserialize(chunk, loaded, offset), loaded);
+            offset += loaded;
+        }
+
+        EXPECT_EQ(destination.Length(), data.size());
+        EXPECT_EQ(::memcmp(destination.Value(), data.data(), data.size()), 0);
+    }
 } // Tests
 } // WPEFramework
@@ -0,0 +1,106 @@
+#include "../EchoPipeline.h"
+
+namespace WPEFramework {
+namespace Tests {
+
+    const TCHAR g_pipelineConnector[] = _T("/tmp/testpipeline");
+    const uint32_t g_pipelineCalls = 200;
+
+    TEST(Core_IPC, PipelinedOutOfOrder)
+    {
+        PipelineSetup setup(g_pipelineConnector);
+        std::atomic<uint32_t> succeeded(0);
+        std::vector<std::thread> threads;
+
+        // The first caller gets the slowest answer, so the responses come back in reverse order.
+        for (uint16_t index = 0; index < 8; index++) {
+            threads.emplace_back([&setup, index, &succeeded]() {
+                if (setup.Call(index, (8 - index) * 20) == true) {
+                    succeeded++;
+                }
+            });
+            SleepMs(2);
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(succeeded.load(), 8u);
+    }
+
+    TEST(Core_IPC, PipelinedConcurrent)
+    {
+        PipelineSetup setup(g_pipelineConnector);
+
+        for (uint8_t callers = 1; callers <= 8; callers <<= 1) {
+            EXPECT_EQ(setup.Concurrent(callers, g_pipelineCalls / callers), (g_pipelineCalls / callers) * callers);
+        }
+    }
+
+    // Completes asynchronous calls, the first "chains" completions each start the next call from within the completion.
+    class Chained : public Core::IDispatchType<Core::IIPC> {
+    public:
+        Chained() = delete;
+        Chained(const Chained&) = delete;
+        Chained& operator=(const Chained&) = delete;
+
+        Chained(Core::IPCChannel& channel, const uint32_t chains)
+            : _channel(channel)
+            , _chains(chains)
+            , _completed(0)
+        {
+        }
+        ~Chained() override
+        {
+        }
+
+    public:
+        uint32_t Completed() const
+        {
+            return (_completed.load());
+        }
+        void Dispatch(Core::IIPC& /* element */) override
+        {
+            if (_completed++ < _chains) {
+                Core::ProxyType<EchoMessage> message(Core::ProxyType<EchoMessage>::Create());
+                message->Parameters() = 1;
+                EXPECT_EQ(_channel.Invoke(message, this), Core::ERROR_NONE);
+            }
+        }
+
+    private:
+        Core::IPCChannel& _channel;
+        const uint32_t _chains;
+        std::atomic<uint32_t> _completed;
+    };
+
+    TEST(Core_IPC, AbortReentrant)
+    {
+        const uint32_t calls = 16;
+        PipelineSetup setup(g_pipelineConnector);
+        Chained chained(setup.Client(), calls);
+
+        // Answered only after the abort, which completes them right away and chains the next calls.
+        for (uint32_t index = 0; index < calls; index++) {
+            Core::ProxyType<EchoMessage> message(Core::ProxyType<EchoMessage>::Create());
+            message->Parameters() = (static_cast<uint32_t>(200) << 16) | index;
+            EXPECT_EQ(setup.Client().Invoke(message, &chained), Core::ERROR_NONE);
+        }
+
+        setup.Client().Abort();
+        EXPECT_EQ(chained.Completed(), calls);
+
+        uint32_t timeout = 5000;
+        while ((chained.Completed() < (2 * calls)) && (timeout != 0)) {
+            SleepMs(1);
+            timeout--;
+        }
+        EXPECT_EQ(chained.Completed(), 2 * calls);
+
+        // The late answers to the aborted calls are dropped.
+        SleepMs(500);
+        EXPECT_EQ(chained.Completed(), 2 * calls);
+    }
+
+} // Tests
+} // WPEFramework
@@ -749,6 +749,170 @@ namespace Tests {
         ExecutePrimitiveJsonTest<Core::JSON::EnumType<JSONTestEnum>>(data, false, nullptr);
     }
 
+
+    // A configuration/JSON-RPC payload like object with many members.
+    class WideJson : public Core::JSON::Container {
+    public:
+        WideJson(const WideJson&) = delete;
+        WideJson& operator=(const WideJson&) = delete;
+
+        WideJson(const uint8_t fields)
+            : Core::JSON::Container()
+            , _labels()
+            , _values(fields)
+        {
+            for (uint8_t index = 0; index < fields; index++) {
+                _labels.emplace_back(Label(index));
+            }
+            for (uint8_t index = 0; index < fields; index++) {
+                Add(_labels[index].c_str(), &(_values[index]));
+            }
+        }
+        ~WideJson() override
+        {
+        }
+
+    public:
+        static string Label(const uint8_t index)
+        {
+            // Shared prefixes, like real world member names.
+            return (_T("configuration") + Core::NumberType<uint8_t>(index).Text());
+        }
+        static string Serialized(const uint8_t fields)
+        {
+            string result(_T("{"));
+
+            // Reversed, so a linear lookup gets no help from the order.
+            for (uint8_t index = fields; index > 0; index--) {
+                result += '\"' + Label(index - 1) + _T("\":") + Core::NumberType<uint8_t>(index - 1).Text() + (index > 1 ? _T(",") : _T(""));
+            }
+
+            return (result + '}');
+        }
+        const Core::JSON::DecUInt32& Value(const uint8_t index) const
+        {
+            return (_values[index]);
+        }
+        void Drop(const uint8_t index)
+        {
+            Remove(_labels[index].c_str());
+        }
+
+    private:
+        std::vector<string> _labels;
+        std::vector<Core::JSON::DecUInt32> _values;
+    };
+
+    TEST(JSONParser, WideObject)
+    {
+        WideJson object(40);
+
+        EXPECT_TRUE(object.FromString(WideJson::Serialized(40)));
+
+        for (uint8_t index = 0; index < 40; index++) {
+            EXPECT_TRUE(object.HasLabel(WideJson::Label(index)));
+            EXPECT_EQ(object.Value(index).Value(), index);
+        }
+        EXPECT_FALSE(object.HasLabel(_T("configuration40")));
+
+        // The index follows the members that are removed.
+        for (uint8_t index = 0; index < 40; index += 2) {
+            object.Drop(index);
+            EXPECT_FALSE(object.HasLabel(WideJson::Label(index)));
+            EXPECT_TRUE(object.HasLabel(WideJson::Label(index + 1)));
+        }
+    }
+
+    TEST(JSONParser, VariantContainerReparse)
+    {
+        Core::JSON::VariantContainer container;
+        uint32_t count = 0;
+
+        EXPECT_TRUE(container.FromString(WideJson::Serialized(20)));
+        EXPECT_TRUE(container.FromString(WideJson::Serialized(20)));
+
+        Core::JSON::VariantContainer::Iterator index(container.Variants());
+        while (index.Next() == true) {
+            count++;
+        }
+
+        // Parsing known labels again does not add elements.
+        EXPECT_EQ(count, 20u);
+        EXPECT_EQ(container[_T("configuration7")].Number(), 7);
+    }
+
+    TEST(JSONParser, VariantContainerDuplicateLabel)
+    {
+        Core::JSON::VariantContainer container;
+        uint32_t count = 0;
+
+        EXPECT_TRUE(container.FromString(_T("{\"first\":1,\"second\":2,\"first\":3}")));
+
+        Core::JSON::VariantContainer::Iterator index(container.Variants());
+        while (index.Next() == true) {
+            count++;
+        }
+
+        // A label that occurs twice has one element, holding the last value.
+        EXPECT_EQ(count, 2u);
+        EXPECT_EQ(container[_T("first")].Number(), 3);
+        EXPECT_EQ(container[_T("second")].Number(), 2);
+
+        string serialized;
+        EXPECT_TRUE(container.ToString(serialized));
+        EXPECT_EQ(serialized, _T("{\"first\":3,\"second\":2}"));
+    }
+
+    TEST(JSONParser, LargeString)
+    {
+        // Beyond what a 16 bits length or offset can address.
+        const string text(200000, 'x');
+        Core::JSON::String source;
+        Core::JSON::String target;
+        string serialized;
+
+        source = text;
+        EXPECT_TRUE(source.ToString(serialized));
+        EXPECT_EQ(serialized.length(), text.length() + 2);
+
+        EXPECT_TRUE(target.FromString(serialized));
+        EXPECT_EQ(target.Value(), text);
+    }
+
+    TEST(JSONParser, LargeDocument)
+    {
+        // Some MB, far beyond what a 16 bits length or offset can address.
+        const string entry(1000, 'a');
+        const uint32_t entries = 4096;
+        Core::JSON::ArrayType<Core::JSON::String> source;
+        Core::JSON::ArrayType<Core::JSON::String> target;
+        string serialized;
+
+        for (uint32_t index = 0; index < entries; index++) {
+            source.Add() = entry;
+        }
+
+        EXPECT_TRUE(source.ToString(serialized));
+        EXPECT_GT(serialized.length(), entries * entry.length());
+
+        EXPECT_TRUE(target.FromString(serialized));
+        EXPECT_EQ(target.Length(), entries);
+        EXPECT_EQ(target[0].Value(), entry);
+        EXPECT_EQ(target[entries - 1].Value(), entry);
+    }
+
+    TEST(JSONParser, LargeBuffer)
+    {
+        // A base64 value decoding to more than a 16 bits index or length can address.
+        const string encoded = "\"" + string(140000, 'A') + "\"";
+        Core::OptionalType<Core::JSON::Error> error;
+        Core::JSON::Buffer target;
+
+        EXPECT_TRUE(target.FromString(encoded, error));
+        EXPECT_FALSE(error.IsSet());
+        EXPECT_TRUE(target.IsSet());
+    }
+
 } // Tests
 
 ENUM_CONVERSION_BEGIN(Tests::JSONTestEnum){ WPEFramework::Tests::JSONTestEnum::ONE, _TXT("one") },
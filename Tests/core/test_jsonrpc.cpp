@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    class EchoParameters : public Core::JSON::Container {
+    public:
+        EchoParameters(const EchoParameters&) = delete;
+        EchoParameters& operator=(const EchoParameters&) = delete;
+
+        EchoParameters()
+            : Core::JSON::Container()
+            , Name()
+            , Count(0)
+        {
+            Add(_T("name"), &Name);
+            Add(_T("count"), &Count);
+        }
+        ~EchoParameters() override
+        {
+        }
+
+    public:
+        Core::JSON::String Name;
+        Core::JSON::DecUInt32 Count;
+    };
+
+    static uint32_t Echo(const EchoParameters& inbound, EchoParameters& outbound)
+    {
+        outbound.Name = inbound.Name.Value();
+        outbound.Count = inbound.Count.Value() + 1;
+
+        return (Core::ERROR_NONE);
+    }
+
+    static void RegisterMethods(Core::JSONRPC::Handler& handler)
+    {
+        handler.Register<EchoParameters, EchoParameters>(_T("echo"), &Echo);
+        handler.Register<void, void>(_T("fail"), []() -> uint32_t { return (Core::ERROR_BAD_REQUEST); });
+    }
+
+    TEST(Core_JSONRPC, DispatchFromMessage)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, { 1 });
+        Core::JSONRPC::Message request;
+        Core::JSONRPC::Message response;
+        string text;
+
+        RegisterMethods(handler);
+
+        request.FromString(string(_T("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"Test.1.echo\",\"params\":{\"name\":\"thunder\",\"count\":41}}")));
+
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 1), request.FullMethod(), request.Parameters, response.Result), Core::ERROR_NONE);
+        EXPECT_EQ(response.Result.Value(), string(_T("{\"name\":\"thunder\",\"count\":42}")));
+
+        response.ToString(text);
+        EXPECT_EQ(text, string(_T("{\"result\":{\"name\":\"thunder\",\"count\":42}}")));
+
+        // A failing call leaves the result untouched.
+        response.Clear();
+        request.FromString(string(_T("{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"Test.1.fail\"}")));
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 2), request.FullMethod(), request.Parameters, response.Result), Core::ERROR_BAD_REQUEST);
+        EXPECT_FALSE(response.Result.IsSet());
+    }
+
+    TEST(Core_JSONRPC, DispatchLargeParameters)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, { 1 });
+        Core::JSONRPC::Message request;
+        Core::JSONRPC::Message response;
+        string parameters(_T("{\"name\":\""));
+        string result;
+
+        RegisterMethods(handler);
+
+        parameters += string(2048, 'x') + _T("\",\"count\":1}");
+        request.FromString(_T("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"Test.1.echo\",\"params\":") + parameters + _T("}"));
+
+        // Straight from the message gives the same as the string interface.
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 1), request.FullMethod(), request.Parameters.Value(), result), Core::ERROR_NONE);
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Connection(1, 1), request.FullMethod(), request.Parameters, response.Result), Core::ERROR_NONE);
+
+        EXPECT_EQ(response.Result.Value(), result);
+        EXPECT_EQ(result, _T("{\"name\":\"") + string(2048, 'x') + _T("\",\"count\":2}"));
+    }
+
+    TEST(Core_JSONRPC, NotificationFanOut)
+    {
+        std::list<std::pair<uint32_t, Core::ProxyType<Core::JSONRPC::Notification>>> sent;
+        Core::JSONRPC::Handler handler([&sent](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Payload>& data) {
+            Core::ProxyType<Core::JSONRPC::Notification> notification(Core::ProxyType<Core::JSONRPC::Notification>::Create());
+            notification->Set(designator, data);
+            sent.emplace_back(id, notification);
+        },
+            { 1 });
+        Core::JSONRPC::Message response;
+        EchoParameters parameters;
+
+        for (uint32_t id = 1; id <= 3; id++) {
+            handler.Subscribe(id, _T("statechange"), _T("client.events.") + Core::NumberType<uint32_t>(id).Text(), response);
+        }
+
+        parameters.Name = _T("thunder");
+        parameters.Count = 1;
+        EXPECT_EQ(handler.Notify(_T("statechange"), parameters), Core::ERROR_NONE);
+
+        ASSERT_EQ(sent.size(), 3u);
+
+        // Every subscriber gets its own method, the rest of the frame is identical to a regular message.
+        for (auto& entry : sent) {
+            Core::JSONRPC::Message message;
+            string expected, text;
+
+            message.JSONRPC = Core::JSONRPC::Message::DefaultVersion;
+            message.Designator = _T("client.events.") + Core::NumberType<uint32_t>(entry.first).Text() + _T(".statechange");
+            message.Parameters = _T("{\"name\":\"thunder\",\"count\":1}");
+            message.ToString(expected);
+
+            entry.second->ToString(text);
+            EXPECT_EQ(text, expected);
+
+            // Serializing in small chunks must yield the same frame.
+            char buffer[7];
+            uint32_t offset = 0;
+            uint32_t loaded;
+            text.clear();
+            do {
+                loaded = entry.second->Serialize(buffer, sizeof(buffer), offset);
+                text.append(buffer, loaded);
+            } while (offset != 0);
+            EXPECT_EQ(text, expected);
+        }
+
+        // Without parameters, there are no params in the frame.
+        sent.clear();
+        EXPECT_EQ(handler.Notify(_T("statechange")), Core::ERROR_NONE);
+        ASSERT_EQ(sent.size(), 3u);
+
+        string text;
+        sent.front().second->ToString(text);
+        EXPECT_EQ(text, string(_T("{\"jsonrpc\":\"2.0\",\"method\":\"client.events.1.statechange\"}")));
+    }
+
+} // Tests
+} // WPEFramework
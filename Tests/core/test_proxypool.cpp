@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint8_t g_poolThreads = 4;
+    const uint32_t g_poolRounds = 20000;
+
+    class PoolElement {
+    public:
+        PoolElement(const PoolElement&) = delete;
+        PoolElement& operator=(const PoolElement&) = delete;
+
+        PoolElement()
+            : Value(0)
+        {
+        }
+        ~PoolElement()
+        {
+        }
+
+    public:
+        void Clear()
+        {
+            Value = 0;
+        }
+
+    public:
+        uint32_t Value;
+    };
+
+    // Removing an entry shifts the ones after it down, over the ranges they were in.
+    TEST(Core_ProxyList, Remove)
+    {
+        Core::ProxyList<PoolElement> list(2);
+        std::vector<Core::ProxyType<PoolElement>> elements;
+
+        for (uint32_t index = 0; index < 6; index++) {
+            elements.push_back(Core::ProxyType<PoolElement>::Create());
+            elements.back()->Value = index;
+            list.Add(elements.back());
+        }
+
+        Core::ProxyType<PoolElement> removed;
+        list.Remove(0, removed);
+        EXPECT_EQ(removed->Value, 0u);
+
+        list.Remove(1);
+        list.Remove(1);
+
+        ASSERT_EQ(list.Count(), 3u);
+        EXPECT_EQ(list[0]->Value, 1u);
+        EXPECT_EQ(list[1]->Value, 4u);
+        EXPECT_EQ(list[2]->Value, 5u);
+
+        // The list holds a reference of its own.
+        EXPECT_EQ(elements[4].Release(), Core::ERROR_NONE);
+        EXPECT_EQ(list[1]->Value, 4u);
+
+        list.Remove(2);
+        list.Remove(1);
+        list.Remove(0, removed);
+        EXPECT_EQ(removed->Value, 1u);
+        EXPECT_EQ(list.Count(), 0u);
+    }
+
+    TEST(Core_ProxyPool, Recycle)
+    {
+        Core::ProxyPoolType<PoolElement> pool(2);
+        PoolElement* first;
+
+        {
+            Core::ProxyType<PoolElement> element(pool.Element());
+            first = &(*element);
+            element->Value = 42;
+        }
+
+        EXPECT_EQ(pool.CreatedElements(), 1u);
+        EXPECT_EQ(pool.QueuedElements(), 1u);
+
+        Core::ProxyType<PoolElement> element(pool.Element());
+
+        // The same one, cleared, handed out by the magazine of this thread.
+        EXPECT_EQ(&(*element), first);
+        EXPECT_EQ(element->Value, 0u);
+        EXPECT_EQ(pool.CreatedElements(), 1u);
+        EXPECT_EQ(pool.QueuedElements(), 0u);
+        EXPECT_EQ(pool.Hits(), 1u);
+        EXPECT_EQ(pool.Misses(), 1u);
+    }
+
+    TEST(Core_ProxyPool, Overflow)
+    {
+        Core::ProxyPoolType<PoolElement> pool(2);
+
+        for (uint8_t round = 0; round < 3; round++) {
+            std::list<Core::ProxyType<PoolElement>> elements;
+
+            // More than fit in a magazine, the rest goes to the queue of the pool.
+            for (uint8_t index = 0; index < 40; index++) {
+                elements.push_back(pool.Element());
+            }
+
+            EXPECT_EQ(pool.QueuedElements(), 0u);
+
+            elements.clear();
+
+            EXPECT_EQ(pool.QueuedElements(), 40u);
+        }
+
+        EXPECT_EQ(pool.CreatedElements(), 40u);
+        EXPECT_GT(pool.Hits(), 0u);
+    }
+
+    TEST(Core_ProxyPool, ThreadExit)
+    {
+        Core::ProxyPoolType<PoolElement> pool(2);
+
+        std::thread worker([&pool]() {
+            std::list<Core::ProxyType<PoolElement>> elements;
+
+            for (uint8_t index = 0; index < 5; index++) {
+                elements.push_back(pool.Element());
+            }
+        });
+        worker.join();
+
+        // Drained from the magazine of the worker, available to this thread.
+        EXPECT_EQ(pool.QueuedElements(), 5u);
+
+        std::list<Core::ProxyType<PoolElement>> elements;
+
+        for (uint8_t index = 0; index < 5; index++) {
+            elements.push_back(pool.Element());
+        }
+
+        EXPECT_EQ(pool.CreatedElements(), 5u);
+        EXPECT_EQ(pool.QueuedElements(), 0u);
+    }
+
+    TEST(Core_ProxyPool, PoolBeforeThread)
+    {
+        Core::Event destructed(false, true);
+        Core::Event filled(false, true);
+
+        std::thread worker;
+
+        {
+            Core::ProxyPoolType<PoolElement> pool(2);
+
+            worker = std::thread([&pool, &filled, &destructed]() {
+                pool.Element();
+                filled.SetEvent();
+
+                // The pool is gone before this thread is, nothing is returned to it on exit.
+                destructed.Lock(Core::infinite);
+            });
+
+            filled.Lock(Core::infinite);
+
+            EXPECT_EQ(pool.QueuedElements(), 1u);
+        }
+
+        destructed.SetEvent();
+        worker.join();
+    }
+
+    TEST(Core_ProxyPool, CrossThread)
+    {
+        Core::ProxyPoolType<PoolElement> pool(2);
+        std::vector<std::thread> workers;
+
+        for (uint8_t thread = 0; thread < g_poolThreads; thread++) {
+            workers.emplace_back([&pool]() {
+                std::list<Core::ProxyType<PoolElement>> elements;
+
+                for (uint32_t round = 0; round < g_poolRounds; round++) {
+                    elements.push_back(pool.Element());
+
+                    if (elements.size() > 3) {
+                        elements.pop_front();
+                    }
+                }
+            });
+        }
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        EXPECT_EQ(pool.Hits() + pool.Misses(), static_cast<uint32_t>(g_poolThreads * g_poolRounds));
+        EXPECT_EQ(pool.QueuedElements(), pool.CreatedElements());
+        EXPECT_LE(pool.CreatedElements(), static_cast<uint32_t>(g_poolThreads * 4));
+    }
+
+} // Tests
+} // WPEFramework
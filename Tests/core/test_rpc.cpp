@@ -1,3 +1,4 @@
+#include "../ExternalAccess.h"
 #include "../IPTestAdministrator.h"
 
 #include <gtest/gtest.h>
@@ -15,6 +16,11 @@ namespace Exchange {
         virtual uint32_t GetValue() = 0;
         virtual void Add(uint32_t value) = 0;
         virtual uint32_t GetPid() = 0;
+        virtual IAdder* Child(const uint32_t index) = 0;
+        // @oneway
+        virtual void Next(const uint32_t value) = 0;
+        virtual uint32_t Sum(const uint32_t length, const uint8_t data[] /* @length:length @blob */) = 0;
+        virtual uint32_t Peek(const int descriptor /* @descriptor */) = 0;
     };
 }
 }
@@ -27,8 +33,15 @@ class Adder : public Exchange::IAdder
 public:
     Adder()
         : m_value(0)
+        , m_children()
     {
     }
+    ~Adder()
+    {
+        for (Exchange::IAdder* child : m_children) {
+            child->Release();
+        }
+    }
 
     uint32_t GetValue()
     {
@@ -45,12 +58,52 @@ public:
         return getpid();
     }
 
+    Exchange::IAdder* Child(const uint32_t index)
+    {
+        while (m_children.size() <= index) {
+            m_children.push_back(Core::Service<Adder>::Create<Exchange::IAdder>());
+        }
+
+        m_children[index]->AddRef();
+
+        return m_children[index];
+    }
+
+    void Next(const uint32_t value)
+    {
+        // Only keeps on counting if the values come in the order they were sent.
+        m_value = (m_value == value ? value + 1 : ~0);
+    }
+
+    uint32_t Sum(const uint32_t length, const uint8_t data[])
+    {
+        uint32_t result = 0;
+
+        for (uint32_t index = 0; index < length; index++) {
+            result += data[index];
+        }
+
+        return result;
+    }
+
+    uint32_t Peek(const int descriptor)
+    {
+        uint32_t result = ~0;
+
+        if (::pread(descriptor, &result, sizeof(result), 0) != sizeof(result)) {
+            result = ~0;
+        }
+
+        return result;
+    }
+
     BEGIN_INTERFACE_MAP(Adder)
         INTERFACE_ENTRY(Exchange::IAdder)
     END_INTERFACE_MAP
 
 private:
     uint32_t m_value;
+    std::vector<Exchange::IAdder*> m_children;
 };
 
 // Proxystubs.
@@ -68,6 +121,10 @@ namespace WPEFramework {
     //  (0) virtual uint32_t GetValue() = 0
     //  (1) virtual void Add(uint32_t) = 0
     //  (2) virtual uint32_t GetPid() = 0
+    //  (3) virtual IAdder* Child(const uint32_t) = 0
+    //  (4) virtual void Next(const uint32_t) = 0 (one-way)
+    //  (5) virtual uint32_t Sum(const uint32_t, const uint8_t*) = 0
+    //  (6) virtual uint32_t Peek(const int) = 0
     //
 
     ProxyStub::MethodHandler AdderStubMethods[] = {
@@ -116,6 +173,82 @@ namespace WPEFramework {
             writer.Number<const uint32_t>(output);
         },
 
+        // virtual IAdder* Child(const uint32_t) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint32_t param0 = reader.Number<uint32_t>();
+
+            // call implementation
+            IAdder* implementation = input.Implementation<IAdder>();
+            ASSERT((implementation != nullptr) && "Null IAdder implementation pointer");
+            IAdder* output = implementation->Child(param0);
+
+            // write return value
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<IAdder*>(output);
+            RPC::Administrator::Instance().RegisterInterface(channel, output);
+        },
+
+        // virtual void Next(const uint32_t) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint32_t param0 = reader.Number<uint32_t>();
+
+            // call implementation
+            IAdder* implementation = input.Implementation<IAdder>();
+            ASSERT((implementation != nullptr) && "Null IAdder implementation pointer");
+            implementation->Next(param0);
+        },
+
+        // virtual uint32_t Sum(const uint32_t, const uint8_t*) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            RPC::Data::Blob param1_blob(*channel, reader.Number<uint32_t>());
+            const uint8_t* param1 = param1_blob.Buffer();
+            uint32_t param1_length = static_cast<uint32_t>(param1_blob.Length());
+
+            // call implementation
+            IAdder* implementation = input.Implementation<IAdder>();
+            ASSERT((implementation != nullptr) && "Null IAdder implementation pointer");
+            const uint32_t output = implementation->Sum(param1_length, param1);
+
+            // write return value
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<const uint32_t>(output);
+        },
+
+        // virtual uint32_t Peek(const int) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            RPC::Data::Descriptor param0_descriptor(*channel, reader.Number<uint32_t>());
+            const int param0 = param0_descriptor.Handle();
+
+            // call implementation
+            IAdder* implementation = input.Implementation<IAdder>();
+            ASSERT((implementation != nullptr) && "Null IAdder implementation pointer");
+            const uint32_t output = implementation->Peek(param0);
+
+            // write return value
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<const uint32_t>(output);
+        },
+
         nullptr
     }; // AdderStubMethods[]
 
@@ -130,6 +263,10 @@ namespace WPEFramework {
     //  (0) virtual uint32_t GetValue() = 0
     //  (1) virtual void Add(uint32_t) = 0
     //  (2) virtual uint32_t GetPid() = 0
+    //  (3) virtual IAdder* Child(const uint32_t) = 0
+    //  (4) virtual void Next(const uint32_t) = 0 (one-way)
+    //  (5) virtual uint32_t Sum(const uint32_t, const uint8_t*) = 0
+    //  (6) virtual uint32_t Peek(const int) = 0
     //
 
     class AdderProxy final : public ProxyStub::UnknownProxyType<IAdder> {
@@ -180,6 +317,75 @@ namespace WPEFramework {
 
             return output;
         }
+
+        IAdder* Child(const uint32_t param0) override
+        {
+            IPCMessage newMessage(BaseClass::Message(3));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Number<const uint32_t>(param0);
+
+            // invoke the method handler
+            IAdder* output_proxy{};
+            if (Invoke(newMessage) == Core::ERROR_NONE) {
+                // read return value
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output_proxy = reinterpret_cast<IAdder*>(Interface(reader.Number<void*>(), IAdder::ID));
+            }
+
+            return output_proxy;
+        }
+
+        void Next(uint32_t param0) override
+        {
+            IPCMessage newMessage(BaseClass::Message(4));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Number<const uint32_t>(param0);
+
+            // invoke the method handler
+            Post(newMessage);
+        }
+
+        uint32_t Sum(const uint32_t param0, const uint8_t* param1) override
+        {
+            IPCMessage newMessage(BaseClass::Message(5));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Number<uint32_t>(BaseClass::Blob(param0, param1));
+
+            // invoke the method handler
+            uint32_t output{};
+            if ((output = Invoke(newMessage)) == Core::ERROR_NONE) {
+                // read return value
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output = reader.Number<uint32_t>();
+            }
+
+            return output;
+        }
+
+        uint32_t Peek(const int param0) override
+        {
+            IPCMessage newMessage(BaseClass::Message(6));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Number<uint32_t>(BaseClass::Descriptor(param0));
+
+            // invoke the method handler
+            uint32_t output{};
+            if ((output = Invoke(newMessage)) == Core::ERROR_NONE) {
+                // read return value
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output = reader.Number<uint32_t>();
+            }
+
+            return output;
+        }
     }; // class AdderProxy
 
     // -----------------------------------------------------------------
@@ -201,47 +407,14 @@ namespace WPEFramework {
     } // namespace
 }
 
-namespace {
-class ExternalAccess : public RPC::Communicator
-{
-private:
-    ExternalAccess() = delete;
-    ExternalAccess(const ExternalAccess &) = delete;
-    ExternalAccess & operator=(const ExternalAccess &) = delete;
-
-public:
-    ExternalAccess(const Core::NodeId & source)
-        : RPC::Communicator(source, _T(""))
-    {
-        Open(Core::infinite);
-    }
-
-    ~ExternalAccess()
-    {
-        Close(Core::infinite);
-    }
-
-private:
-    virtual void* Aquire(const string& className, const uint32_t interfaceId, const uint32_t versionId)
-    {
-        void* result = nullptr;
-
-        if (interfaceId == Exchange::IAdder::ID) {
-            Exchange::IAdder * newAdder = Core::Service<Adder>::Create<Exchange::IAdder>();
-            result = newAdder;
-        }
-
-        return result;
-    }
-};
-}
+typedef Tests::ExternalAccess<Exchange::IAdder, Adder> AdderAccess;
 
 TEST(Core_RPC, adder)
 {
    IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator & testAdmin) {
       Core::NodeId remoteNode(g_connectorName.c_str());
 
-      ExternalAccess communicator(remoteNode);
+      AdderAccess communicator(remoteNode);
 
       testAdmin.Sync("setup server");
 
@@ -257,13 +430,7 @@ TEST(Core_RPC, adder)
    {
       Core::NodeId remoteNode(g_connectorName.c_str());
 
-      Core::ProxyType<RPC::InvokeServerType<4, 1>> engine(Core::ProxyType<RPC::InvokeServerType<4, 1>>::Create(Core::Thread::DefaultStackSize()));
-      Core::ProxyType<RPC::CommunicatorClient> client(
-           Core::ProxyType<RPC::CommunicatorClient>::Create(
-               remoteNode,
-               Core::ProxyType<Core::IIPCServer>(engine)
-           ));
-      engine->Announcements(client->Announcement());
+      Core::ProxyType<RPC::CommunicatorClient> client(Tests::ExternalClient(remoteNode));
 
       // Create remote instance of "IAdder".
       Exchange::IAdder * adder = client->Open<Exchange::IAdder>(_T("Adder"));
@@ -286,3 +453,357 @@ TEST(Core_RPC, adder)
    testAdmin.Sync("done testing");
    Core::Singleton::Dispose();
 }
+
+TEST(Core_RPC, proxyRegistry)
+{
+   IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator & testAdmin) {
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      AdderAccess communicator(remoteNode);
+
+      testAdmin.Sync("setup server");
+
+      testAdmin.Sync("done testing");
+
+      communicator.Close(Core::infinite);
+   };
+
+   IPTestAdministrator testAdmin(otherSide);
+
+   testAdmin.Sync("setup server");
+
+   {
+      const uint32_t children = 512;
+      const uint32_t rounds = 2;
+
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      Core::ProxyType<RPC::CommunicatorClient> client(Tests::ExternalClient(remoteNode));
+
+      Exchange::IAdder * adder = client->Open<Exchange::IAdder>(_T("Adder"));
+      ASSERT_TRUE(adder != nullptr);
+
+      // Keep a proxy to every child alive, every interface returned later has to be found among them.
+      std::vector<Exchange::IAdder*> proxies;
+      for (uint32_t index = 0; index < children; index++) {
+         proxies.push_back(adder->Child(index));
+         ASSERT_TRUE(proxies.back() != nullptr);
+      }
+
+      proxies[7]->Add(7);
+
+      for (uint32_t round = 0; round < rounds; round++) {
+         for (uint32_t index = 0; index < children; index++) {
+            Exchange::IAdder* child = adder->Child(index);
+            EXPECT_EQ(child, proxies[index]);
+            child->Release();
+         }
+      }
+
+      EXPECT_EQ(proxies[7]->GetValue(), static_cast<uint32_t>(7));
+
+      for (Exchange::IAdder* proxy : proxies) {
+         proxy->Release();
+      }
+
+      adder->Release();
+
+      client->Close(Core::infinite);
+   }
+
+   testAdmin.Sync("done testing");
+   Core::Singleton::Dispose();
+}
+
+TEST(Core_RPC, oneWay)
+{
+   IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator & testAdmin) {
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      // Invokes are handled by a pool of threads, one-way invokes should still be handled in order.
+      Core::ProxyType<RPC::InvokeServerType<64, 4>> engine(Core::ProxyType<RPC::InvokeServerType<64, 4>>::Create(Core::Thread::DefaultStackSize()));
+      AdderAccess communicator(remoteNode, Core::ProxyType<Core::IIPCServer>(engine));
+      engine->Announcements(communicator.Announcement());
+
+      testAdmin.Sync("setup server");
+
+      testAdmin.Sync("done testing");
+
+      communicator.Close(Core::infinite);
+   };
+
+   IPTestAdministrator testAdmin(otherSide);
+
+   testAdmin.Sync("setup server");
+
+   {
+      const uint32_t calls = 10000;
+
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      Core::ProxyType<RPC::CommunicatorClient> client(Tests::ExternalClient(remoteNode));
+
+      Exchange::IAdder * adder = client->Open<Exchange::IAdder>(_T("Adder"));
+      ASSERT_TRUE(adder != nullptr);
+
+      for (uint32_t index = 0; index < calls; index++) {
+         adder->Next(index);
+      }
+
+      // A regular invoke does not wait for the one-way invokes before it, so wait for them to be handled.
+      uint32_t value = adder->GetValue();
+      for (uint32_t retry = 0; (value != calls) && (value != static_cast<uint32_t>(~0)) && (retry < 5000); retry++) {
+         SleepMs(1);
+         value = adder->GetValue();
+      }
+
+      EXPECT_EQ(value, calls);
+
+      // Regular invokes after them still work as before.
+      adder->Add(calls);
+      EXPECT_EQ(adder->GetValue(), 2 * calls);
+
+      adder->Release();
+
+      client->Close(Core::infinite);
+   }
+
+   testAdmin.Sync("done testing");
+   Core::Singleton::Dispose();
+}
+
+TEST(Core_RPC, sharedFrames)
+{
+   const string poolName(g_connectorName + _T(".0.frames"));
+
+   Core::ProxyType<RPC::InvokeMessage> sent(Core::ProxyType<RPC::InvokeMessage>::Create());
+   Core::ProxyType<RPC::InvokeMessage> received(Core::ProxyType<RPC::InvokeMessage>::Create());
+   uint8_t payload[4000];
+   uint8_t wire[8192];
+
+   for (uint16_t index = 0; index < sizeof(payload); index++) {
+      payload[index] = static_cast<uint8_t>(index * 7);
+   }
+
+   {
+      // The server side creates the pool, the client side attaches to it.
+      RPC::Data::FramePool server(poolName, true);
+      RPC::Data::FramePool client(poolName, false);
+
+      ASSERT_TRUE(server.IsValid());
+      ASSERT_TRUE(client.IsValid());
+
+      // Small responses keep on travelling through the socket.
+      sent->Response().Writer().Number<uint32_t>(42);
+      sent->Response().Offload(server);
+      EXPECT_FALSE(sent->Response().IsShared());
+
+      sent->Response().Clear();
+      sent->Response().Writer().Buffer<uint16_t>(sizeof(payload), payload);
+      sent->Response().Offload(server);
+      EXPECT_TRUE(sent->Response().IsShared());
+      EXPECT_LT(sent->Response().Length(), 16u);
+
+      uint16_t length = sent->Response().Serialize(wire, sizeof(wire), 0);
+      EXPECT_EQ(length, sent->Response().Length());
+      EXPECT_EQ(received->Response().Deserialize(wire, length, 0), length);
+
+      EXPECT_TRUE(received->Response().IsShared());
+      EXPECT_TRUE(received->Response().Reload(client));
+      EXPECT_FALSE(received->Response().IsShared());
+
+      uint8_t result[sizeof(payload)];
+      EXPECT_EQ(received->Response().Reader().Buffer<uint16_t>(sizeof(result), result), sizeof(payload));
+      EXPECT_EQ(::memcmp(result, payload, sizeof(payload)), 0);
+
+      // If all slots are taken, frames fall back to the socket.
+      for (uint32_t index = 0; index < RPC::Data::FramePool::Slots; index++) {
+         sent->Response().Clear();
+         sent->Response().Writer().Buffer<uint16_t>(sizeof(payload), payload);
+         sent->Response().Offload(client);
+         EXPECT_TRUE(sent->Response().IsShared());
+      }
+      sent->Response().Clear();
+      sent->Response().Writer().Buffer<uint16_t>(sizeof(payload), payload);
+      sent->Response().Offload(client);
+      EXPECT_FALSE(sent->Response().IsShared());
+
+      // Once the connection is gone, all slots are returned.
+      client.Revoke();
+
+      // A frame the other side will not load (failed send, timeout) returns its slot, it can not be loaded after that.
+      sent->Response().Clear();
+      sent->Response().Writer().Buffer<uint16_t>(sizeof(payload), payload);
+      sent->Response().Offload(client);
+      EXPECT_TRUE(sent->Response().IsShared());
+
+      length = sent->Response().Serialize(wire, sizeof(wire), 0);
+      EXPECT_EQ(received->Response().Deserialize(wire, length, 0), length);
+
+      sent->Response().Revoke(client);
+      EXPECT_FALSE(sent->Response().IsShared());
+      EXPECT_FALSE(received->Response().Reload(server));
+
+      for (uint32_t index = 0; index < RPC::Data::FramePool::Slots; index++) {
+         sent->Response().Clear();
+         sent->Response().Writer().Buffer<uint16_t>(sizeof(payload), payload);
+         sent->Response().Offload(server);
+         EXPECT_TRUE(sent->Response().IsShared());
+      }
+   }
+
+   EXPECT_FALSE(Core::File(poolName).Exists());
+}
+
+TEST(Core_RPC, oneWayRevoke)
+{
+   const string poolName(g_connectorName + _T(".1.frames"));
+
+   Core::ProxyType<RPC::InvokeMessage> posted(Core::ProxyType<RPC::InvokeMessage>::Create());
+   uint8_t payload[4000];
+
+   ::memset(payload, 0x5A, sizeof(payload));
+
+   {
+      RPC::Data::FramePool server(poolName, true);
+      RPC::Data::FramePool client(poolName, false);
+
+      ASSERT_TRUE(client.IsValid());
+
+      // Nobody waits for a one-way invoke, if posting it fails, the poster returns the slot of its
+      // parameters (as UnknownProxy::Post does), otherwise it is held until it expires.
+      for (uint32_t index = 0; index < (2 * RPC::Data::FramePool::Slots); index++) {
+         posted->Parameters().Set(nullptr, Exchange::IAdder::ID, 4 + 3);
+         posted->Parameters().OneWay(true);
+         posted->Parameters().Writer().Buffer<uint16_t>(sizeof(payload), payload);
+         posted->Parameters().Offload(client);
+         EXPECT_TRUE(posted->Parameters().IsShared());
+
+         posted->Parameters().Revoke(client);
+         EXPECT_FALSE(posted->Parameters().IsShared());
+      }
+   }
+
+   EXPECT_FALSE(Core::File(poolName).Exists());
+}
+
+TEST(Core_RPC, largeFrames)
+{
+   const string poolName(g_connectorName + _T(".2.frames"));
+
+   Core::ProxyType<RPC::InvokeMessage> sent(Core::ProxyType<RPC::InvokeMessage>::Create());
+   Core::ProxyType<RPC::InvokeMessage> received(Core::ProxyType<RPC::InvokeMessage>::Create());
+   uint8_t payload[8000];
+   uint8_t wire[16384];
+
+   for (uint16_t index = 0; index < sizeof(payload); index++) {
+      payload[index] = static_cast<uint8_t>(index * 13);
+   }
+
+   {
+      // The owner picks the slot size, the other side takes it over.
+      RPC::Data::FramePool server(poolName, true, 4096);
+      RPC::Data::FramePool client(poolName, false);
+
+      ASSERT_TRUE(server.IsValid());
+      ASSERT_TRUE(client.IsValid());
+
+      // A frame that fits, is shared.
+      sent->Response().Writer().Buffer<uint16_t>(3000, payload);
+      sent->Response().Offload(server);
+      EXPECT_TRUE(sent->Response().IsShared());
+      sent->Response().Revoke(server);
+
+      // A frame that does not fit in a slot, falls back to the socket, content and all.
+      sent->Response().Clear();
+      sent->Response().Writer().Buffer<uint16_t>(sizeof(payload), payload);
+      sent->Response().Offload(server);
+      EXPECT_FALSE(sent->Response().IsShared());
+
+      uint16_t length = sent->Response().Serialize(wire, sizeof(wire), 0);
+      EXPECT_EQ(length, sent->Response().Length());
+      EXPECT_GT(length, sizeof(payload));
+      EXPECT_EQ(received->Response().Deserialize(wire, length, 0), length);
+
+      EXPECT_FALSE(received->Response().IsShared());
+      EXPECT_TRUE(received->Response().Reload(client));
+
+      uint8_t result[sizeof(payload)];
+      EXPECT_EQ(received->Response().Reader().Buffer<uint16_t>(sizeof(result), result), sizeof(payload));
+      EXPECT_EQ(::memcmp(result, payload, sizeof(payload)), 0);
+
+      // None of the slots was held by it.
+      for (uint32_t index = 0; index < RPC::Data::FramePool::Slots; index++) {
+         sent->Response().Clear();
+         sent->Response().Writer().Buffer<uint16_t>(3000, payload);
+         sent->Response().Offload(client);
+         EXPECT_TRUE(sent->Response().IsShared());
+      }
+   }
+
+   EXPECT_FALSE(Core::File(poolName).Exists());
+}
+
+TEST(Core_RPC, outOfBand)
+{
+   IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator & testAdmin) {
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      Core::ProxyType<RPC::InvokeServerType<4, 2>> engine(Core::ProxyType<RPC::InvokeServerType<4, 2>>::Create(Core::Thread::DefaultStackSize()));
+      AdderAccess communicator(remoteNode, Core::ProxyType<Core::IIPCServer>(engine));
+      engine->Announcements(communicator.Announcement());
+
+      testAdmin.Sync("setup server");
+
+      testAdmin.Sync("done testing");
+
+      communicator.Close(Core::infinite);
+   };
+
+   IPTestAdministrator testAdmin(otherSide);
+
+   testAdmin.Sync("setup server");
+
+   {
+      const uint32_t size = 8 * 1024 * 1024;
+      const uint32_t rounds = 2;
+
+      Core::NodeId remoteNode(g_connectorName.c_str());
+
+      Core::ProxyType<RPC::CommunicatorClient> client(Tests::ExternalClient(remoteNode));
+
+      Exchange::IAdder * adder = client->Open<Exchange::IAdder>(_T("Adder"));
+      ASSERT_TRUE(adder != nullptr);
+
+      // Far beyond what fits in a frame.
+      std::vector<uint8_t> data(size);
+      uint32_t expected = 0;
+      for (uint32_t index = 0; index < size; index++) {
+         data[index] = static_cast<uint8_t>(index * 13);
+         expected += data[index];
+      }
+
+      int descriptor = ::memfd_create("peek", MFD_CLOEXEC);
+      ASSERT_NE(descriptor, -1);
+      const uint32_t marker = 0x12345678;
+      ASSERT_EQ(::write(descriptor, &marker, sizeof(marker)), static_cast<ssize_t>(sizeof(marker)));
+
+      for (uint32_t round = 0; round < rounds; round++) {
+         EXPECT_EQ(adder->Sum(size, data.data()), expected);
+         // The other side gets a copy of the descriptor, this side keeps its own.
+         EXPECT_EQ(adder->Peek(descriptor), marker);
+      }
+
+      EXPECT_EQ(adder->Sum(0, nullptr), 0u);
+      EXPECT_EQ(adder->Peek(-1), static_cast<uint32_t>(~0));
+
+      EXPECT_EQ(::close(descriptor), 0);
+
+      adder->Release();
+
+      client->Close(Core::infinite);
+   }
+
+   testAdmin.Sync("done testing");
+   Core::Singleton::Dispose();
+}
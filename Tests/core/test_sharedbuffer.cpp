@@ -3,12 +3,18 @@
 #include <gtest/gtest.h>
 #include <core/core.h>
 
+#include <thread>
+
 namespace WPEFramework {
 namespace Tests {
 
 const uint32_t g_bufferSize = 8 * 1024;
 const uint16_t g_administrationSize = 64;
 const char g_bufferName[] = "testbuffer01";
+const char g_ringName[] = "testring01";
+const uint8_t g_ringSlots = 8;
+const uint32_t g_sampleSize = 4 * 1024;
+const uint32_t g_samples = 2000;
 
 void CleanUpBuffer()
 {
@@ -88,5 +94,184 @@ TEST(Core_SharedBuffer, simpleSet)
 
    Core::Singleton::Dispose();
 }
+
+void CleanUpRing()
+{
+   char systemCmd[1024];
+   sprintf(systemCmd, "rm -f %s", g_ringName);
+   system(systemCmd);
+   sprintf(systemCmd, "rm -f %s.ring", g_ringName);
+   system(systemCmd);
+}
+
+// Stands in for the decryption: every byte of the slot is flipped, the status is the sample number.
+static void ConsumeRing(Core::SharedBufferRing& ring, const uint32_t samples)
+{
+   uint8_t slot;
+
+   for (uint32_t index = 0; index < samples; index++) {
+      if (ring.RequestConsume(Core::infinite, slot) == Core::ERROR_NONE) {
+         uint8_t* buffer = ring.Buffer(slot);
+         const uint32_t length = ring.BytesWritten(slot);
+
+         for (uint32_t position = 0; position < length; position++) {
+            buffer[position] ^= 0xFF;
+         }
+         ::memcpy(ring.AdministrationBuffer(slot), &index, sizeof(index));
+
+         ring.Consumed(slot);
+      }
+   }
+}
+
+TEST(Core_SharedBuffer, ringInOrder)
+{
+   CleanUpRing();
+
+   Core::SharedBufferRing producer(g_ringName,
+      Core::File::USER_READ  |
+      Core::File::USER_WRITE |
+      Core::File::GROUP_READ |
+      Core::File::GROUP_WRITE,
+      g_ringSlots,
+      g_sampleSize,
+      g_administrationSize);
+
+   EXPECT_TRUE(producer.IsValid());
+   EXPECT_TRUE(Core::SharedBufferRing::Exists(g_ringName));
+   EXPECT_FALSE(Core::SharedBufferRing::Exists(g_bufferName));
+
+   {
+      Core::SharedBufferRing consumer(g_ringName);
+
+      EXPECT_TRUE(consumer.IsValid());
+      EXPECT_EQ(consumer.Slots(), g_ringSlots);
+      EXPECT_EQ(consumer.SlotSize(), g_sampleSize);
+
+      uint8_t slots[g_ringSlots];
+
+      // All slots can be produced before the first one is consumed.
+      for (uint8_t index = 0; index < g_ringSlots; index++) {
+         EXPECT_EQ(producer.RequestProduce(Core::infinite, slots[index]), Core::ERROR_NONE);
+         EXPECT_EQ(slots[index], index);
+
+         ::memset(producer.Buffer(slots[index]), index, index + 1);
+         producer.BytesWritten(slots[index], index + 1);
+         producer.Produced(slots[index]);
+      }
+
+      // No slot is released yet, so there is no room for more.
+      uint8_t slot = 0xFF;
+      EXPECT_EQ(producer.RequestProduce(0, slot), Core::ERROR_TIMEDOUT);
+      EXPECT_EQ(slot, 0xFF);
+
+      ConsumeRing(consumer, g_ringSlots);
+      EXPECT_EQ(consumer.RequestConsume(0, slot), Core::ERROR_TIMEDOUT);
+
+      for (uint8_t index = 0; index < g_ringSlots; index++) {
+         uint32_t sample;
+
+         EXPECT_EQ(producer.RequestResult(slots[index], Core::infinite), Core::ERROR_NONE);
+         EXPECT_EQ(producer.BytesWritten(slots[index]), static_cast<uint32_t>(index + 1));
+         EXPECT_EQ(producer.Buffer(slots[index])[index], static_cast<uint8_t>(index ^ 0xFF));
+         ::memcpy(&sample, producer.AdministrationBuffer(slots[index]), sizeof(sample));
+         EXPECT_EQ(sample, index);
+
+         producer.Release(slots[index]);
+      }
+
+      // And around again, from the first slot.
+      EXPECT_EQ(producer.RequestProduce(0, slot), Core::ERROR_NONE);
+      EXPECT_EQ(slot, 0);
+      producer.Release(slot);
+   }
+
+   CleanUpRing();
+}
+
+TEST(Core_SharedBuffer, ringConcurrent)
+{
+   uint8_t sample[g_sampleSize];
+   uint8_t result[g_sampleSize];
+
+   ::memset(sample, 0x5A, sizeof(sample));
+
+   // All slots in flight, a sample is produced before the result of an earlier one is read.
+   CleanUpRing();
+   {
+      Core::SharedBufferRing producer(g_ringName,
+         Core::File::USER_READ  |
+         Core::File::USER_WRITE |
+         Core::File::GROUP_READ |
+         Core::File::GROUP_WRITE,
+         g_ringSlots,
+         g_sampleSize,
+         g_administrationSize);
+      Core::SharedBufferRing consumer(g_ringName);
+
+      std::thread worker(ConsumeRing, std::ref(consumer), g_samples);
+
+      uint8_t slots[g_ringSlots];
+      uint32_t checked = 0;
+
+      for (uint32_t index = 0; index < (g_samples + g_ringSlots); index++) {
+         if (index >= g_ringSlots) {
+            const uint8_t slot = slots[index % g_ringSlots];
+            uint32_t sample;
+
+            if (producer.RequestResult(slot, Core::infinite) == Core::ERROR_NONE) {
+               ::memcpy(result, producer.Buffer(slot), producer.BytesWritten(slot));
+               ::memcpy(&sample, producer.AdministrationBuffer(slot), sizeof(sample));
+               checked += (sample == (index - g_ringSlots) ? 1 : 0);
+            }
+            producer.Release(slot);
+         }
+         if ((index < g_samples) && (producer.RequestProduce(Core::infinite, slots[index % g_ringSlots]) == Core::ERROR_NONE)) {
+            const uint8_t slot = slots[index % g_ringSlots];
+
+            ::memcpy(producer.Buffer(slot), sample, sizeof(sample));
+            producer.BytesWritten(slot, sizeof(sample));
+            producer.Produced(slot);
+         }
+      }
+
+      worker.join();
+
+      // Every result came back from the slot it was produced in, in order.
+      EXPECT_EQ(checked, g_samples);
+      EXPECT_EQ(result[0], 0xA5);
+      EXPECT_EQ(result[g_sampleSize - 1], 0xA5);
+   }
+   CleanUpRing();
+}
+
+TEST(Core_SharedBuffer, ringLayout)
+{
+   CleanUpRing();
+   {
+      Core::SharedBufferRing producer(g_ringName,
+         Core::File::USER_READ  |
+         Core::File::USER_WRITE |
+         Core::File::GROUP_READ |
+         Core::File::GROUP_WRITE,
+         g_ringSlots,
+         g_sampleSize,
+         g_administrationSize);
+
+      // The number of slots comes first in the administration, claim more than were mapped.
+      FILE* file = fopen((string(g_ringName) + _T(".ring")).c_str(), "r+b");
+      ASSERT_TRUE(file != nullptr);
+
+      const uint32_t slots = 200;
+      EXPECT_EQ(fwrite(&slots, sizeof(slots), 1, file), 1u);
+      fclose(file);
+
+      Core::SharedBufferRing consumer(g_ringName);
+
+      EXPECT_FALSE(consumer.IsValid());
+      EXPECT_EQ(consumer.Slots(), 0);
+   }
+   CleanUpRing();
+}
 }
 }
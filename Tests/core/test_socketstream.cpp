@@ -0,0 +1,189 @@
+#include "../StreamEnd.h"
+
+#include <gtest/gtest.h>
+
+#include <dirent.h>
+#include <fcntl.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    static uint32_t OpenDescriptors()
+    {
+        uint32_t count = 0;
+        DIR* directory = ::opendir("/proc/self/fd");
+
+        if (directory != nullptr) {
+            while (::readdir(directory) != nullptr) {
+                count++;
+            }
+            ::closedir(directory);
+        }
+
+        return (count);
+    }
+
+    TEST(Core_SocketStream, GatherAndSlidingReceive)
+    {
+        int pair[2];
+
+        ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+
+        {
+            // The receive buffer is no multiple of the message size, so messages straddle its end.
+            StreamEnd sender(pair[0], 4096, 512);
+            StreamEnd receiver(pair[1], 512, 1000);
+
+            EXPECT_EQ(sender.Open(0), Core::ERROR_NONE);
+            EXPECT_EQ(receiver.Open(0), Core::ERROR_NONE);
+
+            for (uint32_t batch = 0; batch < (g_streamMessages / 100); batch++) {
+                sender.Queue(100);
+            }
+
+            uint32_t timeout = 10000;
+            while ((receiver.Received() < g_streamMessages) && (--timeout != 0)) {
+                SleepMs(1);
+            }
+
+            EXPECT_EQ(receiver.Received(), g_streamMessages);
+            EXPECT_EQ(sender.SendCalls(), g_streamMessages);
+            EXPECT_FALSE(receiver.OutOfOrder());
+        }
+    }
+
+    TEST(Core_SocketStream, CloseAfterGather)
+    {
+        int pair[2];
+
+        ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+
+        {
+            StreamEnd sender(pair[0], 4096, 512);
+            StreamEnd receiver(pair[1], 512, 1000);
+
+            sender.CloseWhenIdle();
+
+            EXPECT_EQ(sender.Open(0), Core::ERROR_NONE);
+            EXPECT_EQ(receiver.Open(0), Core::ERROR_NONE);
+
+            // The close comes while the messages are still gathered in the send buffer, they go out first.
+            sender.Queue(50);
+
+            uint32_t timeout = 10000;
+            while ((receiver.Received() < 50) && (--timeout != 0)) {
+                SleepMs(1);
+            }
+
+            EXPECT_EQ(receiver.Received(), 50u);
+            EXPECT_FALSE(receiver.OutOfOrder());
+        }
+    }
+
+    TEST(Core_SocketStream, CloseLingers)
+    {
+        const int room = 4096;
+        int pair[2];
+
+        ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+        ASSERT_EQ(::setsockopt(pair[0], SOL_SOCKET, SO_SNDBUF, &room, sizeof(room)), 0);
+
+        {
+            StreamEnd sender(pair[0], 4096, 512);
+            StreamEnd receiver(pair[1], 512, 1000);
+
+            EXPECT_EQ(sender.Open(0), Core::ERROR_NONE);
+
+            // Nobody reads yet, so the socket fills up and stops the sender with messages in its send buffer.
+            sender.Queue(1000);
+
+            uint32_t handedOut;
+            do {
+                handedOut = sender.SendCalls();
+                SleepMs(50);
+            } while (handedOut != sender.SendCalls());
+
+            EXPECT_LT(handedOut, 1000u);
+
+            // The close does not wait for room, the reactor sends what is left once the other side reads.
+            const uint64_t start = Core::Time::Now().Ticks();
+            sender.Close(0);
+            EXPECT_LT(Core::Time::Now().Ticks() - start, 50u * Core::Time::TicksPerMillisecond);
+
+            SleepMs(200);
+
+            EXPECT_EQ(receiver.Open(0), Core::ERROR_NONE);
+
+            uint32_t timeout = 10000;
+            while ((receiver.Received() < handedOut) && (--timeout != 0)) {
+                SleepMs(1);
+            }
+
+            EXPECT_EQ(receiver.Received(), handedOut);
+            EXPECT_FALSE(receiver.OutOfOrder());
+        }
+    }
+
+    TEST(Core_SocketStream, TruncatedDescriptors)
+    {
+        const uint8_t passed = 20;
+        int pair[2];
+
+        ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+
+        {
+            StreamEnd receiver(pair[1], 512, 1000);
+
+            EXPECT_EQ(receiver.Open(0), Core::ERROR_NONE);
+
+            const uint32_t before = OpenDescriptors();
+
+            // More descriptors in one message than the link takes, the kernel drops the ones that do not fit.
+            int file = ::open("/dev/null", O_RDONLY);
+            ASSERT_NE(file, -1);
+
+            uint8_t control[CMSG_SPACE(sizeof(int) * passed)];
+            uint8_t data[g_streamMessageSize];
+            struct iovec vector;
+            struct msghdr message;
+
+            ::memset(data, ' ', sizeof(data));
+            data[0] = '0';
+            vector.iov_base = data;
+            vector.iov_len = sizeof(data);
+
+            ::memset(&message, 0, sizeof(message));
+            message.msg_iov = &vector;
+            message.msg_iovlen = 1;
+            message.msg_control = control;
+            message.msg_controllen = sizeof(control);
+
+            struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+            header->cmsg_level = SOL_SOCKET;
+            header->cmsg_type = SCM_RIGHTS;
+            header->cmsg_len = CMSG_LEN(sizeof(int) * passed);
+
+            int* descriptors = reinterpret_cast<int*>(CMSG_DATA(header));
+            for (uint8_t index = 0; index < passed; index++) {
+                descriptors[index] = file;
+            }
+
+            EXPECT_EQ(::sendmsg(pair[0], &message, 0), static_cast<ssize_t>(sizeof(data)));
+            ::close(file);
+
+            uint32_t timeout = 1000;
+            while ((receiver.IsOpen() == true) && (--timeout != 0)) {
+                SleepMs(1);
+            }
+
+            // The link failed, the message is not handed out and the descriptors that did arrive are closed.
+            EXPECT_FALSE(receiver.IsOpen());
+            EXPECT_EQ(receiver.Received(), 0u);
+            EXPECT_LE(OpenDescriptors(), before);
+        }
+
+        ::close(pair[0]);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,134 @@
+#include "../TimerContent.h"
+
+#include <gtest/gtest.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    static bool WaitForTimers(TimerRecord records[], const uint32_t count, const uint32_t expected)
+    {
+        uint32_t timeout = 10000;
+        uint32_t total = 0;
+
+        do {
+            SleepMs(1);
+            total = 0;
+            for (uint32_t index = 0; index < count; index++) {
+                total += records[index].fired.load();
+            }
+        } while ((total < expected) && (--timeout != 0));
+
+        return (total == expected);
+    }
+
+    TEST(Core_TimerWheel, Fire)
+    {
+        TimerRecord records[256];
+        Core::TimerWheelType<TimerContent> timer(Core::Thread::DefaultStackSize(), _T("TestTimerWheel"));
+        uint64_t now = Core::Time::Now().Ticks();
+
+        // Spread over the first two levels of the wheel and include some overdue ones. The others are
+        // far enough ahead to still be pending when they are counted.
+        for (uint32_t index = 0; index < 256; index++) {
+            uint64_t offset = (index * 997) % 300;
+            timer.Schedule(index < 8 ? now - offset : now + ((offset + 100) * Core::Time::TicksPerMillisecond), TimerContent(&records[index]));
+        }
+        // The overdue ones might already have fired.
+        EXPECT_GE(timer.Pending(), 248u);
+        EXPECT_LE(timer.Pending(), 256u);
+
+        EXPECT_TRUE(WaitForTimers(records, 256, 256));
+        EXPECT_EQ(timer.Pending(), 0u);
+
+        for (uint32_t index = 0; index < 256; index++) {
+            EXPECT_EQ(records[index].fired.load(), 1u);
+            EXPECT_FALSE(records[index].early.load());
+        }
+    }
+
+    TEST(Core_TimerWheel, Reschedule)
+    {
+        TimerRecord records[4];
+        Core::TimerWheelType<TimerContent> timer(Core::Thread::DefaultStackSize(), _T("TestTimerWheel"));
+        uint64_t now = Core::Time::Now().Ticks();
+
+        for (uint32_t index = 0; index < 4; index++) {
+            records[index].repeat = static_cast<uint8_t>(index);
+            timer.Schedule(now + (70 * index * Core::Time::TicksPerMillisecond), TimerContent(&records[index]));
+        }
+
+        EXPECT_TRUE(WaitForTimers(records, 4, 1 + 2 + 3 + 4));
+        EXPECT_EQ(timer.Pending(), 0u);
+
+        for (uint32_t index = 0; index < 4; index++) {
+            EXPECT_EQ(records[index].fired.load(), index + 1);
+            EXPECT_FALSE(records[index].early.load());
+        }
+    }
+
+    TEST(Core_TimerWheel, Revoke)
+    {
+        TimerRecord records[64];
+        Core::TimerWheelType<TimerContent> timer(Core::Thread::DefaultStackSize(), _T("TestTimerWheel"));
+        uint64_t now = Core::Time::Now().Ticks();
+
+        for (uint32_t index = 0; index < 64; index++) {
+            // Even ones soon, odd ones in the upper levels and beyond the wheel (more than 4.6 hours).
+            uint64_t delay = ((index & 1) == 0 ? 50 : (static_cast<uint64_t>(index) << 20));
+            timer.Schedule(now + (delay * Core::Time::TicksPerMillisecond), TimerContent(&records[index]));
+        }
+        EXPECT_EQ(timer.Pending(), 64u);
+
+        for (uint32_t index = 0; index < 64; index += 4) {
+            EXPECT_TRUE(timer.Revoke(TimerContent(&records[index])));
+            EXPECT_FALSE(timer.Revoke(TimerContent(&records[index])));
+        }
+        EXPECT_EQ(timer.Pending(), 48u);
+
+        // Trigger replaces the pending entry.
+        timer.Trigger(now + (10 * Core::Time::TicksPerMillisecond), TimerContent(&records[1]));
+        EXPECT_EQ(timer.Pending(), 48u);
+
+        EXPECT_TRUE(WaitForTimers(records, 64, 17));
+        SleepMs(100);
+        EXPECT_EQ(timer.Pending(), 31u);
+
+        for (uint32_t index = 1; index < 64; index += 2) {
+            EXPECT_EQ(records[index].fired.load(), (index == 1 ? 1u : 0u));
+            EXPECT_EQ(timer.Revoke(TimerContent(&records[index])), (index != 1));
+        }
+        EXPECT_EQ(timer.Pending(), 0u);
+    }
+
+    TEST(Core_TimerWheel, Load)
+    {
+        TimerRecord* records = new TimerRecord[g_timerEntries];
+
+        {
+            Core::TimerWheelType<TimerContent> timer(Core::Thread::DefaultStackSize(), _T("TestTimerLoad"));
+            uint64_t now = Core::Time::Now().Ticks();
+
+            // Request deadlines spread over a minute, on all levels of the wheel, revoked before they expire.
+            for (uint32_t index = 0; index < g_timerEntries; index++) {
+                uint64_t delay = 10000 + ((index * 7919) % 60000);
+                timer.Schedule(now + (delay * Core::Time::TicksPerMillisecond), TimerContent(&records[index]));
+            }
+            EXPECT_EQ(timer.Pending(), g_timerEntries);
+
+            uint32_t revoked = 0;
+            for (uint32_t index = 0; index < g_timerEntries; index++) {
+                revoked += (timer.Revoke(TimerContent(&records[index])) == true ? 1 : 0);
+            }
+            EXPECT_EQ(revoked, g_timerEntries);
+            EXPECT_EQ(timer.Pending(), 0u);
+        }
+
+        for (uint32_t index = 0; index < g_timerEntries; index++) {
+            EXPECT_EQ(records[index].fired.load(), 0u);
+        }
+
+        delete[] records;
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <tracing/tracing.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    const uint32_t g_traceRecords = 5000;
+    const uint8_t g_traceThreads = 4;
+
+    static const char* g_traceModule = _T("TestTracing");
+
+    class TraceCollector : public Trace::TraceRecorder::IConsumer {
+    public:
+        TraceCollector(const TraceCollector&) = delete;
+        TraceCollector& operator=(const TraceCollector&) = delete;
+
+        TraceCollector()
+            : Messages()
+            , Sequences()
+            , OutOfOrder(false)
+        {
+        }
+        ~TraceCollector() override
+        {
+        }
+
+    public:
+        void Trace(const uint64_t, const uint32_t thread, const char[], const uint32_t, const char[], const char module[], const char category[], const string& message) override
+        {
+            EXPECT_STREQ(module, g_traceModule);
+            EXPECT_STREQ(category, _T("Information"));
+
+            if (Messages.size() < 16) {
+                Messages.push_back(message);
+            }
+
+            // Concurrent records are a plain sequence number per thread.
+            uint32_t& expected(Sequences[thread]);
+            if (Core::NumberType<uint32_t>(Core::TextFragment(message)).Value() != expected) {
+                OutOfOrder = true;
+            }
+            expected++;
+        }
+
+    public:
+        std::vector<string> Messages;
+        std::map<uint32_t, uint32_t> Sequences;
+        bool OutOfOrder;
+    };
+
+    typedef Trace::TraceType<Trace::Information, &g_traceModule> TestTraceType;
+
+    static void RecordDeferred(const uint32_t count)
+    {
+        for (uint32_t index = 0; index < count; index++) {
+            Trace::TraceRecorder::Entry(__FILE__, __LINE__, _T("TestClass"), TestTraceType::ModuleName(), TestTraceType::CategoryName()).Record(_T("%u"), index);
+        }
+    }
+
+    static void RecordConcurrently(const uint8_t threads, const uint32_t count)
+    {
+        std::vector<std::thread> workers;
+
+        for (uint8_t index = 0; index < threads; index++) {
+            workers.emplace_back(RecordDeferred, count);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    TEST(Core_TraceRecorder, DeferredFormat)
+    {
+        Trace::TraceRecorder& recorder(Trace::TraceRecorder::Instance());
+        TraceCollector collector;
+
+        EXPECT_EQ(recorder.Open(4096), Core::ERROR_NONE);
+        EXPECT_TRUE(recorder.IsOpen());
+
+        Trace::TraceRecorder::Entry(__FILE__, __LINE__, _T("TestClass"), TestTraceType::ModuleName(), TestTraceType::CategoryName())
+            .Record(_T("0 int %d unsigned %lu hex %08x real %.2f text %s char %c %%"), -42, 42ul, 0xBEEFu, 3.14159, string(_T("thunder")), 'A');
+        Trace::TraceRecorder::Entry(__FILE__, __LINE__, _T("TestClass"), TestTraceType::ModuleName(), TestTraceType::CategoryName())
+            .Record(_T("1 %s and %d"), _T("literal"));
+
+        EXPECT_EQ(recorder.Flush(collector), 2u);
+        ASSERT_EQ(collector.Messages.size(), 2u);
+        EXPECT_EQ(collector.Messages[0], string(_T("0 int -42 unsigned 42 hex 0000beef real 3.14 text thunder char A %")));
+        EXPECT_EQ(collector.Messages[1], string(_T("1 literal and (missing)")));
+
+        // Nothing left to flush.
+        EXPECT_EQ(recorder.Flush(collector), 0u);
+
+        EXPECT_EQ(recorder.Close(), Core::ERROR_NONE);
+        EXPECT_FALSE(recorder.IsOpen());
+    }
+
+    TEST(Core_TraceRecorder, Truncated)
+    {
+        Trace::TraceRecorder& recorder(Trace::TraceRecorder::Instance());
+        TraceCollector collector;
+        const string text(2 * Trace::TRACINGBUFFERSIZE, 'x');
+
+        EXPECT_EQ(recorder.Open(4096), Core::ERROR_NONE);
+
+        // What does not fit in a frame is not silently lost: the text is cut and marked, the arguments
+        // that follow it show up as truncated.
+        Trace::TraceRecorder::Entry(__FILE__, __LINE__, _T("TestClass"), TestTraceType::ModuleName(), TestTraceType::CategoryName())
+            .Record(_T("2 %s"), text);
+        Trace::TraceRecorder::Entry(__FILE__, __LINE__, _T("TestClass"), TestTraceType::ModuleName(), TestTraceType::CategoryName())
+            .Record(_T("3 %s and %d"), text, 42);
+
+        EXPECT_EQ(recorder.Flush(collector), 2u);
+        ASSERT_EQ(collector.Messages.size(), 2u);
+
+        const string suffix(_T(" (truncated)"));
+        const string& cut(collector.Messages[0]);
+        ASSERT_GT(cut.length(), suffix.length());
+        EXPECT_EQ(cut.substr(cut.length() - suffix.length()), suffix);
+        EXPECT_LT(cut.length(), text.length());
+        EXPECT_EQ(cut.substr(0, 4), string(_T("2 xx")));
+
+        const string& following(collector.Messages[1]);
+        const string tail(_T("x and (truncated)"));
+        ASSERT_GT(following.length(), tail.length());
+        EXPECT_EQ(following.substr(following.length() - tail.length()), tail);
+
+        EXPECT_EQ(recorder.Close(), Core::ERROR_NONE);
+    }
+
+    TEST(Core_TraceRecorder, ConcurrentThreads)
+    {
+        Trace::TraceRecorder& recorder(Trace::TraceRecorder::Instance());
+        TraceCollector collector;
+
+        // Large enough to keep all records of a thread, nothing is flushed while recording.
+        EXPECT_EQ(recorder.Open(g_traceRecords * 64), Core::ERROR_NONE);
+
+        TestTraceType::Enable(true);
+
+        RecordConcurrently(g_traceThreads, g_traceRecords);
+
+        TestTraceType::Enable(false);
+
+        // The threads are gone, their rings are handed out in full and released.
+        EXPECT_EQ(recorder.Flush(collector), (g_traceRecords * g_traceThreads) - recorder.Dropped());
+        EXPECT_EQ(recorder.Dropped(), 0u);
+        EXPECT_EQ(collector.Sequences.size(), static_cast<size_t>(g_traceThreads));
+        EXPECT_FALSE(collector.OutOfOrder);
+        EXPECT_EQ(recorder.Flush(collector), 0u);
+
+        recorder.Close();
+    }
+
+} // Tests
+} // WPEFramework
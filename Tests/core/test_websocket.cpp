@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // What the encoder and decoder did before, one byte at a time, back to front.
+    static void MaskBytes(uint8_t destination[], const uint8_t source[], uint32_t length, const uint8_t key[4], const uint8_t offset)
+    {
+        while (length != 0) {
+            length--;
+            destination[length] = (source[length] ^ key[(offset + length) & 0x3]);
+        }
+    }
+
+    TEST(Web_WebSocket, Mask)
+    {
+        const uint8_t key[4] = { 0x12, 0x34, 0x56, 0x78 };
+        uint8_t data[256 + 8];
+        uint8_t result[256 + 8];
+        uint8_t expected[256];
+
+        for (uint16_t index = 0; index < sizeof(data); index++) {
+            data[index] = static_cast<uint8_t>(index * 7);
+        }
+
+        for (uint16_t length = 0; length <= 256; length++) {
+            for (uint8_t offset = 0; offset < 4; offset++) {
+                MaskBytes(expected, data, length, key, offset);
+
+                // In place.
+                ::memcpy(result, data, length);
+                Web::WebSocket::Protocol::Mask(result, result, length, key, offset);
+                EXPECT_EQ(::memcmp(result, expected, length), 0);
+
+                // Moved up, as the encoder does to make room for the header and the key.
+                for (uint8_t shift = 2; shift <= 8; shift += 2) {
+                    ::memcpy(result, data, length);
+                    Web::WebSocket::Protocol::Mask(&result[shift], result, length, key, offset);
+                    EXPECT_EQ(::memcmp(&result[shift], expected, length), 0);
+                }
+            }
+        }
+    }
+
+    TEST(Web_WebSocket, EncodeDecode)
+    {
+        Web::WebSocket::Protocol client(true, true);
+        Web::WebSocket::Protocol server(true, false);
+
+        for (uint16_t length : { 2, 125, 126, 1000, 4097 }) {
+            std::vector<uint8_t> frame(length + 8);
+
+            for (uint16_t index = 0; index < length; index++) {
+                frame[4 + index] = static_cast<uint8_t>(index);
+            }
+
+            uint16_t size = client.Encoder(frame.data(), length + 1, length);
+            EXPECT_EQ(size, length + (length <= 125 ? 6 : 8));
+
+            // Offer it in two parts, the second part continues the mask where the first one stopped.
+            uint16_t received = (size - length) + (length / 2);
+            uint16_t header = server.Decoder(frame.data(), received);
+            uint16_t first = received;
+
+            EXPECT_EQ(header, size - length);
+            EXPECT_EQ(first, length / 2);
+            EXPECT_FALSE(server.IsCompleteMessage());
+
+            received = size - header - first;
+            EXPECT_EQ(server.Decoder(&frame[header + first], received), 0);
+            EXPECT_EQ(received, size - header - first);
+            EXPECT_TRUE(server.IsCompleteMessage());
+
+            for (uint16_t index = 0; index < length; index++) {
+                EXPECT_EQ(frame[header + index], static_cast<uint8_t>(index));
+            }
+        }
+    }
+
+} // Tests
+} // WPEFramework
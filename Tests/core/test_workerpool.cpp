@@ -0,0 +1,69 @@
+#include "../StormJob.h"
+
+namespace WPEFramework {
+namespace Tests {
+
+    static void Storm(const uint8_t depth)
+    {
+        std::atomic<uint32_t> counter(0);
+        Core::WorkerPoolType<g_poolThreads + 1> pool(0);
+        StormJob::Submitter submitter([&pool](const Core::ProxyType<Core::IDispatch>& job) { pool.Submit(job); });
+
+        pool.Run();
+
+        for (uint32_t index = 0; index < g_stormJobs; index++) {
+            submitter(Core::ProxyType<Core::IDispatch>(Core::ProxyType<StormJob>::Create(&counter, submitter, depth)));
+        }
+
+        // Taken while the pool is busy, the pending count never exceeds what was submitted.
+        for (uint32_t sample = 0; (sample < 1000) && (counter.load() < (g_stormJobs * (depth + 1))); sample++) {
+            EXPECT_LE(pool.Snapshot().Pending, g_stormJobs * (depth + 1));
+        }
+
+        // Every job, and every job submitted from within the pool, ran exactly once.
+        EXPECT_TRUE(WaitFor(counter, g_stormJobs * (depth + 1)));
+
+        pool.Stop();
+
+        EXPECT_EQ(counter.load(), g_stormJobs * (depth + 1));
+        EXPECT_EQ(pool.Snapshot().Pending, 0u);
+    }
+
+    TEST(Core_WorkerPool, Revoke)
+    {
+        std::atomic<uint32_t> counter(0);
+        Core::WorkerPoolType<g_poolThreads + 1> pool(0);
+        StormJob::Submitter submitter([&pool](const Core::ProxyType<Core::IDispatch>& job) { pool.Submit(job); });
+
+        Core::ProxyType<Core::IDispatch> job(Core::ProxyType<StormJob>::Create(&counter, submitter, 0));
+        Core::ProxyType<Core::IDispatch> other(Core::ProxyType<StormJob>::Create(&counter, submitter, 0));
+
+        // Not running yet, so both stay queued.
+        pool.Submit(job);
+        pool.Submit(other);
+        EXPECT_EQ(pool.Snapshot().Pending, 2u);
+
+        EXPECT_EQ(pool.Revoke(job), Core::ERROR_NONE);
+        EXPECT_EQ(pool.Revoke(job), Core::ERROR_UNAVAILABLE);
+        EXPECT_EQ(pool.Snapshot().Pending, 1u);
+
+        pool.Run();
+        EXPECT_TRUE(WaitFor(counter, 1));
+        EXPECT_EQ(pool.Revoke(other), Core::ERROR_UNAVAILABLE);
+        pool.Stop();
+
+        EXPECT_EQ(counter.load(), 1u);
+    }
+
+    TEST(Core_WorkerPool, JSONRPCStorm)
+    {
+        Storm(0);
+    }
+
+    TEST(Core_WorkerPool, COMRPCStorm)
+    {
+        Storm(3);
+    }
+
+} // Tests
+} // WPEFramework
@@ -47,6 +47,8 @@ class Type:
         self.length = None
         self.maxlength = None
         self.interface = None
+        self.descriptor = False
+        self.blob = False
         self.param = OrderedDict()
         self.retval = OrderedDict()
         type = ["?"] # indexing safety
@@ -118,6 +120,16 @@ class Type:
                 elif token[1:] == "INTERFACE":
                     self.interface = string[i + 1]
                     skip = 1
+                elif token[1:] == "DESCRIPTOR":
+                    if tags_allowed:
+                        self.descriptor = True
+                    else:
+                        raise ParserError("descriptor tag not allowed on return value")
+                elif token[1:] == "BLOB":
+                    if tags_allowed:
+                        self.blob = True
+                    else:
+                        raise ParserError("blob tag not allowed on return value")
                 elif token[1:] == "PROPERTY":
                     self.is_property = True
                 elif token[1:] == "BRIEF":
@@ -420,6 +432,7 @@ class Function(Type, Block, Identifier):
         Identifier.__init__(self, parent_block, self.name)
         self.omit = False
         self.stub = False
+        self.oneway = False
         self.parent.methods.append(self)
     def __str__(self):
         return "function " + str(self.specifiers) + " " + str(self.type) + " '" + self.name + "' (" + str(self.vars) + ")"
@@ -603,6 +616,12 @@ def __Tokenize(contents):
                     tagtokens.append("@JSON")
                 if _find("@event", token):
                     tagtokens.append("@EVENT")
+                if _find("@oneway", token):
+                    tagtokens.append("@ONEWAY")
+                if _find("@descriptor", token):
+                    tagtokens.append("@DESCRIPTOR")
+                if _find("@blob", token):
+                    tagtokens.append("@BLOB")
                 if _find("@brief", token):
                     tagtokens.append("@BRIEF")
                     desc = token[token.index("@brief") + 7:token.index("*/") if "*/" in token else None].strip()
@@ -708,6 +727,7 @@ def Parse(contents):
     stub_next = False
     json_next = False
     event_next = False
+    oneway_next = False
     in_typedef = False
 
     # Main loop.
@@ -733,6 +753,10 @@ def Parse(contents):
             event_next = True
             tokens[i] = ";"
             i += 1
+        elif tokens[i] == "@ONEWAY":
+            oneway_next = True
+            tokens[i] = ";"
+            i += 1
         elif tokens[i].startswith("@FILE:"):
             current_file = tokens[i][6:]
             i += 1
@@ -915,6 +939,9 @@ def Parse(contents):
                 stub_next = False
             elif method.parent.stub:
                 method.stub = True
+            if oneway_next:
+                method.oneway = True
+                oneway_next = False
 
             if last_template_def:
                 method.specifiers.append(" ".join(last_template_def))
@@ -7,7 +7,7 @@
 import re, uuid, sys, os, argparse
 import CppParser
 
-VERSION = "1.5.4"
+VERSION = "1.5.6"
 NAME = "ProxyStubGenerator"
 
 # runtime changeable configuration
@@ -598,13 +598,26 @@ def GenerateStubs(output_file, source_file, defaults = "", scan_only = False):
                     p.name += str(c)
 
                 LinkPointers(retval, params)
+
+                # a one-way call gets no response, so nothing can come back, not even the reference counts of interfaces passed
+                if m.oneway and (retval.has_output or output_params or any(p.proxy for p in params)):
+                    raise TypenameError(m, "method '%s': a @oneway method can not return a value, have output parameters or pass interfaces" % m.name)
+
+                # descriptors and blobs travel next to the message, the message only carries their index
+                for p in params:
+                    if p.oclass.descriptor and (p.is_ptr or p.is_ref or p.str_typename != "int"):
+                        raise TypenameError(p.oclass, "unable to serialise '%s': a @descriptor must be an int passed by value" % p.origname)
+                    if p.oclass.blob and (not p.is_ptr or p.obj or p.is_output or not p.length_expr or p.str_typename != "uint8_t"):
+                        raise TypenameError(p.oclass, "unable to serialise '%s': a @blob must be an input uint8_t buffer with a @length" % p.origname)
+                out_of_band = any((p.oclass.descriptor or p.oclass.blob) for p in params)
+
                 # emit a comment with function signature (optional)
                 if EMIT_COMMENT_WITH_PROTOTYPE:
                     emit.Line("// " + SignatureStr(m, orig_params))
                     emit.Line("//")
 
                 # emit the lambda prototype
-                emit.Line("[](Core::ProxyType<Core::IPCChannel>& channel%s, Core::ProxyType<RPC::InvokeMessage>& message) {" % (" VARIABLE_IS_NOT_USED" if not proxy_count else ""))
+                emit.Line("[](Core::ProxyType<Core::IPCChannel>& channel%s, Core::ProxyType<RPC::InvokeMessage>& message) {" % (" VARIABLE_IS_NOT_USED" if not proxy_count and not out_of_band else ""))
                 emit.IndentInc()
 
                 if EMIT_TRACES:
@@ -643,6 +656,13 @@ def GenerateStubs(output_file, source_file, defaults = "", scan_only = False):
                             else:
                                 if p.is_ptr and not p.obj and not p.is_ref and p.length_type == "void":
                                     emit.Line("%s %s = %s; // storage" % (p.str_typename, p.name, NULLPTR))
+                                elif p.oclass.blob:
+                                    emit.Line("RPC::Data::Blob %s_blob(*channel, reader.Number<uint32_t>());" % p.name)
+                                    emit.Line("const %s %s = %s_blob.Buffer();" % (p.str_nocvref, p.name, p.name))
+                                    emit.Line("%s %s_length = static_cast<%s>(%s_blob.Length());" % (p.length_type, p.name, p.length_type, p.name))
+                                elif p.oclass.descriptor:
+                                    emit.Line("RPC::Data::Descriptor %s_descriptor(*channel, reader.Number<uint32_t>());" % p.name)
+                                    emit.Line("const int %s = %s_descriptor.Handle();" % (p.name, p.name))
                                 elif p.is_ptr and not p.obj and not p.is_ref:
                                     if p.is_input:
                                         emit.Line("const %s %s = %s;" % (p.str_nocvref, p.name, NULLPTR))
@@ -964,7 +984,11 @@ def GenerateStubs(output_file, source_file, defaults = "", scan_only = False):
                             else:
                                 if p.is_ptr and p.obj:
                                     proxy_params += 1
-                                if not p.obj and p.is_ptr:
+                                if p.oclass.blob:
+                                    emit.Line("writer.Number<uint32_t>(BaseClass::Blob(%s, param%i));" % (p.length_expr, c))
+                                elif p.oclass.descriptor:
+                                    emit.Line("writer.Number<uint32_t>(BaseClass::Descriptor(param%i));" % c)
+                                elif not p.obj and p.is_ptr:
                                     if p.is_input:
                                         emit.Line("writer.%s(%s, param%i);" % (p.RpcType(), p.length_expr, c))
                                 elif not p.is_input and p.is_nonconstref and p.is_nonconstptr:
@@ -996,6 +1020,8 @@ def GenerateStubs(output_file, source_file, defaults = "", scan_only = False):
                     elif proxy_params + output_params > 0:
                         emit.Line("if (Invoke(newMessage) == Core::ERROR_NONE) {")
                         emit.IndentInc()
+                    elif m.oneway:
+                        emit.Line("Post(newMessage);")
                     else:
                         emit.Line("Invoke(newMessage);")
 
@@ -1165,6 +1191,8 @@ if __name__ == "__main__":
         print "   @stubgen:skip     - skip parsing of the rest of the file"
         print "   @stubgen:omit     - omit generating code for the next item (class or method)"
         print "   @stubgen:stub     - generate empty stub for the next item (class or method)"
+        print "   @oneway           - the next method is one-way: the proxy does not wait for it to complete (void methods"
+        print "                       without output parameters or interfaces only), one-way calls are handled in order"
         print "For non-const pointer and reference method/function parameters:"
         print "   @in               - denotes an input parameter"
         print "   @out              - denotes an output parameter"
@@ -1173,6 +1201,10 @@ if __name__ == "__main__":
         print "   @maxlength:<expr> - specifies a maximum buffer length value (a constant, a parameter name or a math expression),"
         print "                       if not specified @length is used as maximum length, use round parenthesis for expressions,"
         print "                       e.g.: @length:bufferSize @length:(width*height*4)"
+        print "   @blob             - the input uint8_t buffer is passed as a sealed memory file next to the message instead of"
+        print "                       in it, for large buffers (Linux only, needs a @length)"
+        print "For int method/function parameters:"
+        print "   @descriptor       - the parameter is a file descriptor, the stub gets a duplicate of it (Linux only)"
         print ""
         print "The tags shall be placed inside comments."
         sys.exit()